@@ -12,8 +12,11 @@
 #endif
 
 #include <volk/constants.h> // for volk_available_machines, volk_c_com...
+#include <algorithm>        // for max
+#include <iomanip>          // for setw
 #include <iostream>         // for operator<<, endl, cout, ostream
 #include <string>           // for string
+#include <vector>           // for vector
 
 #include "volk/volk.h"           // for volk_get_alignment, volk_get_machine
 #include "volk_option_helpers.h" // for option_list, option_t
@@ -37,6 +40,75 @@ void print_malloc()
 #endif
 }
 
+void print_kernels()
+{
+    for (size_t i = 0; i < volk_kernel_count(); i++) {
+        const volk_kernel_info_t info = volk_kernel_info(i);
+        std::cout << info.name << ":";
+        for (size_t j = 0; j < info.impls.n_impls; j++) {
+            std::cout << " " << info.impls.impl_names[j];
+        }
+        std::cout << std::endl;
+    }
+}
+
+static int column_width(size_t arch)
+{
+    return std::string(volk_arch_name(arch)).size();
+}
+
+// one row per kernel and one column per arch of the current machine, a cell tells
+// if an impl depending on the arch exists (a: aligned, u: unaligned, -: missing)
+void print_coverage()
+{
+    const uint64_t caps = volk_get_machine_caps();
+    std::vector<size_t> archs;
+    size_t name_width = 6;
+    for (size_t i = 0; i < volk_arch_count(); i++) {
+        if (caps & (UINT64_C(1) << i)) {
+            archs.push_back(i);
+        }
+    }
+    for (size_t i = 0; i < volk_kernel_count(); i++) {
+        name_width = std::max(name_width, std::string(volk_kernel_info(i).name).size());
+    }
+
+    std::vector<size_t> missing(archs.size(), 0);
+    std::cout << std::left << std::setw(name_width) << "kernel";
+    for (size_t a = 0; a < archs.size(); a++) {
+        std::cout << " " << volk_arch_name(archs[a]);
+    }
+    std::cout << std::endl;
+    for (size_t i = 0; i < volk_kernel_count(); i++) {
+        const volk_kernel_info_t info = volk_kernel_info(i);
+        std::cout << std::setw(name_width) << info.name;
+        for (size_t a = 0; a < archs.size(); a++) {
+            std::string cell;
+            for (size_t j = 0; j < info.impls.n_impls; j++) {
+                if (!(info.impls.impl_deps[j] & (UINT64_C(1) << archs[a]))) {
+                    continue;
+                }
+                const char kind = info.impls.impl_alignment[j] ? 'a' : 'u';
+                if (cell.find(kind) == std::string::npos) {
+                    cell += kind;
+                }
+            }
+            if (cell.empty()) {
+                cell = "-";
+                missing[a]++;
+            }
+            std::cout << " " << std::setw(a + 1 < archs.size() ? column_width(archs[a]) : 0)
+                      << cell;
+        }
+        std::cout << std::endl;
+    }
+    std::cout << std::setw(name_width) << "missing";
+    for (size_t a = 0; a < archs.size(); a++) {
+        std::cout << " " << std::setw(a + 1 < archs.size() ? column_width(archs[a]) : 0)
+                  << missing[a];
+    }
+    std::cout << std::endl;
+}
 
 int main(int argc, char** argv)
 {
@@ -65,6 +137,16 @@ int main(int argc, char** argv)
                              "",
                              "print the malloc implementation used in volk_malloc",
                              print_malloc));
+    our_options.add(option_t("kernels",
+                             "",
+                             "print the kernels with their implementations on the "
+                             "current machine",
+                             print_kernels));
+    our_options.add(option_t("coverage",
+                             "",
+                             "print which archs of the current machine each kernel "
+                             "has implementations for",
+                             print_coverage));
     our_options.add(option_t("version", "v", "print the VOLK version", volk_version()));
 
     our_options.parse(argc, argv);
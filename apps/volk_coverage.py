@@ -0,0 +1,108 @@
+#!/usr/bin/env python
+# Copyright 2022 Free Software Foundation, Inc.
+#
+# This file is part of VOLK
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+# This script ranks the kernels by where optimization work pays off on this machine:
+# by the speedup of their fastest implementation over generic, and by the time the
+# archs they have no implementation for would save, estimated from the speedup these
+# archs give the other kernels over their other implementations.
+# Run:
+#   ./volk_profile -j volk_results.json
+#   ./volk_coverage.py volk_results.json
+# The archs each kernel has implementations for come from `volk-config-info --coverage`.
+
+import argparse
+import json
+import statistics
+import subprocess
+
+
+def read_coverage(text):
+    lines = text.splitlines()
+    archs = lines[0].split()[1:]
+    missing = {}
+    for line in lines[1:]:
+        cells = line.split()
+        if cells[0] == 'missing':
+            continue
+        missing[cells[0]] = [arch for arch, cell in zip(archs, cells[1:])
+                             if cell == '-' and arch != 'generic']
+    return archs, missing
+
+
+def impl_uses(impl, arch):
+    # impl names are built from the arch names, e.g. a_avx2_fma uses avx2 and fma
+    return '_' + arch + '_' in '_' + impl + '_'
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Rank the kernels by the speedup left on this machine')
+    parser.add_argument('results', help='JSON file written by volk_profile -j')
+    parser.add_argument('--coverage', default=None,
+                        help='output of volk-config-info --coverage, runs it by default')
+    parser.add_argument('--config-info', default='volk-config-info',
+                        help='volk-config-info executable')
+    parser.add_argument('-n', type=int, default=20, help='kernels to list per ranking')
+    args = parser.parse_args()
+
+    if args.coverage:
+        with open(args.coverage) as coverage_file:
+            coverage = coverage_file.read()
+    else:
+        coverage = subprocess.check_output([args.config_info, '--coverage'],
+                                           universal_newlines=True)
+    archs, missing = read_coverage(coverage)
+
+    with open(args.results) as json_file:
+        tests = json.load(json_file)['volk_tests']
+
+    kernels = {}
+    for test in tests:
+        times = {name: val['time'] for name, val in test['results'].items()}
+        generic = times.get('generic', times.get('u_generic'))
+        if not generic:  # some dont have a generic kernel
+            continue
+        best = min(times, key=times.get)
+        kernels[test['name']] = (generic, times, best)
+
+    # the speedup an arch gives the kernels that have an impl for it over their other impls
+    gains = {}
+    for generic, times, best in kernels.values():
+        for arch in archs:
+            with_arch = [t for impl, t in times.items() if impl_uses(impl, arch)]
+            without_arch = [t for impl, t in times.items() if not impl_uses(impl, arch)]
+            if arch != 'generic' and with_arch and without_arch:
+                gains.setdefault(arch, []).append(min(without_arch) / min(with_arch))
+    typical = {arch: statistics.median(g) for arch, g in gains.items()}
+
+    print('Kernels with the least speedup of the fastest impl over generic:')
+    print('%8s  %-48s %s' % ('speedup', 'kernel', 'fastest impl'))
+    ranked = sorted(kernels.items(), key=lambda k: k[1][0] / k[1][1][k[1][2]])
+    for name, (generic, times, best) in ranked[:args.n]:
+        print('%8.2f  %-48s %s' % (generic / times[best], name, best))
+
+    # a missing arch is expected to speed the kernel up as much as it typically speeds up
+    # the other kernels, weigh that by the time the kernel takes now
+    impacts = []
+    for name, (generic, times, best) in kernels.items():
+        candidates = [(typical[arch], arch) for arch in missing.get(name, [])
+                      if typical.get(arch, 0.0) > 1.0]
+        if candidates:
+            gain = max(candidates)[0]
+            archs_left = ' '.join(arch for g, arch in sorted(candidates, reverse=True))
+            impacts.append((times[best] * (1.0 - 1.0 / gain), gain, name, archs_left))
+
+    print('')
+    print('Kernels with the most time to save by implementing missing archs:')
+    print('%8s %8s  %-48s %s' % ('saved', 'speedup', 'kernel', 'missing archs'))
+    for saved, gain, name, archs_left in sorted(impacts, reverse=True)[:args.n]:
+        print('%8.4f %8.2f  %-48s %s' % (saved, gain, name, archs_left))
+
+
+if __name__ == '__main__':
+    main()
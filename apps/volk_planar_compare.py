@@ -0,0 +1,57 @@
+#!/usr/bin/env python
+# Copyright 2022 Free Software Foundation, Inc.
+#
+# This file is part of VOLK
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+# This script compares the kernels that take complex vectors as split real and
+# imaginary arrays with their counterparts on interleaved complex samples.
+# Run:
+#   ./volk_profile -j volk_results.json
+#   ./volk_planar_compare.py volk_results.json
+# Both kernels of a pair process the same number of complex values per call, so the
+# ratio of their best times is the speedup of keeping the samples planar.
+
+import argparse
+import json
+
+PAIRS = [
+    ('volk_32f_x4_complex_multiply_32f_x2', 'volk_32fc_x2_multiply_32fc'),
+    ('volk_32f_x4_complex_multiply_conjugate_32f_x2',
+     'volk_32fc_x2_multiply_conjugate_32fc'),
+    ('volk_32f_x4_complex_dot_prod_32f_x2', 'volk_32fc_x2_dot_prod_32fc'),
+    ('volk_32f_x2_complex_magnitude_32f', 'volk_32fc_magnitude_32f'),
+    ('volk_32f_x2_s32fc_rotatorpuppet_32f_x2', 'volk_32fc_s32fc_rotatorpuppet_32fc'),
+]
+
+
+def best(test):
+    times = {name: val['time'] for name, val in test['results'].items()}
+    impl = min(times, key=times.get)
+    return times[impl], impl
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compare the planar complex kernels with the interleaved ones')
+    parser.add_argument('results', help='JSON file written by volk_profile -j')
+    args = parser.parse_args()
+
+    with open(args.results) as json_file:
+        tests = {test['name']: test for test in json.load(json_file)['volk_tests']}
+
+    print('%8s  %-46s %-16s %s' % ('speedup', 'planar kernel', 'planar impl',
+                                    'interleaved impl'))
+    for planar, interleaved in PAIRS:
+        if planar not in tests or interleaved not in tests:
+            continue
+        planar_time, planar_impl = best(tests[planar])
+        interleaved_time, interleaved_impl = best(tests[interleaved])
+        print('%8.2f  %-46s %-16s %s' % (interleaved_time / planar_time, planar,
+                                          planar_impl, interleaved_impl))
+
+
+if __name__ == '__main__':
+    main()
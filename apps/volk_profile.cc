@@ -13,8 +13,10 @@
 #include <filesystem>
 #endif
 #include <stddef.h>          // for size_t
+#include <stdint.h>          // for uint64_t
 #include <sys/stat.h>        // for stat
 #include <volk/volk_prefs.h> // for volk_get_config_path
+#include <algorithm>         // for max
 #include <fstream>           // IWYU pragma: keep
 #include <iostream>          // for operator<<, basic_ostream
 #include <map>               // for map, map<>::iterator
@@ -40,6 +42,8 @@ void set_tolerance(float val) { test_params.set_tol(val); }
 void set_vlen(int val) { test_params.set_vlen((unsigned int)val); }
 void set_iter(int val) { test_params.set_iter((unsigned int)val); }
 void set_substr(std::string val) { test_params.set_regex(val); }
+void set_denormals(bool val) { test_params.set_denormal_inputs(val); }
+void set_flush_denormals(bool val) { test_params.set_flush_denormals(val); }
 bool update_mode = false;
 void set_update(bool val) { update_mode = val; }
 bool dry_run = false;
@@ -48,6 +52,24 @@ std::string json_filename("");
 void set_json(std::string val) { json_filename = val; }
 std::string volk_config_path("");
 void set_volk_config(std::string val) { volk_config_path = val; }
+unsigned int large_vlen = 0;
+void set_large_vlen(int val) { large_vlen = (unsigned int)val; }
+
+/*
+ * Non-temporal stores only pay off for outputs much larger than the cache, so the
+ * kernels with _nt impls are profiled at large_vlen when it is set.
+ */
+static bool has_streaming_impls(const volk_func_desc_t& desc)
+{
+    for (size_t i = 0; i < desc.n_impls; i++) {
+        const std::string impl_name(desc.impl_names[i]);
+        if (impl_name.size() > 3 &&
+            impl_name.compare(impl_name.size() - 3, 3, "_nt") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
 
 int main(int argc, char* argv[])
 {
@@ -65,6 +87,15 @@ int main(int argc, char* argv[])
         (option_t("tests-substr", "R", "Run tests matching substring", set_substr)));
     profile_options.add(
         (option_t("update", "u", "Run only kernels missing from config", set_update)));
+    profile_options.add((option_t("denormals",
+                                  "D",
+                                  "Benchmark with denormal float inputs, best with -n",
+                                  set_denormals)));
+    profile_options.add(
+        (option_t("flush-denormals",
+                  "F",
+                  "Run the kernels with the FTZ/DAZ mode of volk_fp_mode_push()",
+                  set_flush_denormals)));
     profile_options.add(
         (option_t("dry-run",
                   "n",
@@ -74,6 +105,11 @@ int main(int argc, char* argv[])
         "json", "j", "Write results to JSON file named as argument value", set_json)));
     profile_options.add(
         (option_t("path", "p", "Specify the volk_config path", set_volk_config)));
+    profile_options.add((option_t(
+        "large-vlen",
+        "L",
+        "Profile the kernels with streaming store (_nt) impls at this vector length",
+        set_large_vlen)));
     profile_options.parse(argc, argv);
 
     if (profile_options.present("help")) {
@@ -135,11 +171,18 @@ int main(int argc, char* argv[])
         }
 
         if (regex_match && update) {
+            volk_test_params_t params = test_case.test_parameters();
+            if (large_vlen > 0 && has_streaming_impls(test_case.desc())) {
+                // keep the number of processed points, and so the run time, the same
+                const uint64_t points = (uint64_t)params.vlen() * params.iter();
+                params.set_iter((unsigned int)std::max<uint64_t>(1, points / large_vlen));
+                params.set_vlen(large_vlen);
+            }
             try {
                 run_volk_tests(test_case.desc(),
                                test_case.kernel_ptr(),
                                test_case.name(),
-                               test_case.test_parameters(),
+                               params,
                                &results,
                                test_case.puppet_master_name());
             } catch (std::string& error) {
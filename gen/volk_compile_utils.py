@@ -20,9 +20,10 @@ def do_arch_flags_list(compiler):
     print(';'.join(output))
 
 
-def do_machines_list(arch_names):
+def do_machines_list(arch_names, tunes):
     output = list()
     for machine in volk_machine_defs.machines:
+        if machine.tune and machine.tune not in tunes: continue
         machine_arch_set = set(machine.arch_names)
         if set(arch_names).intersection(machine_arch_set) == machine_arch_set:
             output.append(machine.name)
@@ -34,20 +35,29 @@ def do_machine_flags_list(compiler, machine_name):
     machine = volk_machine_defs.machine_dict[machine_name]
     for arch in machine.archs:
         output.extend(arch.get_flags(compiler))
+    if machine.tune and compiler in ('gnu', 'clang'):
+        output.append('-mtune=' + machine.tune)
     print(' '.join(output))
 
 
+def do_tunes_list():
+    tunes = set(m.tune for m in volk_machine_defs.machines if m.tune)
+    print(';'.join(sorted(tunes)))
+
+
 def main():
     parser = argparse.ArgumentParser()
     parser.add_argument('--mode', type=str)
     parser.add_argument('--compiler', type=str)
     parser.add_argument('--archs', type=str)
     parser.add_argument('--machine', type=str)
+    parser.add_argument('--tunes', type=str, default='')
     args = parser.parse_args()
 
     if args.mode == 'arch_flags': return do_arch_flags_list(args.compiler.lower())
-    if args.mode == 'machines': return do_machines_list(args.archs.split(';'))
+    if args.mode == 'machines': return do_machines_list(args.archs.split(';'), args.tunes.split(';'))
     if args.mode == 'machine_flags': return do_machine_flags_list(args.compiler.lower(), args.machine)
+    if args.mode == 'tunes': return do_tunes_list()
 
 if __name__ == '__main__': 
     main()
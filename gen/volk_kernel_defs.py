@@ -10,6 +10,9 @@ import os
 import re
 import sys
 import glob
+import pickle
+import hashlib
+import multiprocessing
 
 ########################################################################
 # Strip comments from a c/cpp file.
@@ -142,6 +145,46 @@ def extract_lv_haves(code):
         if have_set: haves.append(have_set)
     return haves
 
+########################################################################
+# Size in bytes of the items behind the pointer arguments of the kernels
+########################################################################
+item_sizes = {
+    'float': 4, 'double': 8, 'lv_32fc_t': 8, 'lv_16sc_t': 4, 'lv_8sc_t': 2,
+    'char': 1, 'int8_t': 1, 'unsigned char': 1, 'uint8_t': 1,
+    'short': 2, 'int16_t': 2, 'uint16_t': 2,
+    'int': 4, 'int32_t': 4, 'unsigned int': 4, 'uint32_t': 4,
+    'int64_t': 8, 'uint64_t': 8,
+}
+
+########################################################################
+# Estimated floating point operations per point of the arithmetic kernels,
+# counted as in the generic implementation: a complex multiply is 6 flops,
+# a complex add 2. Kernels without an entry report 0, i.e. unknown.
+########################################################################
+kernel_flops = {
+    'volk_32f_x2_add_32f': 1, 'volk_32f_x2_subtract_32f': 1,
+    'volk_32f_x2_multiply_32f': 1, 'volk_32f_x2_divide_32f': 1,
+    'volk_32f_x2_max_32f': 1, 'volk_32f_x2_min_32f': 1,
+    'volk_32f_s32f_add_32f': 1, 'volk_32f_s32f_multiply_32f': 1,
+    'volk_32f_s32f_normalize': 1, 'volk_32f_accumulator_s32f': 1,
+    'volk_32f_x2_dot_prod_32f': 2, 'volk_32f_x2_dot_prod_16i': 2,
+    'volk_32f_sqrt_32f': 1, 'volk_32f_invsqrt_32f': 2,
+    'volk_32f_64f_add_64f': 1, 'volk_32f_64f_multiply_64f': 1,
+    'volk_64f_x2_add_64f': 1, 'volk_64f_x2_multiply_64f': 1,
+    'volk_64f_x2_max_64f': 1, 'volk_64f_x2_min_64f': 1,
+    'volk_32fc_conjugate_32fc': 1, 'volk_32fc_x2_add_32fc': 2,
+    'volk_32fc_32f_add_32fc': 1, 'volk_32fc_32f_multiply_32fc': 2,
+    'volk_32fc_accumulator_s32fc': 2, 'volk_32fc_32f_dot_prod_32fc': 4,
+    'volk_32fc_x2_multiply_32fc': 6, 'volk_32fc_x2_multiply_conjugate_32fc': 6,
+    'volk_32fc_s32fc_multiply_32fc': 6, 'volk_32fc_x2_dot_prod_32fc': 8,
+    'volk_32fc_x2_conjugate_dot_prod_32fc': 8,
+    'volk_32fc_x2_s32fc_multiply_conjugate_add_32fc': 8,
+    'volk_32fc_x2_divide_32fc': 11, 'volk_32fc_s32fc_x2_rotator_32fc': 12,
+    'volk_32fc_magnitude_squared_32f': 3, 'volk_32fc_magnitude_32f': 4,
+    'volk_32fc_x2_square_dist_32f': 5,
+    'volk_32fc_x2_s32f_square_dist_scalar_mult_32f': 6,
+}
+
 ########################################################################
 # Represent a processing kernel, parse from file
 ########################################################################
@@ -172,6 +215,13 @@ class kernel_class(object):
         self.arglist_types = ', '.join([a[0] for a in self.args])
         self.arglist_full = ', '.join(['%s %s'%a for a in self.args])
         self.arglist_names = ', '.join([a[1] for a in self.args])
+        #bytes accessed per point if every vector argument had one item per point
+        self.bytes_per_point = 0
+        for arg_type, arg_name in self.args:
+            base = arg_type.replace('const', '').strip()
+            if base.endswith('*'):
+                self.bytes_per_point += item_sizes.get(base[:-1].strip(), 0)
+        self.flops_per_point = kernel_flops.get(self.name, 0)
 
     def get_impls(self, archs):
         archs = set(archs)
@@ -190,8 +240,51 @@ class kernel_class(object):
 __file__ = os.path.abspath(__file__)
 srcdir = os.path.dirname(os.path.dirname(__file__))
 kernel_files = sorted(glob.glob(os.path.join(srcdir, "kernels", "volk", "*.h")))
-kernels = list(map(kernel_class, kernel_files))
+
+########################################################################
+# Parse the kernels, reusing the results of unchanged headers from a
+# cache file. Missing headers are parsed in parallel. With update, the
+# cache file is rewritten if anything changed.
+########################################################################
+def load_kernels(cache_file=None, update=False):
+    cache = dict()
+    if cache_file and os.path.exists(cache_file):
+        try:
+            with open(cache_file, 'rb') as f: cache = pickle.load(f)
+        except Exception: cache = dict() #stale format, parse again
+
+    hashes = dict()
+    for kernel_file in kernel_files:
+        with open(kernel_file, 'rb') as f: hashes[kernel_file] = hashlib.sha1(f.read()).hexdigest()
+    def cached(kernel_file):
+        entry = cache.get(os.path.basename(kernel_file))
+        return entry[1] if entry and entry[0] == hashes[kernel_file] else None
+
+    missing = [f for f in kernel_files if cached(f) is None]
+    parsed = list()
+    if len(missing) > 8:
+        try:
+            pool = multiprocessing.Pool()
+            parsed = pool.map(kernel_class, missing)
+            pool.close()
+        except (ImportError, OSError): parsed = list() #no working multiprocessing here
+    if len(parsed) != len(missing): parsed = list(map(kernel_class, missing))
+
+    new_cache = dict(
+        (os.path.basename(f), (hashes[f], k)) for f, k in zip(missing, parsed)
+    )
+    for kernel_file in kernel_files:
+        name = os.path.basename(kernel_file)
+        if name not in new_cache: new_cache[name] = cache[name]
+
+    if cache_file and update and (missing or set(cache) != set(new_cache)):
+        #write atomically, templates may read the cache at the same time
+        tmp_file = '%s.%d'%(cache_file, os.getpid())
+        with open(tmp_file, 'wb') as f: pickle.dump(new_cache, f, pickle.HIGHEST_PROTOCOL)
+        os.replace(tmp_file, cache_file)
+
+    return [new_cache[os.path.basename(f)][1] for f in kernel_files]
 
 if __name__ == '__main__':
-    print(kernels)
+    print(load_kernels())
     
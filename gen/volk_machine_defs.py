@@ -12,8 +12,10 @@ machines = list()
 machine_dict = dict()
 
 class machine_class(object):
-    def __init__(self, name, archs):
+    def __init__(self, name, archs, tune=None, uarchs=None):
         self.name = name
+        self.tune = tune #-mtune value, the machine is only built if the compiler knows it
+        self.uarchs = uarchs.split() if uarchs else list() #selected on these cpus only
         self.archs = list()
         self.arch_names = list()
         for arch_name in archs:
@@ -25,16 +27,16 @@ class machine_class(object):
 
     def __repr__(self): return self.name
 
-def register_machine(name, archs):
+def register_machine(name, archs, **kwargs):
     for i, arch_name in enumerate(archs):
         if '|' in arch_name: #handle special arch names with the '|'
             for arch_sub in arch_name.split('|'):
                 if arch_sub:
-                    register_machine(name+'_'+arch_sub, archs[:i] + [arch_sub] + archs[i+1:])
+                    register_machine(name+'_'+arch_sub, archs[:i] + [arch_sub] + archs[i+1:], **kwargs)
                 else:
-                    register_machine(name, archs[:i] + archs[i+1:])
+                    register_machine(name, archs[:i] + archs[i+1:], **kwargs)
             return
-    machine = machine_class(name=name, archs=archs)
+    machine = machine_class(name=name, archs=archs, **kwargs)
     machines.append(machine)
     machine_dict[machine.name] = machine
 
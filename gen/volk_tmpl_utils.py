@@ -16,32 +16,57 @@ import volk_kernel_defs
 from mako.template import Template
 
 
-def __parse_tmpl(_tmpl, **kwargs):
+def __make_tmpl(_tmpl):
+    return Template("""
+
+/* this file was generated by volk template utils, do not edit! */
+
+""" + _tmpl)
+
+
+def __render_tmpl(template, kernels, **kwargs):
     defs = {
         'archs': volk_arch_defs.archs,
         'arch_dict': volk_arch_defs.arch_dict,
         'machines': volk_machine_defs.machines,
         'machine_dict': volk_machine_defs.machine_dict,
-        'kernels': volk_kernel_defs.kernels,
+        'kernels': kernels,
     }
     defs.update(kwargs)
-    _tmpl = """
-
-/* this file was generated by volk template utils, do not edit! */
-
-""" + _tmpl
-    return str(Template(_tmpl).render(**defs))
+    return str(template.render(**defs))
 
 
 def main():
     parser = argparse.ArgumentParser()
     parser.add_argument('--input', type=str)
     parser.add_argument('--output', type=str)
+    parser.add_argument('--kernel-cache', type=str,
+                        help='parsed kernel headers, updated when run without --input')
+    parser.add_argument('--per-kernel', action='store_true',
+                        help='render once per kernel (as kern), %%s in --output is the kernel name')
     args, extras = parser.parse_known_args()
 
-    output = __parse_tmpl(open(args.input).read(), args=extras)
-    if args.output: open(args.output, 'w').write(output)
-    else: print(output)
+    kernels = volk_kernel_defs.load_kernels(args.kernel_cache, update=not args.input)
+    if not args.input: return
+
+    template = __make_tmpl(open(args.input).read())
+    if args.per_kernel:
+        for kern in kernels:
+            __write_output(__render_tmpl(template, kernels, args=extras, kern=kern),
+                           args.output%kern.name)
+        return
+
+    output = __render_tmpl(template, kernels, args=extras)
+    if not args.output:
+        print(output)
+        return
+    __write_output(output, args.output)
+
+
+def __write_output(output, filename):
+    #keep the timestamp of unchanged outputs, so that their objects are not rebuilt
+    if os.path.exists(filename) and open(filename).read() == output: return
+    open(filename, 'w').write(output)
 
 
 if __name__ == '__main__': 
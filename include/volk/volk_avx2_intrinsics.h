@@ -330,4 +330,74 @@ static inline void vector_32fc_index_min_variant1(__m256 in0,
     *current_indices = _mm256_add_epi32(*current_indices, indices_increment);
 }
 
+/*
+ * Counts the set bits of each byte with two nibble table lookups and sums them into
+ * the four 64 bit lanes.
+ */
+static inline __m256i _mm256_popcnt_epi64_avx2(__m256i in)
+{
+    // the popcounts of 0 to 15 in each 128 bit lane
+    const __m256i table = _mm256_setr_epi64x(
+        0x0302020102010100, 0x0403030203020201, 0x0302020102010100, 0x0403030203020201);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    const __m256i lo = _mm256_and_si256(in, low_mask);
+    const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(in, 4), low_mask);
+    const __m256i count =
+        _mm256_add_epi8(_mm256_shuffle_epi8(table, lo), _mm256_shuffle_epi8(table, hi));
+    return _mm256_sad_epu8(count, _mm256_setzero_si256());
+}
+
+// carry-save adder: adds the bits of a, b and c into the bits of *high and *low
+static inline void
+_mm256_csa_avx2(__m256i* high, __m256i* low, __m256i a, __m256i b, __m256i c)
+{
+    const __m256i u = _mm256_xor_si256(a, b);
+    *high = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(u, c));
+    *low = _mm256_xor_si256(u, c);
+}
+
+/*
+ * One Harley-Seal step: adds the bits of 16 vectors to the ones, twos, fours and
+ * eights counters and returns the carries into sixteens, so that only one in 16
+ * vectors needs a full popcount.
+ */
+static inline __m256i _mm256_harley_seal_avx2(
+    const __m256i* in, __m256i* ones, __m256i* twos, __m256i* fours, __m256i* eights)
+{
+    __m256i twosA, twosB, foursA, foursB, eightsA, eightsB, sixteens;
+    _mm256_csa_avx2(&twosA, ones, *ones, in[0], in[1]);
+    _mm256_csa_avx2(&twosB, ones, *ones, in[2], in[3]);
+    _mm256_csa_avx2(&foursA, twos, *twos, twosA, twosB);
+    _mm256_csa_avx2(&twosA, ones, *ones, in[4], in[5]);
+    _mm256_csa_avx2(&twosB, ones, *ones, in[6], in[7]);
+    _mm256_csa_avx2(&foursB, twos, *twos, twosA, twosB);
+    _mm256_csa_avx2(&eightsA, fours, *fours, foursA, foursB);
+    _mm256_csa_avx2(&twosA, ones, *ones, in[8], in[9]);
+    _mm256_csa_avx2(&twosB, ones, *ones, in[10], in[11]);
+    _mm256_csa_avx2(&foursA, twos, *twos, twosA, twosB);
+    _mm256_csa_avx2(&twosA, ones, *ones, in[12], in[13]);
+    _mm256_csa_avx2(&twosB, ones, *ones, in[14], in[15]);
+    _mm256_csa_avx2(&foursB, twos, *twos, twosA, twosB);
+    _mm256_csa_avx2(&eightsB, fours, *fours, foursA, foursB);
+    _mm256_csa_avx2(&sixteens, eights, *eights, eightsA, eightsB);
+    return sixteens;
+}
+
+/*
+ * The total of the counters a sequence of Harley-Seal steps leaves in four 64 bit
+ * lanes, given the sum of the popcounts of the returned sixteens.
+ */
+static inline __m256i _mm256_harley_seal_total_avx2(
+    __m256i sixteens_count, __m256i ones, __m256i twos, __m256i fours, __m256i eights)
+{
+    __m256i total = _mm256_slli_epi64(sixteens_count, 4);
+    total = _mm256_add_epi64(total,
+                             _mm256_slli_epi64(_mm256_popcnt_epi64_avx2(eights), 3));
+    total = _mm256_add_epi64(total,
+                             _mm256_slli_epi64(_mm256_popcnt_epi64_avx2(fours), 2));
+    total = _mm256_add_epi64(total,
+                             _mm256_slli_epi64(_mm256_popcnt_epi64_avx2(twos), 1));
+    return _mm256_add_epi64(total, _mm256_popcnt_epi64_avx2(ones));
+}
+
 #endif /* INCLUDE_VOLK_VOLK_AVX2_INTRINSICS_H_ */
@@ -0,0 +1,237 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*
+ * This file is intended to hold AVX-512 intrinsics of intrinsics.
+ * They should be used in VOLK kernels to avoid copy-paste.
+ */
+
+#ifndef INCLUDE_VOLK_VOLK_AVX512_INTRINSICS_H_
+#define INCLUDE_VOLK_VOLK_AVX512_INTRINSICS_H_
+#include <immintrin.h>
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef __AVX512F__
+/*
+ * Masks of the first n float lanes, of the first n complex values and of the first
+ * n double lanes of a vector, for loading and storing the tails of the loops with
+ * masked moves. n must not be larger than 16, 8 and 8.
+ */
+static inline __mmask16 _mm512_tail_mask_ps(unsigned int n)
+{
+    return (__mmask16)((1u << n) - 1u);
+}
+
+static inline __mmask16 _mm512_complex_tail_mask_ps(unsigned int n)
+{
+    return (__mmask16)((1u << (2 * n)) - 1u);
+}
+
+static inline __mmask8 _mm512_tail_mask_pd(unsigned int n)
+{
+    return (__mmask8)((1u << n) - 1u);
+}
+
+static inline __m512 _mm512_complexmul_ps(const __m512 x, const __m512 y)
+{
+    const __m512 yl = _mm512_moveldup_ps(y);      // cr,cr,dr,dr ...
+    const __m512 yh = _mm512_movehdup_ps(y);      // ci,ci,di,di ...
+    const __m512 xs = _mm512_permute_ps(x, 0xB1); // ai,ar,bi,br ...
+
+    // ar*cr-ai*ci, ai*cr+ar*ci, br*dr-bi*di, bi*dr+br*di ...
+    return _mm512_fmaddsub_ps(x, yl, _mm512_mul_ps(xs, yh));
+}
+
+static inline __m512 _mm512_complexconjugatemul_ps(const __m512 x, const __m512 y)
+{
+    const __m512 yl = _mm512_moveldup_ps(y);      // cr,cr,dr,dr ...
+    const __m512 yh = _mm512_movehdup_ps(y);      // ci,ci,di,di ...
+    const __m512 xs = _mm512_permute_ps(x, 0xB1); // ai,ar,bi,br ...
+
+    // ar*cr+ai*ci, ai*cr-ar*ci, br*dr+bi*di, bi*dr-br*di ...
+    return _mm512_fmsubadd_ps(x, yl, _mm512_mul_ps(xs, yh));
+}
+
+/*
+ * Splits 16 interleaved complex values into their real and their imaginary parts,
+ * in the order of the complex values.
+ */
+static inline void _mm512_deinterleave_ps(__m512* real,
+                                          __m512* imag,
+                                          const __m512 cplxValue0,
+                                          const __m512 cplxValue1)
+{
+    const __m512i even =
+        _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i odd =
+        _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    *real = _mm512_permutex2var_ps(cplxValue0, even, cplxValue1);
+    *imag = _mm512_permutex2var_ps(cplxValue0, odd, cplxValue1);
+}
+
+static inline __m512 _mm512_magnitudesquared_ps(const __m512 cplxValue0,
+                                                const __m512 cplxValue1)
+{
+    __m512 real, imag;
+    _mm512_deinterleave_ps(&real, &imag, cplxValue0, cplxValue1);
+    return _mm512_fmadd_ps(real, real, _mm512_mul_ps(imag, imag));
+}
+
+static inline __m512 _mm512_magnitude_ps(const __m512 cplxValue0, const __m512 cplxValue1)
+{
+    return _mm512_sqrt_ps(_mm512_magnitudesquared_ps(cplxValue0, cplxValue1));
+}
+
+static inline __m512 _mm512_scaled_norm_dist_ps(const __m512 symbols0,
+                                                const __m512 symbols1,
+                                                const __m512 points0,
+                                                const __m512 points1,
+                                                const __m512 scalar)
+{
+    /*
+     * Calculate: |y - x|^2 * SNR_lin
+     * Consider 'symbolsX' and 'pointsX' to be complex float
+     * 'symbolsX' are 'y' and 'pointsX' are 'x'
+     */
+    const __m512 diff0 = _mm512_sub_ps(symbols0, points0);
+    const __m512 diff1 = _mm512_sub_ps(symbols1, points1);
+    const __m512 norms = _mm512_magnitudesquared_ps(diff0, diff1);
+    return _mm512_mul_ps(norms, scalar);
+}
+
+/* Sums the 8 complex values of a vector. */
+static inline lv_32fc_t _mm512_complex_reduce_add_ps(const __m512 x)
+{
+    const __m256 sum8 =
+        _mm256_add_ps(_mm512_castps512_ps256(x),
+                      _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(x), 1)));
+    const __m128 sum4 =
+        _mm_add_ps(_mm256_castps256_ps128(sum8), _mm256_extractf128_ps(sum8, 1));
+    const __m128 sum2 = _mm_add_ps(sum4, _mm_movehl_ps(sum4, sum4));
+    return lv_cmake(_mm_cvtss_f32(sum2),
+                    _mm_cvtss_f32(_mm_shuffle_ps(sum2, sum2, _MM_SHUFFLE(1, 1, 1, 1))));
+}
+
+/*
+ * The AVX-512 counterpart of vector_32fc_index_max_variant1() in
+ * volk_avx2_intrinsics.h. It keeps the maximum squared magnitude seen by each lane
+ * and the index it was found at, for 16 complex values in their natural order.
+ * Lanes not set in mask, e.g. past the end of the input, are left as they are.
+ * The comparison is ordered, a NaN never replaces the maximum.
+ */
+static inline void vector_32fc_index_max_avx512f(const __m512 in0,
+                                                 const __m512 in1,
+                                                 const __mmask16 mask,
+                                                 __m512* max_values,
+                                                 __m512i* max_indices,
+                                                 __m512i* current_indices,
+                                                 const __m512i indices_increment)
+{
+    const __m512 abs_squared = _mm512_magnitudesquared_ps(in0, in1);
+    const __mmask16 greater =
+        _mm512_mask_cmp_ps_mask(mask, abs_squared, *max_values, _CMP_GT_OS);
+    *max_values = _mm512_mask_mov_ps(*max_values, greater, abs_squared);
+    *max_indices = _mm512_mask_mov_epi32(*max_indices, greater, *current_indices);
+    *current_indices = _mm512_add_epi32(*current_indices, indices_increment);
+}
+
+/*
+ * Reduces the lanes kept by vector_32fc_index_max_avx512f() to the index of the
+ * maximum. Of equal maxima the lowest index wins, like in a sequential search.
+ */
+static inline uint32_t _mm512_index_max_reduce_ps(const __m512 max_values,
+                                                  const __m512i max_indices)
+{
+    const float max = _mm512_reduce_max_ps(max_values);
+    const __mmask16 is_max =
+        _mm512_cmp_ps_mask(max_values, _mm512_set1_ps(max), _CMP_EQ_OQ);
+    return (uint32_t)_mm512_mask_reduce_min_epu32(is_max, max_indices);
+}
+
+/*
+ * Polar decoder LLR updates of 16 pairs of LLRs, see _mm256_polar_minsum_llrs()
+ * and _mm256_polar_fsign_add_llrs() in volk_avx_intrinsics.h.
+ */
+static inline __m512 _mm512_polar_minsum_llrs(const __m512 src0, const __m512 src1)
+{
+    const __m512i sign_mask = _mm512_set1_epi32(0x80000000);
+
+    __m512 llr0, llr1;
+    _mm512_deinterleave_ps(&llr0, &llr1, src0, src1);
+
+    // calculate result
+    const __m512i sign = _mm512_and_epi32(
+        _mm512_xor_epi32(_mm512_castps_si512(llr0), _mm512_castps_si512(llr1)),
+        sign_mask);
+    const __m512 dst = _mm512_min_ps(_mm512_abs_ps(llr0), _mm512_abs_ps(llr1));
+    return _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(dst), sign));
+}
+
+static inline __m512
+_mm512_polar_fsign_add_llrs(const __m512 src0, const __m512 src1, const __m128i fbits)
+{
+    // the lanes with a nonzero bit subtract llr0
+    const __mmask16 negate =
+        (__mmask16)~_mm_movemask_epi8(_mm_cmpeq_epi8(fbits, _mm_setzero_si128()));
+    const __m512i sign_mask = _mm512_set1_epi32(0x80000000);
+
+    __m512 llr0, llr1;
+    _mm512_deinterleave_ps(&llr0, &llr1, src0, src1);
+
+    // calculate result
+    const __m512i llr0_bits = _mm512_castps_si512(llr0);
+    llr0 = _mm512_castsi512_ps(
+        _mm512_mask_xor_epi32(llr0_bits, negate, llr0_bits, sign_mask));
+    return _mm512_add_ps(llr0, llr1);
+}
+#endif /* __AVX512F__ */
+
+#ifdef __AVX512BW__
+/* Mask of the first n 16 bit lanes of a vector, n must not be larger than 32. */
+static inline __mmask32 _mm512_tail_mask_epi16(unsigned int n)
+{
+    return (__mmask32)((UINT64_C(1) << n) - 1u);
+}
+#endif /* __AVX512BW__ */
+
+#ifdef __AVX512CD__
+/*
+ * Adds one to hist[index] for each of the 16 lanes. Lanes hitting the same bin
+ * are detected with the AVX-512CD conflict instruction: only the last of them
+ * writes back, adding the number of its duplicates.
+ */
+static inline void _mm512_histogram_increment_avx512cd(uint32_t* hist, __m512i index)
+{
+    const __m512i conflicts = _mm512_conflict_epi32(index);
+    // a lane that a later lane conflicts with leaves the update to that lane
+    const __mmask16 superseded = (__mmask16)_mm512_reduce_or_epi32(conflicts);
+    const __mmask16 writers = (__mmask16)~superseded;
+
+    // 1 + popcount of the 16 bit conflict masks
+    const __m512i m1 = _mm512_set1_epi32(0x5555);
+    const __m512i m2 = _mm512_set1_epi32(0x3333);
+    const __m512i m4 = _mm512_set1_epi32(0x0f0f);
+    __m512i count = _mm512_sub_epi32(
+        conflicts, _mm512_and_si512(_mm512_srli_epi32(conflicts, 1), m1));
+    count = _mm512_add_epi32(_mm512_and_si512(count, m2),
+                             _mm512_and_si512(_mm512_srli_epi32(count, 2), m2));
+    count = _mm512_and_si512(_mm512_add_epi32(count, _mm512_srli_epi32(count, 4)), m4);
+    count = _mm512_add_epi32(count, _mm512_srli_epi32(count, 8));
+    count = _mm512_and_si512(count, _mm512_set1_epi32(0x1f));
+    count = _mm512_add_epi32(count, _mm512_set1_epi32(1));
+
+    __m512i bins =
+        _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), writers, index, hist, 4);
+    bins = _mm512_add_epi32(bins, count);
+    _mm512_mask_i32scatter_epi32(hist, writers, index, bins, 4);
+}
+#endif /* __AVX512CD__ */
+
+#endif /* INCLUDE_VOLK_VOLK_AVX512_INTRINSICS_H_ */
@@ -192,4 +192,21 @@ static inline __m256 _mm256_accumulate_square_sum_ps(
     return _mm256_add_ps(sq_acc, aux);
 }
 
+/*
+ * Masks of the first n float and of the first n double lanes, for the tails of the
+ * loops with _mm256_maskload_ps() and _mm256_maskstore_ps() or their _pd versions.
+ * n must not be larger than 8 and 4.
+ */
+static inline __m256i _mm256_tail_mask_ps(unsigned int n)
+{
+    static const int tail_masks[16] = { -1, -1, -1, -1, -1, -1, -1, -1,
+                                        0,  0,  0,  0,  0,  0,  0,  0 };
+    return _mm256_loadu_si256((const __m256i*)(tail_masks + 8 - n));
+}
+
+static inline __m256i _mm256_tail_mask_pd(unsigned int n)
+{
+    return _mm256_tail_mask_ps(2 * n);
+}
+
 #endif /* INCLUDE_VOLK_VOLK_AVX_INTRINSICS_H_ */
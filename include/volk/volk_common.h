@@ -168,4 +168,15 @@ static inline float log2f_non_ieee(float f)
 // precalculated 10.0 / log2f_non_ieee(10.0) to allow for constexpr
 #define volk_log2to10factor 3.01029995663981209120
 
+////////////////////////////////////////////////////////////////////////
+// Population count of a 64 bit word, for generic code and SIMD tails
+////////////////////////////////////////////////////////////////////////
+static inline uint64_t volk_popcnt64(uint64_t value)
+{
+    value = value - ((value >> 1) & 0x5555555555555555ULL);
+    value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+    value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (value * 0x0101010101010101ULL) >> 56;
+}
+
 #endif /*INCLUDED_LIBVOLK_COMMON_H*/
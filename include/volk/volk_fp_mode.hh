@@ -0,0 +1,46 @@
+/* -*- C++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_FP_MODE_HH
+#define INCLUDED_VOLK_FP_MODE_HH
+
+#include <volk/volk.h>
+
+namespace volk {
+
+/*!
+ * \brief Applies the floating point mode of the VOLK machine to the calling thread
+ * for the lifetime of the object
+ *
+ * \details
+ *   calls volk_fp_mode_push() on construction and volk_fp_mode_pop() on destruction,
+ *   e.g. to flush denormals to zero in a block of signal processing:
+ *   \code
+ *   {
+ *       volk::scoped_fp_mode fp_mode;
+ *       volk_32f_x2_multiply_32f(out, in, gain, n);
+ *   }
+ *   \endcode
+ */
+class scoped_fp_mode
+{
+public:
+    scoped_fp_mode() : d_previous(volk_fp_mode_push()) {}
+    ~scoped_fp_mode() { volk_fp_mode_pop(d_previous); }
+
+    scoped_fp_mode(const scoped_fp_mode&) = delete;
+    scoped_fp_mode& operator=(const scoped_fp_mode&) = delete;
+
+private:
+    volk_fp_mode_t d_previous;
+};
+
+} // namespace volk
+
+#endif // INCLUDED_VOLK_FP_MODE_HH
@@ -264,6 +264,134 @@ static inline float32x4_t _vtanq_f32(float32x4_t x)
     return vmulq_f32(sincos.val[0], _vinvq_f32(sincos.val[1]));
 }
 
+/* Arctangent polynomial for |x| <= 1, max relative error around 1.1e-7 */
+static inline float32x4_t _varctan_polyq_f32(float32x4_t x)
+{
+    const float32x4_t c0 = vdupq_n_f32(+0x1.000000p0f);
+    const float32x4_t c1 = vdupq_n_f32(-0x1.555534p-2f);
+    const float32x4_t c2 = vdupq_n_f32(+0x1.999082p-3f);
+    const float32x4_t c3 = vdupq_n_f32(-0x1.24159ep-3f);
+    const float32x4_t c4 = vdupq_n_f32(+0x1.c02f98p-4f);
+    const float32x4_t c5 = vdupq_n_f32(-0x1.5722bep-4f);
+    const float32x4_t c6 = vdupq_n_f32(+0x1.d77834p-5f);
+    const float32x4_t c7 = vdupq_n_f32(-0x1.f8b51cp-6f);
+    const float32x4_t c8 = vdupq_n_f32(+0x1.5f8164p-7f);
+    const float32x4_t c9 = vdupq_n_f32(-0x1.cbca62p-10f);
+
+    const float32x4_t x2 = vmulq_f32(x, x);
+    float32x4_t y = vmlaq_f32(c8, x2, c9);
+    y = vmlaq_f32(c7, x2, y);
+    y = vmlaq_f32(c6, x2, y);
+    y = vmlaq_f32(c5, x2, y);
+    y = vmlaq_f32(c4, x2, y);
+    y = vmlaq_f32(c3, x2, y);
+    y = vmlaq_f32(c2, x2, y);
+    y = vmlaq_f32(c1, x2, y);
+    y = vmlaq_f32(c0, x2, y);
+    return vmulq_f32(x, y);
+}
+
+/* c - x, with c = c_hi + c_lo given in two parts for the extra precision */
+static inline float32x4_t
+_vsub_from_constq_f32(const float c_hi, const float c_lo, float32x4_t x)
+{
+    return vaddq_f32(vsubq_f32(vdupq_n_f32(c_hi), x), vdupq_n_f32(c_lo));
+}
+
+/* Arctangent, |x| > 1 is folded with atan(x) = pi/2 - atan(1/x) */
+static inline float32x4_t _vatanq_f32(float32x4_t x)
+{
+    const uint32x4_t sign_mask = vdupq_n_u32(0x80000000);
+
+    const float32x4_t ax = vabsq_f32(x);
+    const uint32x4_t swap = vcgtq_f32(ax, vdupq_n_f32(1.f));
+    float32x4_t y = _varctan_polyq_f32(vbslq_f32(swap, _vinvq_f32(ax), ax));
+    y = vbslq_f32(swap, _vsub_from_constq_f32(0x1.921fb6p0f, -0x1.777a5dp-25f, y), y);
+    // copy the sign of x onto the result
+    return vbslq_f32(sign_mask, x, y);
+}
+
+/* Four quadrant arctangent of y / x, atan2f semantics for finite inputs */
+static inline float32x4_t _vatan2q_f32(float32x4_t y, float32x4_t x)
+{
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const uint32x4_t sign_mask = vdupq_n_u32(0x80000000);
+
+    const float32x4_t ax = vabsq_f32(x);
+    const float32x4_t ay = vabsq_f32(y);
+    const uint32x4_t swap = vcgtq_f32(ay, ax);
+    const float32x4_t num = vminq_f32(ax, ay);
+    const float32x4_t den = vmaxq_f32(ax, ay);
+    // atan2(0, 0) is 0, keep the reciprocal of 0 out of the ratio
+#ifdef LV_HAVE_NEONV8
+    const float32x4_t ratio = vbslq_f32(vceqq_f32(den, zero), zero, vdivq_f32(num, den));
+#else
+    const float32x4_t ratio =
+        vbslq_f32(vceqq_f32(den, zero), zero, vmulq_f32(num, _vinvq_f32(den)));
+#endif
+
+    // the sign bit of x picks the left half plane, so that atan2(0, -0) is pi
+    const uint32x4_t x_neg = vtstq_u32(vreinterpretq_u32_f32(x), sign_mask);
+
+    // result = offset +- atan(ratio) with offset 0, pi/2 or pi; the offset is
+    // added in two parts, which keeps the result within about an ulp
+    const float32x4_t pi_hi = vdupq_n_f32(0x1.921fb6p1f);
+    const float32x4_t pi_lo = vdupq_n_f32(-0x1.777a5dp-24f);
+    const float32x4_t pi_2_hi = vdupq_n_f32(0x1.921fb6p0f);
+    const float32x4_t pi_2_lo = vdupq_n_f32(-0x1.777a5dp-25f);
+    const float32x4_t offset_hi = vbslq_f32(swap, pi_2_hi, vbslq_f32(x_neg, pi_hi, zero));
+    const float32x4_t offset_lo = vbslq_f32(swap, pi_2_lo, vbslq_f32(x_neg, pi_lo, zero));
+    const uint32x4_t negate = vandq_u32(veorq_u32(swap, x_neg), sign_mask);
+    float32x4_t result = vreinterpretq_f32_u32(
+        veorq_u32(vreinterpretq_u32_f32(_varctan_polyq_f32(ratio)), negate));
+    result = vaddq_f32(vaddq_f32(result, offset_lo), offset_hi);
+    return vbslq_f32(sign_mask, y, result);
+}
+
+/* Exponential, the Cephes expf algorithm, inputs are clamped to +-88.376 */
+static inline float32x4_t _vexpq_f32(float32x4_t x)
+{
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t exp_hi = vdupq_n_f32(88.3762626647949f);
+    const float32x4_t exp_lo = vdupq_n_f32(-88.3762626647949f);
+    const float32x4_t log2EF = vdupq_n_f32(1.44269504088896341f);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const float32x4_t exp_C1 = vdupq_n_f32(0.693359375f);
+    const float32x4_t exp_C2 = vdupq_n_f32(-2.12194440e-4f);
+    const float32x4_t exp_p0 = vdupq_n_f32(1.9875691500e-4f);
+    const float32x4_t exp_p1 = vdupq_n_f32(1.3981999507e-3f);
+    const float32x4_t exp_p2 = vdupq_n_f32(8.3334519073e-3f);
+    const float32x4_t exp_p3 = vdupq_n_f32(4.1665795894e-2f);
+    const float32x4_t exp_p4 = vdupq_n_f32(1.6666665459e-1f);
+    const float32x4_t exp_p5 = vdupq_n_f32(5.0000001201e-1f);
+
+    x = vmaxq_f32(vminq_f32(x, exp_hi), exp_lo);
+
+    // express exp(x) as exp(g + n*log(2)), n = floor(x * log2(e) + 0.5)
+    float32x4_t fx = vmlaq_f32(half, x, log2EF);
+    float32x4_t tmp = vcvtq_f32_s32(vcvtq_s32_f32(fx));
+    const uint32x4_t rounded_up = vcgtq_f32(tmp, fx);
+    fx = vsubq_f32(
+        tmp, vreinterpretq_f32_u32(vandq_u32(rounded_up, vreinterpretq_u32_f32(one))));
+
+    x = vmlsq_f32(x, fx, exp_C1);
+    x = vmlsq_f32(x, fx, exp_C2);
+    const float32x4_t z = vmulq_f32(x, x);
+
+    float32x4_t y = vmlaq_f32(exp_p1, exp_p0, x);
+    y = vmlaq_f32(exp_p2, y, x);
+    y = vmlaq_f32(exp_p3, y, x);
+    y = vmlaq_f32(exp_p4, y, x);
+    y = vmlaq_f32(exp_p5, y, x);
+    y = vmlaq_f32(x, y, z);
+    y = vaddq_f32(y, one);
+
+    // build 2^n
+    const int32x4_t pow2n =
+        vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(fx), vdupq_n_s32(0x7f)), 23);
+    return vmulq_f32(y, vreinterpretq_f32_s32(pow2n));
+}
+
 static inline float32x4_t _neon_accumulate_square_sum_f32(float32x4_t sq_acc,
                                                           float32x4_t acc,
                                                           float32x4_t val,
@@ -0,0 +1,97 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*
+ * This file is intended to hold RISC-V vector intrinsics of intrinsics.
+ * They should be used in VOLK kernels to avoid copy-paste.
+ *
+ * The complex helpers work on split real and imaginary vectors of LMUL 2, as
+ * loaded by the two field segment loads. With both fields of up to three complex
+ * operands live, LMUL 2 still leaves room in the 32 vector registers.
+ */
+
+#ifndef INCLUDE_VOLK_VOLK_RVV_INTRINSICS_H_
+#define INCLUDE_VOLK_VOLK_RVV_INTRINSICS_H_
+#include <riscv_vector.h>
+
+/* Loads vl interleaved complex values, split into their real and imaginary parts. */
+static inline void _rvv_load_complex_f32m2(vfloat32m2_t* real,
+                                           vfloat32m2_t* imag,
+                                           const float* src,
+                                           size_t vl)
+{
+    const vfloat32m2x2_t cplx = __riscv_vlseg2e32_v_f32m2x2(src, vl);
+    *real = __riscv_vget_v_f32m2x2_f32m2(cplx, 0);
+    *imag = __riscv_vget_v_f32m2x2_f32m2(cplx, 1);
+}
+
+/* Stores vl complex values, interleaving their real and imaginary parts. */
+static inline void _rvv_store_complex_f32m2(float* dst,
+                                            const vfloat32m2_t real,
+                                            const vfloat32m2_t imag,
+                                            size_t vl)
+{
+    vfloat32m2x2_t cplx = __riscv_vundefined_f32m2x2();
+    cplx = __riscv_vset_v_f32m2_f32m2x2(cplx, 0, real);
+    cplx = __riscv_vset_v_f32m2_f32m2x2(cplx, 1, imag);
+    __riscv_vsseg2e32_v_f32m2x2(dst, cplx, vl);
+}
+
+/* (ar + j ai) * (br + j bi) */
+static inline void _rvv_complexmul_f32m2(vfloat32m2_t* real,
+                                         vfloat32m2_t* imag,
+                                         const vfloat32m2_t ar,
+                                         const vfloat32m2_t ai,
+                                         const vfloat32m2_t br,
+                                         const vfloat32m2_t bi,
+                                         size_t vl)
+{
+    *real = __riscv_vfnmsac_vv_f32m2(__riscv_vfmul_vv_f32m2(ar, br, vl), ai, bi, vl);
+    *imag = __riscv_vfmacc_vv_f32m2(__riscv_vfmul_vv_f32m2(ar, bi, vl), ai, br, vl);
+}
+
+/* (ar + j ai) * (br - j bi) */
+static inline void _rvv_complexconjugatemul_f32m2(vfloat32m2_t* real,
+                                                  vfloat32m2_t* imag,
+                                                  const vfloat32m2_t ar,
+                                                  const vfloat32m2_t ai,
+                                                  const vfloat32m2_t br,
+                                                  const vfloat32m2_t bi,
+                                                  size_t vl)
+{
+    *real = __riscv_vfmacc_vv_f32m2(__riscv_vfmul_vv_f32m2(ar, br, vl), ai, bi, vl);
+    *imag = __riscv_vfnmsac_vv_f32m2(__riscv_vfmul_vv_f32m2(ai, br, vl), ar, bi, vl);
+}
+
+/* (ar + j ai) * (br + j bi) with the same scalar b in all lanes */
+static inline void _rvv_complexmul_scalar_f32m2(vfloat32m2_t* real,
+                                                vfloat32m2_t* imag,
+                                                const vfloat32m2_t ar,
+                                                const vfloat32m2_t ai,
+                                                const float br,
+                                                const float bi,
+                                                size_t vl)
+{
+    *real = __riscv_vfnmsac_vf_f32m2(__riscv_vfmul_vf_f32m2(ar, br, vl), bi, ai, vl);
+    *imag = __riscv_vfmacc_vf_f32m2(__riscv_vfmul_vf_f32m2(ai, br, vl), bi, ar, vl);
+}
+
+/* Scales the complex values to a magnitude of one. */
+static inline void _rvv_normalize_f32m2(vfloat32m2_t* real, vfloat32m2_t* imag, size_t vl)
+{
+    const vfloat32m2_t real_squared = __riscv_vfmul_vv_f32m2(*real, *real, vl);
+    const vfloat32m2_t mag_squared =
+        __riscv_vfmacc_vv_f32m2(real_squared, *imag, *imag, vl);
+    const vfloat32m2_t inv_mag =
+        __riscv_vfrdiv_vf_f32m2(__riscv_vfsqrt_v_f32m2(mag_squared, vl), 1.f, vl);
+    *real = __riscv_vfmul_vv_f32m2(*real, inv_mag, vl);
+    *imag = __riscv_vfmul_vv_f32m2(*imag, inv_mag, vl);
+}
+
+#endif /* INCLUDE_VOLK_VOLK_RVV_INTRINSICS_H_ */
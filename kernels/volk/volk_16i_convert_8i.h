@@ -43,6 +43,39 @@
 #include <inttypes.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16i_convert_8i_u_avx512bw(int8_t* outputVector,
+                                                  const int16_t* inputVector,
+                                                  unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int thirtysecondPoints = num_points / 32;
+
+    int8_t* outputVectorPtr = outputVector;
+    const int16_t* inputPtr = inputVector;
+    __m512i inputVal;
+
+    for (; number < thirtysecondPoints; number++) {
+        inputVal = _mm512_loadu_si512((const __m512i*)inputPtr);
+        inputVal = _mm512_srai_epi16(inputVal, 8);
+
+        // the high bytes fit, so the truncating narrow needs no saturation or permute
+        _mm256_storeu_si256((__m256i*)outputVectorPtr, _mm512_cvtepi16_epi8(inputVal));
+
+        inputPtr += 32;
+        outputVectorPtr += 32;
+    }
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++) {
+        outputVector[number] = (int8_t)(inputVector[number] >> 8);
+    }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
@@ -152,6 +185,39 @@ static inline void volk_16i_convert_8i_generic(int8_t* outputVector,
 #include <inttypes.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16i_convert_8i_a_avx512bw(int8_t* outputVector,
+                                                  const int16_t* inputVector,
+                                                  unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int thirtysecondPoints = num_points / 32;
+
+    int8_t* outputVectorPtr = outputVector;
+    const int16_t* inputPtr = inputVector;
+    __m512i inputVal;
+
+    for (; number < thirtysecondPoints; number++) {
+        inputVal = _mm512_load_si512((const __m512i*)inputPtr);
+        inputVal = _mm512_srai_epi16(inputVal, 8);
+
+        // the high bytes fit, so the truncating narrow needs no saturation or permute
+        _mm256_store_si256((__m256i*)outputVectorPtr, _mm512_cvtepi16_epi8(inputVal));
+
+        inputPtr += 32;
+        outputVectorPtr += 32;
+    }
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++) {
+        outputVector[number] = (int8_t)(inputVector[number] >> 8);
+    }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
@@ -0,0 +1,115 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16i_histogram_32u
+ *
+ * \b Overview
+ *
+ * Counts the occurrences of every 16-bit value. Bin i counts the value
+ * i - 32768, so histogram[0] counts -32768 and histogram[65535] counts 32767.
+ *
+ * The counts are added to the histogram rather than overwriting it. Clear it
+ * once and call the kernel for each block of a stream; histograms of separate
+ * streams merge by adding them bin by bin.
+ *
+ * The avx512cd implementation updates 16 bins at a time and resolves bins hit
+ * more than once within a vector with the AVX-512 conflict detection, which
+ * keeps it fast for the narrow distributions of a lightly driven ADC. With
+ * 65536 bins, private sub-histograms would not fit into the L1 cache, so there
+ * is no sub-histogram variant as for \ref volk_8i_histogram_32u.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16i_histogram_32u(uint32_t* histogram, const int16_t* inputVector,
+ *                             unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li histogram: The 65536 bins to add the counts to.
+ * \li inputVector: The input samples.
+ * \li num_points: The number of samples.
+ *
+ * \b Outputs
+ * \li histogram: The updated histogram.
+ *
+ * \b Example
+ * Check the DC offset of a 12-bit ADC stored in 16-bit samples.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   int16_t* in = (int16_t*)volk_malloc(sizeof(int16_t)*N, alignment);
+ *   uint32_t* histogram = (uint32_t*)calloc(65536, sizeof(uint32_t));
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = (int16_t)(20.f + 1000.f * sinf(0.01f * ii));
+ *   }
+ *
+ *   volk_16i_histogram_32u(histogram, in, N);
+ *
+ *   double mean = 0.0;
+ *   for(unsigned int ii = 0; ii < 65536; ++ii){
+ *       mean += ((double)ii - 32768.0) * histogram[ii];
+ *   }
+ *   printf("DC offset: %f\n", mean / N);
+ *
+ *   free(histogram);
+ *   volk_free(in);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16i_histogram_32u_u_H
+#define INCLUDED_volk_16i_histogram_32u_u_H
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16i_histogram_32u_generic(uint32_t* histogram,
+                                                  const int16_t* inputVector,
+                                                  unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        histogram[inputVector[number] + 32768]++;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512CD
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_16i_histogram_32u_avx512cd(uint32_t* histogram,
+                                                   const int16_t* inputVector,
+                                                   unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const int16_t* inputPtr = inputVector;
+
+    const __m512i offset = _mm512_set1_epi32(32768);
+    __m512i index;
+
+    for (; number < sixteenthPoints; number++) {
+        index = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)inputPtr));
+        index = _mm512_add_epi32(index, offset);
+        _mm512_histogram_increment_avx512cd(histogram, index);
+        inputPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    volk_16i_histogram_32u_generic(histogram, inputPtr, num_points - number);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512CD */
+
+#endif /* INCLUDED_volk_16i_histogram_32u_u_H */
@@ -500,4 +500,48 @@ static inline void volk_16i_s32f_convert_32f_a_generic(float* outputVector,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_16i_s32f_convert_32f_sve(float* outputVector,
+                                                 const int16_t* inputVector,
+                                                 const float scalar,
+                                                 unsigned int num_points)
+{
+    const svfloat32_t invScalar = svdup_f32(1.f / scalar);
+    unsigned int number;
+
+    for (number = 0; number < num_points; number += svcntw()) {
+        const svbool_t pg = svwhilelt_b32(number, num_points);
+        // sign extending load of the 16 bit values into the 32 bit lanes
+        const svint32_t inVal = svld1sh_s32(pg, inputVector + number);
+        const svfloat32_t outVal = svmul_x(pg, svcvt_f32_x(pg, inVal), invScalar);
+        svst1(pg, outputVector + number, outVal);
+    }
+}
+#endif /* LV_HAVE_SVE */
+
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_16i_s32f_convert_32f_rvv(float* outputVector,
+                                                 const int16_t* inputVector,
+                                                 const float scalar,
+                                                 unsigned int num_points)
+{
+    const float invScalar = 1.f / scalar;
+    size_t n = num_points;
+    size_t vl;
+
+    // the widening conversion doubles LMUL, from 4 for the input to 8 for the output
+    for (; n > 0; n -= vl, inputVector += vl, outputVector += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        const vint16m4_t inVal = __riscv_vle16_v_i16m4(inputVector, vl);
+        const vfloat32m8_t outVal =
+            __riscv_vfmul_vf_f32m8(__riscv_vfwcvt_f_x_v_f32m8(inVal, vl), invScalar, vl);
+        __riscv_vse32_v_f32m8(outputVector, outVal, vl);
+    }
+}
+#endif /* LV_HAVE_RVV */
+
 #endif /* INCLUDED_volk_16i_s32f_convert_32f_a_H */
@@ -0,0 +1,406 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16i_x2_dot_prod_32i
+ *
+ * \b Overview
+ *
+ * Computes the dot product of two vectors of 16-bit integers with a 32-bit
+ * result, e.g. to correlate fixed-point samples with integer taps. The sum
+ * wraps around modulo 2^32 instead of saturating, so it is exact as long as
+ * the true result fits into 32 bits, independent of the summation order.
+ *
+ * The avxvnni and avx512vnni implementations multiply and accumulate pairs of
+ * samples with a single vpdpwssd instruction.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16i_x2_dot_prod_32i(int32_t* result, const int16_t* in_a,
+ *                               const int16_t* in_b, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li in_a: The first input vector.
+ * \li in_b: The second input vector.
+ * \li num_points: The number of samples in both vectors.
+ *
+ * \b Outputs
+ * \li result: The dot product.
+ *
+ * \b Example
+ * Correlate a block of samples with a sequence of +-1 chips.
+ * \code
+ *   int N = 1023;
+ *   unsigned int alignment = volk_get_alignment();
+ *   int16_t* samples = (int16_t*)volk_malloc(sizeof(int16_t)*N, alignment);
+ *   int16_t* chips = (int16_t*)volk_malloc(sizeof(int16_t)*N, alignment);
+ *   int32_t correlation;
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       chips[ii] = (ii * 7 % 5 < 2) ? 1 : -1;
+ *       samples[ii] = 1000 * chips[ii] + (int16_t)(ii % 13) - 6;
+ *   }
+ *
+ *   volk_16i_x2_dot_prod_32i(&correlation, samples, chips, N);
+ *   printf("correlation: %d\n", correlation);
+ *
+ *   volk_free(samples);
+ *   volk_free(chips);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16i_x2_dot_prod_32i_u_H
+#define INCLUDED_volk_16i_x2_dot_prod_32i_u_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16i_x2_dot_prod_32i_generic(int32_t* result,
+                                                    const int16_t* in_a,
+                                                    const int16_t* in_b,
+                                                    unsigned int num_points)
+{
+    // unsigned arithmetic wraps around like the vector accumulators
+    uint32_t dotProduct = 0;
+    for (unsigned int number = 0; number < num_points; number++) {
+        dotProduct += (uint32_t)((int32_t)in_a[number] * in_b[number]);
+    }
+    *result = (int32_t)dotProduct;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16i_x2_dot_prod_32i_u_avx2(int32_t* result,
+                                                   const int16_t* in_a,
+                                                   const int16_t* in_b,
+                                                   unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    __m256i accumulator = _mm256_setzero_si256();
+    for (; number < sixteenthPoints; number++) {
+        const __m256i a = _mm256_loadu_si256((const __m256i*)in_a);
+        const __m256i b = _mm256_loadu_si256((const __m256i*)in_b);
+        accumulator = _mm256_add_epi32(accumulator, _mm256_madd_epi16(a, b));
+        in_a += 16;
+        in_b += 16;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) uint32_t partial[8];
+    _mm256_store_si256((__m256i*)partial, accumulator);
+    uint32_t dotProduct = 0;
+    for (unsigned int i = 0; i < 8; i++) {
+        dotProduct += partial[i];
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        dotProduct += (uint32_t)((int32_t)(*in_a++) * (*in_b++));
+    }
+    *result = (int32_t)dotProduct;
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVXVNNI
+#include <immintrin.h>
+
+static inline void volk_16i_x2_dot_prod_32i_u_avxvnni(int32_t* result,
+                                                      const int16_t* in_a,
+                                                      const int16_t* in_b,
+                                                      unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    __m256i accumulator = _mm256_setzero_si256();
+    for (; number < sixteenthPoints; number++) {
+        const __m256i a = _mm256_loadu_si256((const __m256i*)in_a);
+        const __m256i b = _mm256_loadu_si256((const __m256i*)in_b);
+        accumulator = _mm256_dpwssd_avx_epi32(accumulator, a, b);
+        in_a += 16;
+        in_b += 16;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) uint32_t partial[8];
+    _mm256_store_si256((__m256i*)partial, accumulator);
+    uint32_t dotProduct = 0;
+    for (unsigned int i = 0; i < 8; i++) {
+        dotProduct += partial[i];
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        dotProduct += (uint32_t)((int32_t)(*in_a++) * (*in_b++));
+    }
+    *result = (int32_t)dotProduct;
+}
+
+#endif /* LV_HAVE_AVXVNNI */
+
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16i_x2_dot_prod_32i_u_avx512bw(int32_t* result,
+                                                       const int16_t* in_a,
+                                                       const int16_t* in_b,
+                                                       unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int thirtysecondPoints = num_points / 32;
+
+    __m512i accumulator = _mm512_setzero_si512();
+    for (; number < thirtysecondPoints; number++) {
+        const __m512i a = _mm512_loadu_si512((const __m512i*)in_a);
+        const __m512i b = _mm512_loadu_si512((const __m512i*)in_b);
+        accumulator = _mm512_add_epi32(accumulator, _mm512_madd_epi16(a, b));
+        in_a += 32;
+        in_b += 32;
+    }
+    uint32_t dotProduct = (uint32_t)_mm512_reduce_add_epi32(accumulator);
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++) {
+        dotProduct += (uint32_t)((int32_t)(*in_a++) * (*in_b++));
+    }
+    *result = (int32_t)dotProduct;
+}
+
+#endif /* LV_HAVE_AVX512BW */
+
+
+#ifdef LV_HAVE_AVX512VNNI
+#include <immintrin.h>
+
+static inline void volk_16i_x2_dot_prod_32i_u_avx512vnni(int32_t* result,
+                                                         const int16_t* in_a,
+                                                         const int16_t* in_b,
+                                                         unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int thirtysecondPoints = num_points / 32;
+
+    __m512i accumulator = _mm512_setzero_si512();
+    for (; number < thirtysecondPoints; number++) {
+        const __m512i a = _mm512_loadu_si512((const __m512i*)in_a);
+        const __m512i b = _mm512_loadu_si512((const __m512i*)in_b);
+        accumulator = _mm512_dpwssd_epi32(accumulator, a, b);
+        in_a += 32;
+        in_b += 32;
+    }
+    uint32_t dotProduct = (uint32_t)_mm512_reduce_add_epi32(accumulator);
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++) {
+        dotProduct += (uint32_t)((int32_t)(*in_a++) * (*in_b++));
+    }
+    *result = (int32_t)dotProduct;
+}
+
+#endif /* LV_HAVE_AVX512VNNI */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_16i_x2_dot_prod_32i_neon(int32_t* result,
+                                                 const int16_t* in_a,
+                                                 const int16_t* in_b,
+                                                 unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    const int16_t* aPtr = in_a;
+    const int16_t* bPtr = in_b;
+
+    int16x8_t aVal, bVal;
+    int32x4_t accumulator0 = vdupq_n_s32(0);
+    int32x4_t accumulator1 = vdupq_n_s32(0);
+    for (; number < eighthPoints; number++) {
+        aVal = vld1q_s16(aPtr);
+        bVal = vld1q_s16(bPtr);
+
+        accumulator0 = vmlal_s16(accumulator0, vget_low_s16(aVal), vget_low_s16(bVal));
+        accumulator1 = vmlal_s16(accumulator1, vget_high_s16(aVal), vget_high_s16(bVal));
+
+        aPtr += 8;
+        bPtr += 8;
+    }
+
+    // the lanes wrap around in 32 bits like the generic accumulator
+    uint32x4_t sum = vreinterpretq_u32_s32(vaddq_s32(accumulator0, accumulator1));
+    uint32_t dotProduct = vgetq_lane_u32(sum, 0) + vgetq_lane_u32(sum, 1) +
+                          vgetq_lane_u32(sum, 2) + vgetq_lane_u32(sum, 3);
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        dotProduct += (uint32_t)((int32_t)(*aPtr++) * (*bPtr++));
+    }
+
+    *result = (int32_t)dotProduct;
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16i_x2_dot_prod_32i_u_H */
+
+
+#ifndef INCLUDED_volk_16i_x2_dot_prod_32i_a_H
+#define INCLUDED_volk_16i_x2_dot_prod_32i_a_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16i_x2_dot_prod_32i_a_avx2(int32_t* result,
+                                                   const int16_t* in_a,
+                                                   const int16_t* in_b,
+                                                   unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    __m256i accumulator = _mm256_setzero_si256();
+    for (; number < sixteenthPoints; number++) {
+        const __m256i a = _mm256_load_si256((const __m256i*)in_a);
+        const __m256i b = _mm256_load_si256((const __m256i*)in_b);
+        accumulator = _mm256_add_epi32(accumulator, _mm256_madd_epi16(a, b));
+        in_a += 16;
+        in_b += 16;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) uint32_t partial[8];
+    _mm256_store_si256((__m256i*)partial, accumulator);
+    uint32_t dotProduct = 0;
+    for (unsigned int i = 0; i < 8; i++) {
+        dotProduct += partial[i];
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        dotProduct += (uint32_t)((int32_t)(*in_a++) * (*in_b++));
+    }
+    *result = (int32_t)dotProduct;
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVXVNNI
+#include <immintrin.h>
+
+static inline void volk_16i_x2_dot_prod_32i_a_avxvnni(int32_t* result,
+                                                      const int16_t* in_a,
+                                                      const int16_t* in_b,
+                                                      unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    __m256i accumulator = _mm256_setzero_si256();
+    for (; number < sixteenthPoints; number++) {
+        const __m256i a = _mm256_load_si256((const __m256i*)in_a);
+        const __m256i b = _mm256_load_si256((const __m256i*)in_b);
+        accumulator = _mm256_dpwssd_avx_epi32(accumulator, a, b);
+        in_a += 16;
+        in_b += 16;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) uint32_t partial[8];
+    _mm256_store_si256((__m256i*)partial, accumulator);
+    uint32_t dotProduct = 0;
+    for (unsigned int i = 0; i < 8; i++) {
+        dotProduct += partial[i];
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        dotProduct += (uint32_t)((int32_t)(*in_a++) * (*in_b++));
+    }
+    *result = (int32_t)dotProduct;
+}
+
+#endif /* LV_HAVE_AVXVNNI */
+
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16i_x2_dot_prod_32i_a_avx512bw(int32_t* result,
+                                                       const int16_t* in_a,
+                                                       const int16_t* in_b,
+                                                       unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int thirtysecondPoints = num_points / 32;
+
+    __m512i accumulator = _mm512_setzero_si512();
+    for (; number < thirtysecondPoints; number++) {
+        const __m512i a = _mm512_load_si512((const __m512i*)in_a);
+        const __m512i b = _mm512_load_si512((const __m512i*)in_b);
+        accumulator = _mm512_add_epi32(accumulator, _mm512_madd_epi16(a, b));
+        in_a += 32;
+        in_b += 32;
+    }
+    uint32_t dotProduct = (uint32_t)_mm512_reduce_add_epi32(accumulator);
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++) {
+        dotProduct += (uint32_t)((int32_t)(*in_a++) * (*in_b++));
+    }
+    *result = (int32_t)dotProduct;
+}
+
+#endif /* LV_HAVE_AVX512BW */
+
+
+#ifdef LV_HAVE_AVX512VNNI
+#include <immintrin.h>
+
+static inline void volk_16i_x2_dot_prod_32i_a_avx512vnni(int32_t* result,
+                                                         const int16_t* in_a,
+                                                         const int16_t* in_b,
+                                                         unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int thirtysecondPoints = num_points / 32;
+
+    __m512i accumulator = _mm512_setzero_si512();
+    for (; number < thirtysecondPoints; number++) {
+        const __m512i a = _mm512_load_si512((const __m512i*)in_a);
+        const __m512i b = _mm512_load_si512((const __m512i*)in_b);
+        accumulator = _mm512_dpwssd_epi32(accumulator, a, b);
+        in_a += 32;
+        in_b += 32;
+    }
+    uint32_t dotProduct = (uint32_t)_mm512_reduce_add_epi32(accumulator);
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++) {
+        dotProduct += (uint32_t)((int32_t)(*in_a++) * (*in_b++));
+    }
+    *result = (int32_t)dotProduct;
+}
+
+#endif /* LV_HAVE_AVX512VNNI */
+
+#endif /* INCLUDED_volk_16i_x2_dot_prod_32i_a_H */
@@ -15,6 +15,10 @@
  * Converts a complex vector of 16-bits integer each component
  * into a complex vector of 32-bits float each component.
  *
+ * The _nt implementations write the output with non-temporal stores, which bypass
+ * the cache. They are only faster when the output is much larger than the last
+ * level cache and not read again soon, see volk_profile -L.
+ *
  * <b>Dispatcher Prototype</b>
  * \code
  * void volk_16ic_convert_32fc(lv_32fc_t* outputVector, const lv_16sc_t* inputVector,
@@ -81,6 +85,37 @@ static inline void volk_16ic_convert_32fc_a_avx2(lv_32fc_t* outputVector,
 
 #endif /* LV_HAVE_AVX2 */
 
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16ic_convert_32fc_a_avx2_nt(lv_32fc_t* outputVector,
+                                                    const lv_16sc_t* inputVector,
+                                                    unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    const int16_t* complexVectorPtr = (int16_t*)inputVector;
+    float* outputVectorPtr = (float*)outputVector;
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const __m128i cplxValue = _mm_load_si128((const __m128i*)complexVectorPtr);
+        const __m256 outVal = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(cplxValue));
+        _mm256_stream_ps(outputVectorPtr, outVal);
+
+        complexVectorPtr += 8;
+        outputVectorPtr += 8;
+    }
+    // order the streaming stores before any later store
+    _mm_sfence();
+
+    for (number = quarter_points * 4; number < num_points; number++) {
+        *outputVectorPtr++ = (float)*complexVectorPtr++;
+        *outputVectorPtr++ = (float)*complexVectorPtr++;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
 #ifdef LV_HAVE_GENERIC
 
 static inline void volk_16ic_convert_32fc_generic(lv_32fc_t* outputVector,
@@ -168,6 +203,37 @@ static inline void volk_16ic_convert_32fc_a_avx(lv_32fc_t* outputVector,
 
 #endif /* LV_HAVE_AVX */
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16ic_convert_32fc_a_avx512f_nt(lv_32fc_t* outputVector,
+                                                       const lv_16sc_t* inputVector,
+                                                       unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    const int16_t* complexVectorPtr = (int16_t*)inputVector;
+    float* outputVectorPtr = (float*)outputVector;
+    unsigned int number;
+
+    for (number = 0; number < eighth_points; number++) {
+        const __m256i cplxValue = _mm256_load_si256((const __m256i*)complexVectorPtr);
+        const __m512 outVal = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(cplxValue));
+        _mm512_stream_ps(outputVectorPtr, outVal);
+
+        complexVectorPtr += 16;
+        outputVectorPtr += 16;
+    }
+    // order the streaming stores before any later store
+    _mm_sfence();
+
+    for (number = eighth_points * 8; number < num_points; number++) {
+        *outputVectorPtr++ = (float)*complexVectorPtr++;
+        *outputVectorPtr++ = (float)*complexVectorPtr++;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
 
 #ifdef LV_HAVE_NEON
 #include <arm_neon.h>
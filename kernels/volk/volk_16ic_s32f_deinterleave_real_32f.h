@@ -334,4 +334,36 @@ volk_16ic_s32f_deinterleave_real_32f_u_avx2(float* iBuffer,
 }
 #endif /* LV_HAVE_AVX2 */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void
+volk_16ic_s32f_deinterleave_real_32f_neon(float* iBuffer,
+                                          const lv_16sc_t* complexVector,
+                                          const float scalar,
+                                          unsigned int num_points)
+{
+    const int16_t* complexVectorPtr = (const int16_t*)complexVector;
+    float* iBufferPtr = iBuffer;
+    unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+    const float invScalar = 1.0 / scalar;
+
+    int16x4x2_t complexInput;
+    float32x4_t iFloatValue;
+    for (number = 0; number < quarter_points; number++) {
+        complexInput = vld2_s16(complexVectorPtr);
+        iFloatValue = vcvtq_f32_s32(vmovl_s16(complexInput.val[0]));
+        vst1q_f32(iBufferPtr, vmulq_n_f32(iFloatValue, invScalar));
+        complexVectorPtr += 8;
+        iBufferPtr += 4;
+    }
+
+    for (number = quarter_points * 4; number < num_points; number++) {
+        *iBufferPtr++ = ((float)(*complexVectorPtr++)) * invScalar;
+        complexVectorPtr++;
+    }
+}
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_16ic_s32f_deinterleave_real_32f_u_H */
@@ -346,4 +346,42 @@ static inline void volk_16ic_s32f_magnitude_32f_u_avx2(float* magnitudeVector,
 }
 #endif /* LV_HAVE_AVX2 */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_16ic_s32f_magnitude_32f_neonv8(float* magnitudeVector,
+                                                       const lv_16sc_t* complexVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    const int16_t* complexVectorPtr = (const int16_t*)complexVector;
+    float* magnitudeVectorPtr = magnitudeVector;
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+    const float invScalar = 1.0 / scalar;
+
+    int16x4x2_t complexVal;
+    float32x4_t realVal, imagVal, magVal;
+    for (; number < quarterPoints; number++) {
+        complexVal = vld2_s16(complexVectorPtr);
+        complexVectorPtr += 8;
+
+        realVal = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(complexVal.val[0])), invScalar);
+        imagVal = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(complexVal.val[1])), invScalar);
+
+        magVal = vmulq_f32(realVal, realVal);
+        magVal = vmlaq_f32(magVal, imagVal, imagVal);
+        vst1q_f32(magnitudeVectorPtr, vsqrtq_f32(magVal));
+        magnitudeVectorPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        float real = ((float)(*complexVectorPtr++)) * invScalar;
+        float imag = ((float)(*complexVectorPtr++)) * invScalar;
+        *magnitudeVectorPtr++ = sqrtf((real * real) + (imag * imag));
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
 #endif /* INCLUDED_volk_16ic_s32f_magnitude_32f_u_H */
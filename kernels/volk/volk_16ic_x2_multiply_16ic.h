@@ -413,6 +413,104 @@ static inline void volk_16ic_x2_multiply_16ic_a_avx2(lv_16sc_t* out,
 #endif /* LV_HAVE_AVX2  */
 
 
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16ic_x2_multiply_16ic_u_avx512bw(lv_16sc_t* out,
+                                                         const lv_16sc_t* in_a,
+                                                         const lv_16sc_t* in_b,
+                                                         unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int avx512_points = num_points / 16;
+
+    const lv_16sc_t* _in_a = in_a;
+    const lv_16sc_t* _in_b = in_b;
+    lv_16sc_t* _out = out;
+
+    __m512i a, b, c, c_sr, real, imag, b_sl, a_sl, result;
+
+    for (; number < avx512_points; number++) {
+        a = _mm512_loadu_si512((const __m512i*)_in_a); // ar,ai,br,bi,...
+        b = _mm512_loadu_si512((const __m512i*)_in_b); // cr,ci,dr,di,...
+        c = _mm512_mullo_epi16(a, b);
+
+        // the byte shifts work within 128 bit lanes, which hold whole complex values
+        c_sr = _mm512_bsrli_epi128(c, 2);
+        real = _mm512_subs_epi16(c, c_sr); // ar*cr-ai*ci in the even 16 bit elements
+
+        b_sl = _mm512_bslli_epi128(b, 2);
+        a_sl = _mm512_bslli_epi128(a, 2);
+        imag = _mm512_adds_epi16(_mm512_mullo_epi16(a, b_sl),
+                                 _mm512_mullo_epi16(b, a_sl)); // ai*cr+ci*ar in the odd
+
+        // the odd elements (set mask bits) come from imag
+        result = _mm512_mask_blend_epi16(0xAAAAAAAA, real, imag);
+
+        _mm512_storeu_si512((__m512i*)_out, result);
+
+        _in_a += 16;
+        _in_b += 16;
+        _out += 16;
+    }
+
+    number = avx512_points * 16;
+    for (; number < num_points; number++) {
+        *_out++ = (*_in_a++) * (*_in_b++);
+    }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16ic_x2_multiply_16ic_a_avx512bw(lv_16sc_t* out,
+                                                         const lv_16sc_t* in_a,
+                                                         const lv_16sc_t* in_b,
+                                                         unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int avx512_points = num_points / 16;
+
+    const lv_16sc_t* _in_a = in_a;
+    const lv_16sc_t* _in_b = in_b;
+    lv_16sc_t* _out = out;
+
+    __m512i a, b, c, c_sr, real, imag, b_sl, a_sl, result;
+
+    for (; number < avx512_points; number++) {
+        a = _mm512_load_si512((const __m512i*)_in_a); // ar,ai,br,bi,...
+        b = _mm512_load_si512((const __m512i*)_in_b); // cr,ci,dr,di,...
+        c = _mm512_mullo_epi16(a, b);
+
+        // the byte shifts work within 128 bit lanes, which hold whole complex values
+        c_sr = _mm512_bsrli_epi128(c, 2);
+        real = _mm512_subs_epi16(c, c_sr); // ar*cr-ai*ci in the even 16 bit elements
+
+        b_sl = _mm512_bslli_epi128(b, 2);
+        a_sl = _mm512_bslli_epi128(a, 2);
+        imag = _mm512_adds_epi16(_mm512_mullo_epi16(a, b_sl),
+                                 _mm512_mullo_epi16(b, a_sl)); // ai*cr+ci*ar in the odd
+
+        // the odd elements (set mask bits) come from imag
+        result = _mm512_mask_blend_epi16(0xAAAAAAAA, real, imag);
+
+        _mm512_store_si512((__m512i*)_out, result);
+
+        _in_a += 16;
+        _in_b += 16;
+        _out += 16;
+    }
+
+    number = avx512_points * 16;
+    for (; number < num_points; number++) {
+        *_out++ = (*_in_a++) * (*_in_b++);
+    }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
 #ifdef LV_HAVE_NEON
 #include <arm_neon.h>
 
@@ -462,4 +560,29 @@ static inline void volk_16ic_x2_multiply_16ic_neon(lv_16sc_t* out,
 }
 #endif /* LV_HAVE_NEON */
 
+#ifdef LV_HAVE_SVE2
+#include <arm_sve.h>
+
+static inline void volk_16ic_x2_multiply_16ic_sve2(lv_16sc_t* out,
+                                                   const lv_16sc_t* in_a,
+                                                   const lv_16sc_t* in_b,
+                                                   unsigned int num_points)
+{
+    const int16_t* a = (const int16_t*)in_a;
+    const int16_t* b = (const int16_t*)in_b;
+    int16_t* c = (int16_t*)out;
+    const unsigned int n_values = 2 * num_points;
+    const svint16_t zero = svdup_s16(0);
+    unsigned int number;
+
+    for (number = 0; number < n_values; number += svcnth()) {
+        const svbool_t pg = svwhilelt_b16(number, n_values);
+        const svint16_t aVal = svld1(pg, a + number);
+        const svint16_t bVal = svld1(pg, b + number);
+        // the SVE2 integer complex multiply add wraps around like the generic kernel
+        svst1(pg, c + number, svcmla(svcmla(zero, aVal, bVal, 0), aVal, bVal, 90));
+    }
+}
+#endif /* LV_HAVE_SVE2 */
+
 #endif /*INCLUDED_volk_16ic_x2_multiply_16ic_H*/
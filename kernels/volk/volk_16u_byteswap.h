@@ -169,6 +169,33 @@ static inline void volk_16u_byteswap_u_sse2(uint16_t* intsToSwap, unsigned int n
 }
 #endif /* LV_HAVE_SSE2 */
 
+#if LV_HAVE_AVX512BW
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+static inline void
+volk_16u_byteswap_u_avx512bw(uint16_t* intsToSwap, unsigned int num_points)
+{
+    unsigned int number;
+    const unsigned int thirtysecondPoints = num_points / 32;
+
+    uint16_t* inputPtr = intsToSwap;
+
+    // reverses the bytes of each 16 bit value, the same in each 128 bit lane
+    const __m512i myShuffle = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+
+    for (number = 0; number < thirtysecondPoints; number++) {
+        const __m512i input = _mm512_loadu_si512((void*)inputPtr);
+        _mm512_storeu_si512((void*)inputPtr, _mm512_shuffle_epi8(input, myShuffle));
+        inputPtr += 32;
+    }
+
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __mmask32 mask = _mm512_tail_mask_epi16(num_points - thirtysecondPoints * 32);
+    const __m512i input = _mm512_maskz_loadu_epi16(mask, inputPtr);
+    _mm512_mask_storeu_epi16(inputPtr, mask, _mm512_shuffle_epi8(input, myShuffle));
+}
+#endif /* LV_HAVE_AVX512BW */
 
 #endif /* INCLUDED_volk_16u_byteswap_u_H */
 #ifndef INCLUDED_volk_16u_byteswap_a_H
@@ -295,5 +322,32 @@ static inline void volk_16u_byteswap_u_orc(uint16_t* intsToSwap, unsigned int nu
 }
 #endif /* LV_HAVE_ORC */
 
+#if LV_HAVE_AVX512BW
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+static inline void
+volk_16u_byteswap_a_avx512bw(uint16_t* intsToSwap, unsigned int num_points)
+{
+    unsigned int number;
+    const unsigned int thirtysecondPoints = num_points / 32;
+
+    uint16_t* inputPtr = intsToSwap;
+
+    // reverses the bytes of each 16 bit value, the same in each 128 bit lane
+    const __m512i myShuffle = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+
+    for (number = 0; number < thirtysecondPoints; number++) {
+        const __m512i input = _mm512_load_si512((void*)inputPtr);
+        _mm512_store_si512((void*)inputPtr, _mm512_shuffle_epi8(input, myShuffle));
+        inputPtr += 32;
+    }
+
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __mmask32 mask = _mm512_tail_mask_epi16(num_points - thirtysecondPoints * 32);
+    const __m512i input = _mm512_maskz_loadu_epi16(mask, inputPtr);
+    _mm512_mask_storeu_epi16(inputPtr, mask, _mm512_shuffle_epi8(input, myShuffle));
+}
+#endif /* LV_HAVE_AVX512BW */
 
 #endif /* INCLUDED_volk_16u_byteswap_a_H */
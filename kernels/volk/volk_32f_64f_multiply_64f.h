@@ -188,5 +188,40 @@ static inline void volk_32f_64f_multiply_64f_a_avx(double* cVector,
 
 #endif /* LV_HAVE_AVX */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_64f_multiply_64f_neonv8(double* cVector,
+                                                    const float* aVector,
+                                                    const double* bVector,
+                                                    unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    double* cPtr = cVector;
+    const float* aPtr = aVector;
+    const double* bPtr = bVector;
+
+    float32x4_t aVal;
+    float64x2_t bVal1, bVal2;
+    for (; number < quarterPoints; number++) {
+        aVal = vld1q_f32(aPtr);
+        bVal1 = vld1q_f64(bPtr);
+        bVal2 = vld1q_f64(bPtr + 2);
+        aPtr += 4;
+        bPtr += 4;
+
+        vst1q_f64(cPtr, vmulq_f64(vcvt_f64_f32(vget_low_f32(aVal)), bVal1));
+        vst1q_f64(cPtr + 2, vmulq_f64(vcvt_high_f64_f32(aVal), bVal2));
+        cPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *cPtr++ = ((double)(*aPtr++)) * (*bPtr++);
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
 
 #endif /* INCLUDED_volk_32f_64f_multiply_64f_u_H */
@@ -72,6 +72,10 @@ static inline int maximum_frame_size(const int elements)
 {
     unsigned int frame_size = next_lower_power_of_two(elements);
     unsigned int frame_exp = log2_of_power_of_2(frame_size);
+    // less than two elements do not hold a frame
+    if (frame_exp == 0) {
+        return 0;
+    }
     return next_lower_power_of_two(frame_size / frame_exp);
 }
 
@@ -144,5 +148,28 @@ static inline void volk_32f_8u_polarbutterflypuppet_32f_u_avx2(float* llrs,
 }
 #endif /* LV_HAVE_AVX2 */
 
+#if LV_HAVE_AVX2 && LV_HAVE_AVX512F
+static inline void volk_32f_8u_polarbutterflypuppet_32f_u_avx512f(float* llrs,
+                                                                  const float* input,
+                                                                  unsigned char* u,
+                                                                  const int elements)
+{
+    unsigned int frame_size = maximum_frame_size(elements);
+    unsigned int frame_exp = log2_of_power_of_2(frame_size);
+
+    sanitize_bytes(u, elements);
+    clean_up_intermediate_values(llrs, u, frame_size, elements);
+    generate_error_free_input_vector(llrs + frame_exp * frame_size, u, frame_size);
+
+    unsigned int u_num = 0;
+    for (; u_num < frame_size; u_num++) {
+        volk_32f_8u_polarbutterfly_32f_u_avx512f(llrs, u, frame_exp, 0, u_num, u_num);
+        u[u_num] = llrs[u_num] > 0 ? 0 : 1;
+    }
+
+    clean_up_intermediate_values(llrs, u, frame_size, elements);
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_AVX512F */
+
 
 #endif /* VOLK_KERNELS_VOLK_VOLK_32F_8U_POLARBUTTERFLYPUPPET_32F_H_ */
@@ -55,6 +55,7 @@
 
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_32f_accumulator_s32f_a_avx(float* result,
                                                    const float* inputBuffer,
@@ -76,6 +77,10 @@ static inline void volk_32f_accumulator_s32f_a_avx(float* result,
         aPtr += 8;
     }
 
+    // masked tail, the lanes past num_points add 0
+    aVal = _mm256_maskload_ps(aPtr, _mm256_tail_mask_ps(num_points - eighthPoints * 8));
+    accumulator = _mm256_add_ps(accumulator, aVal);
+
     _mm256_store_ps(tempBuffer, accumulator);
 
     returnValue = tempBuffer[0];
@@ -87,10 +92,6 @@ static inline void volk_32f_accumulator_s32f_a_avx(float* result,
     returnValue += tempBuffer[6];
     returnValue += tempBuffer[7];
 
-    number = eighthPoints * 8;
-    for (; number < num_points; number++) {
-        returnValue += (*aPtr++);
-    }
     *result = returnValue;
 }
 #endif /* LV_HAVE_AVX */
@@ -98,6 +99,7 @@ static inline void volk_32f_accumulator_s32f_a_avx(float* result,
 
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_32f_accumulator_s32f_u_avx(float* result,
                                                    const float* inputBuffer,
@@ -119,6 +121,10 @@ static inline void volk_32f_accumulator_s32f_u_avx(float* result,
         aPtr += 8;
     }
 
+    // masked tail, the lanes past num_points add 0
+    aVal = _mm256_maskload_ps(aPtr, _mm256_tail_mask_ps(num_points - eighthPoints * 8));
+    accumulator = _mm256_add_ps(accumulator, aVal);
+
     _mm256_store_ps(tempBuffer, accumulator);
 
     returnValue = tempBuffer[0];
@@ -130,10 +136,6 @@ static inline void volk_32f_accumulator_s32f_u_avx(float* result,
     returnValue += tempBuffer[6];
     returnValue += tempBuffer[7];
 
-    number = eighthPoints * 8;
-    for (; number < num_points; number++) {
-        returnValue += (*aPtr++);
-    }
     *result = returnValue;
 }
 #endif /* LV_HAVE_AVX */
@@ -196,7 +198,7 @@ static inline void volk_32f_accumulator_s32f_u_sse(float* result,
     __m128 aVal = _mm_setzero_ps();
 
     for (; number < quarterPoints; number++) {
-        aVal = _mm_load_ps(aPtr);
+        aVal = _mm_loadu_ps(aPtr);
         accumulator = _mm_add_ps(accumulator, aVal);
         aPtr += 4;
     }
@@ -232,4 +234,42 @@ static inline void volk_32f_accumulator_s32f_generic(float* result,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_accumulator_s32f_neon(float* result,
+                                                  const float* inputBuffer,
+                                                  unsigned int num_points)
+{
+    float returnValue = 0;
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    const float* aPtr = inputBuffer;
+    __VOLK_ATTR_ALIGNED(16) float tempBuffer[4];
+
+    // two accumulators hide the latency of the adds
+    float32x4_t accumulator0 = vdupq_n_f32(0.0f);
+    float32x4_t accumulator1 = vdupq_n_f32(0.0f);
+
+    for (; number < eighthPoints; number++) {
+        accumulator0 = vaddq_f32(accumulator0, vld1q_f32(aPtr));
+        accumulator1 = vaddq_f32(accumulator1, vld1q_f32(aPtr + 4));
+        aPtr += 8;
+    }
+    vst1q_f32(tempBuffer, vaddq_f32(accumulator0, accumulator1));
+
+    returnValue = tempBuffer[0];
+    returnValue += tempBuffer[1];
+    returnValue += tempBuffer[2];
+    returnValue += tempBuffer[3];
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        returnValue += (*aPtr++);
+    }
+    *result = returnValue;
+}
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_32f_accumulator_s32f_a_H */
@@ -0,0 +1,456 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_agc_32f
+ *
+ * \b Overview
+ *
+ * Automatic gain control that drives the mean output magnitude towards a
+ * reference level. The gain is carried across calls in \p gain.
+ *
+ * The gain is held constant over blocks of \p block_size samples:
+ *
+ * \f$ y[n] = g_b \cdot x[n] \f$ for all n in block b
+ *
+ * \f$ e_b = \sum_{n \in b} (reference - |y[n]|) \f$
+ *
+ * \f$ g_{b+1} = \min(\max(g_b + r \cdot e_b, 0), max\_gain) \f$
+ *
+ * with \f$ r = attack\_rate \f$ when \f$ e_b < 0 \f$ (the output is too loud)
+ * and \f$ r = decay\_rate \f$ otherwise.
+ *
+ * With block_size = 1 this is exactly the classic per-sample AGC loop
+ * \f$ g[n+1] = g[n] + r \cdot (reference - |y[n]|) \f$. A larger block applies
+ * the same block_size per-sample updates at once, but with the gain frozen at
+ * the value it had at the start of the block. Compared with the per-sample loop
+ * this delays the reaction by up to one block and makes the update step
+ * block_size times as large, so block_size * rate * (input level) must stay
+ * well below 1 for the loop to settle like its per-sample counterpart. In
+ * exchange the magnitude estimation and the gain multiply vectorize; the SIMD
+ * implementations are used when block_size is a multiple of their vector width
+ * and fall back to the generic implementation otherwise.
+ *
+ * A trailing partial block is processed like a full one, so splitting the input
+ * into calls of a multiple of block_size yields the same output as a single
+ * call.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_agc_32f(float* outputVector, const float* inputVector,
+ *                       float reference, float attack_rate, float decay_rate,
+ *                       float max_gain, unsigned int block_size, float* gain,
+ *                       unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The input signal.
+ * \li reference: The desired output magnitude.
+ * \li attack_rate: The adaption rate while the output is too loud.
+ * \li decay_rate: The adaption rate while the output is too quiet.
+ * \li max_gain: The upper limit of the gain.
+ * \li block_size: The number of samples the gain is held for, at least 1.
+ * \li gain: The gain applied to the first block. Updated to the gain for the
+ * next call.
+ * \li num_points: The number of samples.
+ *
+ * \b Outputs
+ * \li outputVector: The gain controlled signal.
+ *
+ * \b Example
+ * Level a quiet signal to a magnitude of about 1.
+ * \code
+ *   int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float gain = 1.f;
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = 0.1f * sinf(0.3f * ii);
+ *   }
+ *
+ *   volk_32f_agc_32f(out, in, 1.f, 1e-2f, 1e-3f, 100.f, 32, &gain, N);
+ *
+ *   printf("final gain = %f\n", gain);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_agc_32f_u_H
+#define INCLUDED_volk_32f_agc_32f_u_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+
+// Gain update after a block of n samples with the summed output magnitude.
+static inline float agc_32f_update(float gain,
+                                   float magnitude,
+                                   unsigned int n,
+                                   float reference,
+                                   float attack_rate,
+                                   float decay_rate,
+                                   float max_gain)
+{
+    const float error = (float)n * reference - magnitude;
+    gain += ((error < 0.f) ? attack_rate : decay_rate) * error;
+    gain = (gain < max_gain) ? gain : max_gain;
+    return (gain > 0.f) ? gain : 0.f;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_agc_32f_generic(float* outputVector,
+                                            const float* inputVector,
+                                            float reference,
+                                            float attack_rate,
+                                            float decay_rate,
+                                            float max_gain,
+                                            unsigned int block_size,
+                                            float* gain,
+                                            unsigned int num_points)
+{
+    float g = *gain;
+    unsigned int number = 0;
+
+    while (number < num_points) {
+        const unsigned int left = num_points - number;
+        const unsigned int n = (left < block_size) ? left : block_size;
+        float magnitude = 0.f;
+        for (unsigned int i = 0; i < n; i++) {
+            const float y = g * inputVector[number + i];
+            outputVector[number + i] = y;
+            magnitude += fabsf(y);
+        }
+        g = agc_32f_update(g, magnitude, n, reference, attack_rate, decay_rate, max_gain);
+        number += n;
+    }
+
+    *gain = g;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_agc_32f_u_sse(float* outputVector,
+                                          const float* inputVector,
+                                          float reference,
+                                          float attack_rate,
+                                          float decay_rate,
+                                          float max_gain,
+                                          unsigned int block_size,
+                                          float* gain,
+                                          unsigned int num_points)
+{
+    if (block_size % 4) {
+        volk_32f_agc_32f_generic(outputVector,
+                                 inputVector,
+                                 reference,
+                                 attack_rate,
+                                 decay_rate,
+                                 max_gain,
+                                 block_size,
+                                 gain,
+                                 num_points);
+        return;
+    }
+
+    unsigned int number = 0;
+    const unsigned int num_blocks = num_points / block_size;
+    const unsigned int quarterBlock = block_size / 4;
+
+    const float* inputPtr = inputVector;
+    float* outputPtr = outputVector;
+    float g = *gain;
+
+    const __m128 sign_mask = _mm_set1_ps(-0.f);
+    __m128 g_vec, x, y, acc;
+
+    for (; number < num_blocks; number++) {
+        g_vec = _mm_set1_ps(g);
+        acc = _mm_setzero_ps();
+        for (unsigned int i = 0; i < quarterBlock; i++) {
+            x = _mm_loadu_ps(inputPtr);
+            y = _mm_mul_ps(x, g_vec);
+            _mm_storeu_ps(outputPtr, y);
+            acc = _mm_add_ps(acc, _mm_andnot_ps(sign_mask, y));
+            inputPtr += 4;
+            outputPtr += 4;
+        }
+        acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+        acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+        g = agc_32f_update(g,
+                           _mm_cvtss_f32(acc),
+                           block_size,
+                           reference,
+                           attack_rate,
+                           decay_rate,
+                           max_gain);
+    }
+
+    *gain = g;
+    number = num_blocks * block_size;
+    volk_32f_agc_32f_generic(outputPtr,
+                             inputPtr,
+                             reference,
+                             attack_rate,
+                             decay_rate,
+                             max_gain,
+                             block_size,
+                             gain,
+                             num_points - number);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_agc_32f_u_avx(float* outputVector,
+                                          const float* inputVector,
+                                          float reference,
+                                          float attack_rate,
+                                          float decay_rate,
+                                          float max_gain,
+                                          unsigned int block_size,
+                                          float* gain,
+                                          unsigned int num_points)
+{
+    if (block_size % 8) {
+        volk_32f_agc_32f_generic(outputVector,
+                                 inputVector,
+                                 reference,
+                                 attack_rate,
+                                 decay_rate,
+                                 max_gain,
+                                 block_size,
+                                 gain,
+                                 num_points);
+        return;
+    }
+
+    unsigned int number = 0;
+    const unsigned int num_blocks = num_points / block_size;
+    const unsigned int eighthBlock = block_size / 8;
+
+    const float* inputPtr = inputVector;
+    float* outputPtr = outputVector;
+    float g = *gain;
+
+    const __m256 sign_mask = _mm256_set1_ps(-0.f);
+    __m256 g_vec, x, y, acc;
+    __m128 sum;
+
+    for (; number < num_blocks; number++) {
+        g_vec = _mm256_set1_ps(g);
+        acc = _mm256_setzero_ps();
+        for (unsigned int i = 0; i < eighthBlock; i++) {
+            x = _mm256_loadu_ps(inputPtr);
+            y = _mm256_mul_ps(x, g_vec);
+            _mm256_storeu_ps(outputPtr, y);
+            acc = _mm256_add_ps(acc, _mm256_andnot_ps(sign_mask, y));
+            inputPtr += 8;
+            outputPtr += 8;
+        }
+        sum = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+        g = agc_32f_update(g,
+                           _mm_cvtss_f32(sum),
+                           block_size,
+                           reference,
+                           attack_rate,
+                           decay_rate,
+                           max_gain);
+    }
+
+    *gain = g;
+    number = num_blocks * block_size;
+    volk_32f_agc_32f_generic(outputPtr,
+                             inputPtr,
+                             reference,
+                             attack_rate,
+                             decay_rate,
+                             max_gain,
+                             block_size,
+                             gain,
+                             num_points - number);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#endif /* INCLUDED_volk_32f_agc_32f_u_H */
+
+
+#ifndef INCLUDED_volk_32f_agc_32f_a_H
+#define INCLUDED_volk_32f_agc_32f_a_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_agc_32f_a_sse(float* outputVector,
+                                          const float* inputVector,
+                                          float reference,
+                                          float attack_rate,
+                                          float decay_rate,
+                                          float max_gain,
+                                          unsigned int block_size,
+                                          float* gain,
+                                          unsigned int num_points)
+{
+    if (block_size % 4) {
+        volk_32f_agc_32f_generic(outputVector,
+                                 inputVector,
+                                 reference,
+                                 attack_rate,
+                                 decay_rate,
+                                 max_gain,
+                                 block_size,
+                                 gain,
+                                 num_points);
+        return;
+    }
+
+    unsigned int number = 0;
+    const unsigned int num_blocks = num_points / block_size;
+    const unsigned int quarterBlock = block_size / 4;
+
+    const float* inputPtr = inputVector;
+    float* outputPtr = outputVector;
+    float g = *gain;
+
+    const __m128 sign_mask = _mm_set1_ps(-0.f);
+    __m128 g_vec, x, y, acc;
+
+    for (; number < num_blocks; number++) {
+        g_vec = _mm_set1_ps(g);
+        acc = _mm_setzero_ps();
+        for (unsigned int i = 0; i < quarterBlock; i++) {
+            x = _mm_load_ps(inputPtr);
+            y = _mm_mul_ps(x, g_vec);
+            _mm_store_ps(outputPtr, y);
+            acc = _mm_add_ps(acc, _mm_andnot_ps(sign_mask, y));
+            inputPtr += 4;
+            outputPtr += 4;
+        }
+        acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+        acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+        g = agc_32f_update(g,
+                           _mm_cvtss_f32(acc),
+                           block_size,
+                           reference,
+                           attack_rate,
+                           decay_rate,
+                           max_gain);
+    }
+
+    *gain = g;
+    number = num_blocks * block_size;
+    volk_32f_agc_32f_generic(outputPtr,
+                             inputPtr,
+                             reference,
+                             attack_rate,
+                             decay_rate,
+                             max_gain,
+                             block_size,
+                             gain,
+                             num_points - number);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_agc_32f_a_avx(float* outputVector,
+                                          const float* inputVector,
+                                          float reference,
+                                          float attack_rate,
+                                          float decay_rate,
+                                          float max_gain,
+                                          unsigned int block_size,
+                                          float* gain,
+                                          unsigned int num_points)
+{
+    if (block_size % 8) {
+        volk_32f_agc_32f_generic(outputVector,
+                                 inputVector,
+                                 reference,
+                                 attack_rate,
+                                 decay_rate,
+                                 max_gain,
+                                 block_size,
+                                 gain,
+                                 num_points);
+        return;
+    }
+
+    unsigned int number = 0;
+    const unsigned int num_blocks = num_points / block_size;
+    const unsigned int eighthBlock = block_size / 8;
+
+    const float* inputPtr = inputVector;
+    float* outputPtr = outputVector;
+    float g = *gain;
+
+    const __m256 sign_mask = _mm256_set1_ps(-0.f);
+    __m256 g_vec, x, y, acc;
+    __m128 sum;
+
+    for (; number < num_blocks; number++) {
+        g_vec = _mm256_set1_ps(g);
+        acc = _mm256_setzero_ps();
+        for (unsigned int i = 0; i < eighthBlock; i++) {
+            x = _mm256_load_ps(inputPtr);
+            y = _mm256_mul_ps(x, g_vec);
+            _mm256_store_ps(outputPtr, y);
+            acc = _mm256_add_ps(acc, _mm256_andnot_ps(sign_mask, y));
+            inputPtr += 8;
+            outputPtr += 8;
+        }
+        sum = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+        g = agc_32f_update(g,
+                           _mm_cvtss_f32(sum),
+                           block_size,
+                           reference,
+                           attack_rate,
+                           decay_rate,
+                           max_gain);
+    }
+
+    *gain = g;
+    number = num_blocks * block_size;
+    volk_32f_agc_32f_generic(outputPtr,
+                             inputPtr,
+                             reference,
+                             attack_rate,
+                             decay_rate,
+                             max_gain,
+                             block_size,
+                             gain,
+                             num_points - number);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#endif /* INCLUDED_volk_32f_agc_32f_a_H */
@@ -0,0 +1,181 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_32F_AGCPUPPET_32F_H
+#define INCLUDED_VOLK_32F_AGCPUPPET_32F_H
+
+#include <volk/volk_32f_agc_32f.h>
+
+// Both halves share the gain state but use different block sizes; the second
+// one is no multiple of eight and sends the AVX implementations to the generic
+// fall back.
+#define AGCPUPPET_REFERENCE 0.5f
+#define AGCPUPPET_ATTACK 2e-2f
+#define AGCPUPPET_DECAY 5e-3f
+#define AGCPUPPET_MAX_GAIN 4.f
+#define AGCPUPPET_GAIN 1.f
+#define AGCPUPPET_BLOCK_LO 32
+#define AGCPUPPET_BLOCK_HI 12
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_agcpuppet_32f_generic(float* outputVector,
+                                                  const float* inputVector,
+                                                  unsigned int num_points)
+{
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    float gain = AGCPUPPET_GAIN;
+    volk_32f_agc_32f_generic(outputVector,
+                             inputVector,
+                             AGCPUPPET_REFERENCE,
+                             AGCPUPPET_ATTACK,
+                             AGCPUPPET_DECAY,
+                             AGCPUPPET_MAX_GAIN,
+                             AGCPUPPET_BLOCK_LO,
+                             &gain,
+                             split);
+    volk_32f_agc_32f_generic(outputVector + split,
+                             inputVector + split,
+                             AGCPUPPET_REFERENCE,
+                             AGCPUPPET_ATTACK,
+                             AGCPUPPET_DECAY,
+                             AGCPUPPET_MAX_GAIN,
+                             AGCPUPPET_BLOCK_HI,
+                             &gain,
+                             num_points - split);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32f_agcpuppet_32f_u_sse(float* outputVector,
+                                                const float* inputVector,
+                                                unsigned int num_points)
+{
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    float gain = AGCPUPPET_GAIN;
+    volk_32f_agc_32f_u_sse(outputVector,
+                           inputVector,
+                           AGCPUPPET_REFERENCE,
+                           AGCPUPPET_ATTACK,
+                           AGCPUPPET_DECAY,
+                           AGCPUPPET_MAX_GAIN,
+                           AGCPUPPET_BLOCK_LO,
+                           &gain,
+                           split);
+    volk_32f_agc_32f_u_sse(outputVector + split,
+                           inputVector + split,
+                           AGCPUPPET_REFERENCE,
+                           AGCPUPPET_ATTACK,
+                           AGCPUPPET_DECAY,
+                           AGCPUPPET_MAX_GAIN,
+                           AGCPUPPET_BLOCK_HI,
+                           &gain,
+                           num_points - split);
+}
+
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32f_agcpuppet_32f_a_sse(float* outputVector,
+                                                const float* inputVector,
+                                                unsigned int num_points)
+{
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    float gain = AGCPUPPET_GAIN;
+    volk_32f_agc_32f_a_sse(outputVector,
+                           inputVector,
+                           AGCPUPPET_REFERENCE,
+                           AGCPUPPET_ATTACK,
+                           AGCPUPPET_DECAY,
+                           AGCPUPPET_MAX_GAIN,
+                           AGCPUPPET_BLOCK_LO,
+                           &gain,
+                           split);
+    volk_32f_agc_32f_a_sse(outputVector + split,
+                           inputVector + split,
+                           AGCPUPPET_REFERENCE,
+                           AGCPUPPET_ATTACK,
+                           AGCPUPPET_DECAY,
+                           AGCPUPPET_MAX_GAIN,
+                           AGCPUPPET_BLOCK_HI,
+                           &gain,
+                           num_points - split);
+}
+
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_agcpuppet_32f_u_avx(float* outputVector,
+                                                const float* inputVector,
+                                                unsigned int num_points)
+{
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    float gain = AGCPUPPET_GAIN;
+    volk_32f_agc_32f_u_avx(outputVector,
+                           inputVector,
+                           AGCPUPPET_REFERENCE,
+                           AGCPUPPET_ATTACK,
+                           AGCPUPPET_DECAY,
+                           AGCPUPPET_MAX_GAIN,
+                           AGCPUPPET_BLOCK_LO,
+                           &gain,
+                           split);
+    volk_32f_agc_32f_u_avx(outputVector + split,
+                           inputVector + split,
+                           AGCPUPPET_REFERENCE,
+                           AGCPUPPET_ATTACK,
+                           AGCPUPPET_DECAY,
+                           AGCPUPPET_MAX_GAIN,
+                           AGCPUPPET_BLOCK_HI,
+                           &gain,
+                           num_points - split);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_agcpuppet_32f_a_avx(float* outputVector,
+                                                const float* inputVector,
+                                                unsigned int num_points)
+{
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    float gain = AGCPUPPET_GAIN;
+    volk_32f_agc_32f_a_avx(outputVector,
+                           inputVector,
+                           AGCPUPPET_REFERENCE,
+                           AGCPUPPET_ATTACK,
+                           AGCPUPPET_DECAY,
+                           AGCPUPPET_MAX_GAIN,
+                           AGCPUPPET_BLOCK_LO,
+                           &gain,
+                           split);
+    volk_32f_agc_32f_a_avx(outputVector + split,
+                           inputVector + split,
+                           AGCPUPPET_REFERENCE,
+                           AGCPUPPET_ATTACK,
+                           AGCPUPPET_DECAY,
+                           AGCPUPPET_MAX_GAIN,
+                           AGCPUPPET_BLOCK_HI,
+                           &gain,
+                           num_points - split);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#endif /* INCLUDED_VOLK_32F_AGCPUPPET_32F_H */
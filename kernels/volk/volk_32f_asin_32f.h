@@ -486,4 +486,41 @@ volk_32f_asin_32f_u_generic(float* bVector, const float* aVector, unsigned int n
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void
+volk_32f_asin_32f_neon(float* bVector, const float* aVector, unsigned int num_points)
+{
+    float* bPtr = bVector;
+    const float* aPtr = aVector;
+
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float32x4_t fones = vdupq_n_f32(1.f);
+    const float32x4_t fzeroes = vdupq_n_f32(0.f);
+
+    float32x4_t aVal, square, root;
+    for (; number < quarterPoints; number++) {
+        aVal = vld1q_f32(aPtr);
+        // asin(x) = atan2(x, sqrt(1 - x^2))
+        square = vmulq_f32(vaddq_f32(fones, aVal), vsubq_f32(fones, aVal));
+        // square * (1 / sqrt(square)) is NaN at |x| == 1, where the root is 0
+        root = vmulq_f32(square, _vinvsqrtq_f32(square));
+        root = vbslq_f32(vceqq_f32(square, fzeroes), fzeroes, root);
+        vst1q_f32(bPtr, _vatan2q_f32(aVal, root));
+        aPtr += 4;
+        bPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *bPtr++ = asinf(*aPtr++);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_32f_asin_32f_u_H */
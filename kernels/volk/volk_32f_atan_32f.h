@@ -467,4 +467,33 @@ volk_32f_atan_32f_generic(float* bVector, const float* aVector, unsigned int num
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void
+volk_32f_atan_32f_neon(float* bVector, const float* aVector, unsigned int num_points)
+{
+    float* bPtr = bVector;
+    const float* aPtr = aVector;
+
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    float32x4_t aVal;
+    for (; number < quarterPoints; number++) {
+        aVal = vld1q_f32(aPtr);
+        vst1q_f32(bPtr, _vatanq_f32(aVal));
+        aPtr += 4;
+        bPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *bPtr++ = atanf(*aPtr++);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_32f_atan_32f_u_H */
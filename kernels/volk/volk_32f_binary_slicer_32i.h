@@ -261,5 +261,40 @@ static inline void volk_32f_binary_slicer_32i_u_avx(int* cVector,
 }
 #endif /* LV_HAVE_AVX */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_binary_slicer_32i_neon(int* cVector,
+                                                   const float* aVector,
+                                                   unsigned int num_points)
+{
+    int* cPtr = cVector;
+    const float* aPtr = aVector;
+    unsigned int number = 0;
+    unsigned int quarter_points = num_points / 4;
+
+    const float32x4_t zero_val = vdupq_n_f32(0.0f);
+    const uint32x4_t one_val = vdupq_n_u32(1);
+    float32x4_t a_val;
+    uint32x4_t res;
+
+    for (number = 0; number < quarter_points; number++) {
+        a_val = vld1q_f32(aPtr);
+        // all ones where a >= 0, reduced to 1
+        res = vandq_u32(vcgeq_f32(a_val, zero_val), one_val);
+        vst1q_s32(cPtr, vreinterpretq_s32_u32(res));
+        aPtr += 4;
+        cPtr += 4;
+    }
+
+    for (number = quarter_points * 4; number < num_points; number++) {
+        if (*aPtr++ >= 0) {
+            *cPtr++ = 1;
+        } else {
+            *cPtr++ = 0;
+        }
+    }
+}
+#endif /* LV_HAVE_NEON */
 
 #endif /* INCLUDED_volk_32f_binary_slicer_32i_H */
@@ -14,6 +14,10 @@
  *
  * Converts float values into doubles.
  *
+ * The _nt implementations write the output with non-temporal stores, which bypass
+ * the cache. They are only faster when the output is much larger than the last
+ * level cache and not read again soon, see volk_profile -L.
+ *
  * <b>Dispatcher Prototype</b>
  * \code
  * void volk_32f_convert_64f(double* outputVector, const float* inputVector, unsigned int
@@ -147,6 +151,35 @@ static inline void volk_32f_convert_64f_generic(double* outputVector,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_convert_64f_neonv8(double* outputVector,
+                                               const float* inputVector,
+                                               unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    double* outputVectorPtr = outputVector;
+    const float* inputVectorPtr = inputVector;
+
+    float32x4_t inputVal;
+    for (; number < quarterPoints; number++) {
+        inputVal = vld1q_f32(inputVectorPtr);
+        inputVectorPtr += 4;
+
+        vst1q_f64(outputVectorPtr, vcvt_f64_f32(vget_low_f32(inputVal)));
+        vst1q_f64(outputVectorPtr + 2, vcvt_high_f64_f32(inputVal));
+        outputVectorPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *outputVectorPtr++ = ((double)(*inputVectorPtr++));
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
 
 #endif /* INCLUDED_volk_32f_convert_64f_u_H */
 
@@ -190,6 +223,52 @@ static inline void volk_32f_convert_64f_a_avx(double* outputVector,
 }
 #endif /* LV_HAVE_AVX */
 
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_convert_64f_a_avx_nt(double* outputVector,
+                                                 const float* inputVector,
+                                                 unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        const __m128 inputVal = _mm_load_ps(inputVector + 4 * number);
+        _mm256_stream_pd(outputVector + 4 * number, _mm256_cvtps_pd(inputVal));
+    }
+    // order the streaming stores before any later store
+    _mm_sfence();
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        outputVector[number] = (double)(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_convert_64f_a_avx512f_nt(double* outputVector,
+                                                     const float* inputVector,
+                                                     unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        const __m256 inputVal = _mm256_load_ps(inputVector + 8 * number);
+        _mm512_stream_pd(outputVector + 8 * number, _mm512_cvtps_pd(inputVal));
+    }
+    // order the streaming stores before any later store
+    _mm_sfence();
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        outputVector[number] = (double)(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
 #ifdef LV_HAVE_SSE2
 #include <emmintrin.h>
 
@@ -248,4 +327,42 @@ static inline void volk_32f_convert_64f_a_generic(double* outputVector,
 #endif /* LV_HAVE_GENERIC */
 
 
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_32f_convert_64f_sve(double* outputVector,
+                                            const float* inputVector,
+                                            unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number += svcntd()) {
+        const svbool_t pg = svwhilelt_b64(number, num_points);
+        // loads each float into the low half of a 64 bit lane, where fcvt takes it from
+        const svfloat32_t inVal =
+            svreinterpret_f32(svld1uw_u64(pg, (const uint32_t*)inputVector + number));
+        svst1(pg, outputVector + number, svcvt_f64_x(pg, inVal));
+    }
+}
+#endif /* LV_HAVE_SVE */
+
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_32f_convert_64f_rvv(double* outputVector,
+                                            const float* inputVector,
+                                            unsigned int num_points)
+{
+    size_t n = num_points;
+    size_t vl;
+
+    // the widening conversion doubles LMUL, from 4 for the input to 8 for the output
+    for (; n > 0; n -= vl, inputVector += vl, outputVector += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        const vfloat32m4_t inVal = __riscv_vle32_v_f32m4(inputVector, vl);
+        __riscv_vse64_v_f64m8(outputVector, __riscv_vfwcvt_f_f_v_f64m8(inVal, vl), vl);
+    }
+}
+#endif /* LV_HAVE_RVV */
+
 #endif /* INCLUDED_volk_32f_convert_64f_a_H */
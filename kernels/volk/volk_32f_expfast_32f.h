@@ -301,4 +301,40 @@ static inline void volk_32f_expfast_32f_generic(float* bVector,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_expfast_32f_neon(float* bVector,
+                                             const float* aVector,
+                                             unsigned int num_points)
+{
+    float* bPtr = bVector;
+    const float* aPtr = aVector;
+
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    float32x4_t aVal, bVal;
+    int32x4_t exp;
+    const float32x4_t a = vdupq_n_f32(A / Mln2);
+    const float32x4_t b = vdupq_n_f32(B - C);
+
+    for (; number < quarterPoints; number++) {
+        aVal = vld1q_f32(aPtr);
+        exp = vcvtq_s32_f32(vmlaq_f32(b, a, aVal));
+        bVal = vreinterpretq_f32_s32(exp);
+
+        vst1q_f32(bPtr, bVal);
+        aPtr += 4;
+        bPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *bPtr++ = expf(*aPtr++);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_32f_expfast_32f_u_H */
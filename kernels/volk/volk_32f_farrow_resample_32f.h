@@ -0,0 +1,277 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_farrow_resample_32f
+ *
+ * \b Overview
+ *
+ * Fractional-delay / arbitrary-ratio resampling with a Farrow structure.
+ *
+ * Output sample i is taken at the input position
+ * \f$ t_i = phase + i \cdot phase\_inc \f$. With \f$ n = \lfloor t_i \rfloor \f$,
+ * \f$ \mu = t_i - n \f$ and \f$ L = order + 1 \f$ taps, the output is the
+ * polynomial
+ *
+ * \f$ y_i = \sum_{m=0}^{order} \mu^m \sum_{k=0}^{L-1} C_{m,k} \cdot x[n + k] \f$
+ *
+ * where the Farrow coefficient matrix \f$ C \f$ is given row by row in \p taps
+ * (row m holds the coefficients of \f$ \mu^m \f$). The polynomial order is only
+ * limited by the size of \p taps. For Lagrange interpolation the interpolated
+ * interval lies in the middle of the taps, i.e. the output carries a constant
+ * delay of \f$ \lfloor (order - 1) / 2 \rfloor \f$ input samples. A cubic
+ * Lagrange interpolator (delay 1) uses
+ *
+ * \code
+ *   C = {  0.f,       1.f,   0.f,       0.f,
+ *         -1.f / 3,  -0.5f,  1.f,      -1.f / 6,
+ *          0.5f,     -1.f,   0.5f,      0.f,
+ *         -1.f / 6,   0.5f, -0.5f,      1.f / 6 }
+ * \endcode
+ *
+ * The position is carried across calls in \p phase (relative to the first
+ * input sample) and kept in double precision so that long blocks do not lose
+ * fractional resolution. On return it points to the position of the next
+ * output. Callers streaming blocks advance their input by
+ * \f$ \lfloor phase \rfloor \f$ samples and subtract that from \p phase before
+ * the next call.
+ *
+ * The generic implementation evaluates everything in double precision and
+ * serves as the reference for the SIMD implementations, which compute eight
+ * outputs per iteration in single precision (positions stay in double).
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_farrow_resample_32f(float* outputVector, const float* inputVector,
+ *                                   const float* taps, unsigned int order,
+ *                                   double phase_inc, double* phase,
+ *                                   unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The input samples. Samples up to index
+ * \f$ \lfloor phase + (num\_points - 1) \cdot phase\_inc \rfloor + order \f$ are read.
+ * \li taps: The (order + 1) x (order + 1) Farrow coefficient matrix, row-major.
+ * \li order: The polynomial order (at least 1).
+ * \li phase_inc: The input-sample step between two outputs, i.e. the inverse of the
+ * resampling ratio. Must be positive.
+ * \li phase: The position of the first output, must not be negative. Updated to the
+ * position of the next output.
+ * \li num_points: The number of output points.
+ *
+ * \b Outputs
+ * \li outputVector: The resampled signal.
+ *
+ * \b Example
+ * Upsample a slow ramp by 4/3 with a cubic Lagrange interpolator.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   const float taps[16] = {  0.f,       1.f,   0.f,  0.f,
+ *                            -1.f / 3,  -0.5f,  1.f, -1.f / 6,
+ *                             0.5f,     -1.f,   0.5f, 0.f,
+ *                            -1.f / 6,   0.5f, -0.5f, 1.f / 6 };
+ *   double phase = 0.0;
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = (float)ii;
+ *   }
+ *
+ *   volk_32f_farrow_resample_32f(out, in, taps, 3, 0.75, &phase, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %f\n", ii, out[ii]);
+ *   }
+ *   printf("next position = %f\n", phase);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_farrow_resample_32f_u_H
+#define INCLUDED_volk_32f_farrow_resample_32f_u_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_farrow_resample_32f_generic(float* outputVector,
+                                                        const float* inputVector,
+                                                        const float* taps,
+                                                        unsigned int order,
+                                                        double phase_inc,
+                                                        double* phase,
+                                                        unsigned int num_points)
+{
+    const unsigned int num_taps = order + 1;
+    const double start = *phase;
+
+    for (unsigned int number = 0; number < num_points; number++) {
+        const double t = start + (double)number * phase_inc;
+        const double n = floor(t);
+        const double mu = t - n;
+        const float* x = inputVector + (unsigned int)n;
+
+        // Horner over the polynomial branches of the Farrow structure
+        double y = 0.0;
+        for (int m = (int)order; m >= 0; m--) {
+            const float* row = taps + m * num_taps;
+            double v = 0.0;
+            for (unsigned int k = 0; k < num_taps; k++) {
+                v += (double)row[k] * (double)x[k];
+            }
+            y = y * mu + v;
+        }
+        outputVector[number] = (float)y;
+    }
+
+    *phase = start + (double)num_points * phase_inc;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32f_farrow_resample_32f_u_avx2_fma(float* outputVector,
+                                                           const float* inputVector,
+                                                           const float* taps,
+                                                           unsigned int order,
+                                                           double phase_inc,
+                                                           double* phase,
+                                                           unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+    const unsigned int num_taps = order + 1;
+    const double start = *phase;
+
+    float* outputPtr = outputVector;
+
+    const __m256d ramp_lo = _mm256_mul_pd(_mm256_set1_pd(phase_inc),
+                                          _mm256_setr_pd(0.0, 1.0, 2.0, 3.0));
+    const __m256d ramp_hi = _mm256_mul_pd(_mm256_set1_pd(phase_inc),
+                                          _mm256_setr_pd(4.0, 5.0, 6.0, 7.0));
+
+    __m256d t, t_lo, t_hi, n_lo, n_hi;
+    __m256 mu, x, weight, y;
+    __m256i index;
+
+    for (; number < eighthPoints; number++) {
+        // positions are resolved in double, only mu drops to single precision
+        t = _mm256_set1_pd(start + (double)(number * 8) * phase_inc);
+        t_lo = _mm256_add_pd(t, ramp_lo);
+        t_hi = _mm256_add_pd(t, ramp_hi);
+        n_lo = _mm256_floor_pd(t_lo);
+        n_hi = _mm256_floor_pd(t_hi);
+        mu = _mm256_set_m128(_mm256_cvtpd_ps(_mm256_sub_pd(t_hi, n_hi)),
+                             _mm256_cvtpd_ps(_mm256_sub_pd(t_lo, n_lo)));
+        index = _mm256_set_m128i(_mm256_cvttpd_epi32(n_hi), _mm256_cvttpd_epi32(n_lo));
+
+        // y = sum_k x[n + k] * l_k(mu), with l_k evaluated by Horner's scheme
+        y = _mm256_setzero_ps();
+        for (unsigned int k = 0; k < num_taps; k++) {
+            x = _mm256_i32gather_ps(inputVector + k, index, 4);
+            weight = _mm256_set1_ps(taps[order * num_taps + k]);
+            for (int m = (int)order - 1; m >= 0; m--) {
+                weight =
+                    _mm256_fmadd_ps(weight, mu, _mm256_set1_ps(taps[m * num_taps + k]));
+            }
+            y = _mm256_fmadd_ps(x, weight, y);
+        }
+        _mm256_storeu_ps(outputPtr, y);
+        outputPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    *phase = start + (double)number * phase_inc;
+    volk_32f_farrow_resample_32f_generic(
+        outputPtr, inputVector, taps, order, phase_inc, phase, num_points - number);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#endif /* INCLUDED_volk_32f_farrow_resample_32f_u_H */
+
+
+#ifndef INCLUDED_volk_32f_farrow_resample_32f_a_H
+#define INCLUDED_volk_32f_farrow_resample_32f_a_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32f_farrow_resample_32f_a_avx2_fma(float* outputVector,
+                                                           const float* inputVector,
+                                                           const float* taps,
+                                                           unsigned int order,
+                                                           double phase_inc,
+                                                           double* phase,
+                                                           unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+    const unsigned int num_taps = order + 1;
+    const double start = *phase;
+
+    float* outputPtr = outputVector;
+
+    const __m256d ramp_lo = _mm256_mul_pd(_mm256_set1_pd(phase_inc),
+                                          _mm256_setr_pd(0.0, 1.0, 2.0, 3.0));
+    const __m256d ramp_hi = _mm256_mul_pd(_mm256_set1_pd(phase_inc),
+                                          _mm256_setr_pd(4.0, 5.0, 6.0, 7.0));
+
+    __m256d t, t_lo, t_hi, n_lo, n_hi;
+    __m256 mu, x, weight, y;
+    __m256i index;
+
+    for (; number < eighthPoints; number++) {
+        // positions are resolved in double, only mu drops to single precision
+        t = _mm256_set1_pd(start + (double)(number * 8) * phase_inc);
+        t_lo = _mm256_add_pd(t, ramp_lo);
+        t_hi = _mm256_add_pd(t, ramp_hi);
+        n_lo = _mm256_floor_pd(t_lo);
+        n_hi = _mm256_floor_pd(t_hi);
+        mu = _mm256_set_m128(_mm256_cvtpd_ps(_mm256_sub_pd(t_hi, n_hi)),
+                             _mm256_cvtpd_ps(_mm256_sub_pd(t_lo, n_lo)));
+        index = _mm256_set_m128i(_mm256_cvttpd_epi32(n_hi), _mm256_cvttpd_epi32(n_lo));
+
+        // y = sum_k x[n + k] * l_k(mu), with l_k evaluated by Horner's scheme
+        y = _mm256_setzero_ps();
+        for (unsigned int k = 0; k < num_taps; k++) {
+            x = _mm256_i32gather_ps(inputVector + k, index, 4);
+            weight = _mm256_set1_ps(taps[order * num_taps + k]);
+            for (int m = (int)order - 1; m >= 0; m--) {
+                weight =
+                    _mm256_fmadd_ps(weight, mu, _mm256_set1_ps(taps[m * num_taps + k]));
+            }
+            y = _mm256_fmadd_ps(x, weight, y);
+        }
+        _mm256_store_ps(outputPtr, y);
+        outputPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    *phase = start + (double)number * phase_inc;
+    volk_32f_farrow_resample_32f_generic(
+        outputPtr, inputVector, taps, order, phase_inc, phase, num_points - number);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#endif /* INCLUDED_volk_32f_farrow_resample_32f_a_H */
@@ -0,0 +1,181 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_32F_FARROW_RESAMPLEPUPPET_32F_H
+#define INCLUDED_VOLK_32F_FARROW_RESAMPLEPUPPET_32F_H
+
+#include <volk/volk_32f_farrow_resample_32f.h>
+
+// Half of the points go through a cubic, the other half through a quintic
+// Lagrange interpolator.
+#define FARROW_RESAMPLEPUPPET_ORDER_LO 3
+#define FARROW_RESAMPLEPUPPET_ORDER_HI 5
+#define FARROW_RESAMPLEPUPPET_PHASE 0.25
+
+// Expands the Lagrange basis polynomials over the taps -d .. order - d
+// (d = (order - 1) / 2) into a Farrow coefficient matrix.
+static inline void farrow_resamplepuppet_lagrange_taps(float* taps, unsigned int order)
+{
+    const unsigned int num_taps = order + 1;
+    const int delay = ((int)order - 1) / 2;
+    double poly[FARROW_RESAMPLEPUPPET_ORDER_HI + 1];
+
+    for (unsigned int k = 0; k < num_taps; k++) {
+        double denom = 1.0;
+        unsigned int degree = 0;
+        poly[0] = 1.0;
+        for (unsigned int j = 0; j < num_taps; j++) {
+            if (j == k) {
+                continue;
+            }
+            const double root = (double)((int)j - delay);
+            // poly *= (mu - root)
+            poly[degree + 1] = poly[degree];
+            for (unsigned int m = degree; m > 0; m--) {
+                poly[m] = poly[m - 1] - root * poly[m];
+            }
+            poly[0] = -root * poly[0];
+            degree++;
+            denom *= (double)k - (double)j;
+        }
+        for (unsigned int m = 0; m < num_taps; m++) {
+            taps[m * num_taps + k] = (float)(poly[m] / denom);
+        }
+    }
+}
+
+// Step slightly below one input sample so that every read stays within the
+// num_points input samples handed out by the QA.
+static inline double farrow_resamplepuppet_phase_inc(unsigned int num_points,
+                                                     unsigned int order)
+{
+    if (num_points <= 2 * (order + 1)) {
+        return 0.0;
+    }
+    return 0.9173 * (double)(num_points - order - 1) / (double)num_points;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_farrow_resamplepuppet_32f_generic(float* outputVector,
+                                                              const float* inputVector,
+                                                              unsigned int num_points)
+{
+    float taps_lo[(FARROW_RESAMPLEPUPPET_ORDER_LO + 1) *
+                  (FARROW_RESAMPLEPUPPET_ORDER_LO + 1)];
+    float taps_hi[(FARROW_RESAMPLEPUPPET_ORDER_HI + 1) *
+                  (FARROW_RESAMPLEPUPPET_ORDER_HI + 1)];
+    farrow_resamplepuppet_lagrange_taps(taps_lo, FARROW_RESAMPLEPUPPET_ORDER_LO);
+    farrow_resamplepuppet_lagrange_taps(taps_hi, FARROW_RESAMPLEPUPPET_ORDER_HI);
+
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    const double inc_lo = farrow_resamplepuppet_phase_inc(split,
+                                                          FARROW_RESAMPLEPUPPET_ORDER_LO);
+    const double inc_hi = farrow_resamplepuppet_phase_inc(num_points - split,
+                                                          FARROW_RESAMPLEPUPPET_ORDER_HI);
+    double phase = FARROW_RESAMPLEPUPPET_PHASE;
+    volk_32f_farrow_resample_32f_generic(outputVector,
+                                         inputVector,
+                                         taps_lo,
+                                         FARROW_RESAMPLEPUPPET_ORDER_LO,
+                                         inc_lo,
+                                         &phase,
+                                         split);
+    phase = FARROW_RESAMPLEPUPPET_PHASE;
+    volk_32f_farrow_resample_32f_generic(outputVector + split,
+                                         inputVector + split,
+                                         taps_hi,
+                                         FARROW_RESAMPLEPUPPET_ORDER_HI,
+                                         inc_hi,
+                                         &phase,
+                                         num_points - split);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32f_farrow_resamplepuppet_32f_u_avx2_fma(float* outputVector,
+                                                                 const float* inputVector,
+                                                                 unsigned int num_points)
+{
+    float taps_lo[(FARROW_RESAMPLEPUPPET_ORDER_LO + 1) *
+                  (FARROW_RESAMPLEPUPPET_ORDER_LO + 1)];
+    float taps_hi[(FARROW_RESAMPLEPUPPET_ORDER_HI + 1) *
+                  (FARROW_RESAMPLEPUPPET_ORDER_HI + 1)];
+    farrow_resamplepuppet_lagrange_taps(taps_lo, FARROW_RESAMPLEPUPPET_ORDER_LO);
+    farrow_resamplepuppet_lagrange_taps(taps_hi, FARROW_RESAMPLEPUPPET_ORDER_HI);
+
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    const double inc_lo = farrow_resamplepuppet_phase_inc(split,
+                                                          FARROW_RESAMPLEPUPPET_ORDER_LO);
+    const double inc_hi = farrow_resamplepuppet_phase_inc(num_points - split,
+                                                          FARROW_RESAMPLEPUPPET_ORDER_HI);
+    double phase = FARROW_RESAMPLEPUPPET_PHASE;
+    volk_32f_farrow_resample_32f_u_avx2_fma(outputVector,
+                                            inputVector,
+                                            taps_lo,
+                                            FARROW_RESAMPLEPUPPET_ORDER_LO,
+                                            inc_lo,
+                                            &phase,
+                                            split);
+    phase = FARROW_RESAMPLEPUPPET_PHASE;
+    volk_32f_farrow_resample_32f_u_avx2_fma(outputVector + split,
+                                            inputVector + split,
+                                            taps_hi,
+                                            FARROW_RESAMPLEPUPPET_ORDER_HI,
+                                            inc_hi,
+                                            &phase,
+                                            num_points - split);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32f_farrow_resamplepuppet_32f_a_avx2_fma(float* outputVector,
+                                                                 const float* inputVector,
+                                                                 unsigned int num_points)
+{
+    float taps_lo[(FARROW_RESAMPLEPUPPET_ORDER_LO + 1) *
+                  (FARROW_RESAMPLEPUPPET_ORDER_LO + 1)];
+    float taps_hi[(FARROW_RESAMPLEPUPPET_ORDER_HI + 1) *
+                  (FARROW_RESAMPLEPUPPET_ORDER_HI + 1)];
+    farrow_resamplepuppet_lagrange_taps(taps_lo, FARROW_RESAMPLEPUPPET_ORDER_LO);
+    farrow_resamplepuppet_lagrange_taps(taps_hi, FARROW_RESAMPLEPUPPET_ORDER_HI);
+
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    const double inc_lo = farrow_resamplepuppet_phase_inc(split,
+                                                          FARROW_RESAMPLEPUPPET_ORDER_LO);
+    const double inc_hi = farrow_resamplepuppet_phase_inc(num_points - split,
+                                                          FARROW_RESAMPLEPUPPET_ORDER_HI);
+    double phase = FARROW_RESAMPLEPUPPET_PHASE;
+    volk_32f_farrow_resample_32f_a_avx2_fma(outputVector,
+                                            inputVector,
+                                            taps_lo,
+                                            FARROW_RESAMPLEPUPPET_ORDER_LO,
+                                            inc_lo,
+                                            &phase,
+                                            split);
+    phase = FARROW_RESAMPLEPUPPET_PHASE;
+    volk_32f_farrow_resample_32f_a_avx2_fma(outputVector + split,
+                                            inputVector + split,
+                                            taps_hi,
+                                            FARROW_RESAMPLEPUPPET_ORDER_HI,
+                                            inc_hi,
+                                            &phase,
+                                            num_points - split);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#endif /* INCLUDED_VOLK_32F_FARROW_RESAMPLEPUPPET_32F_H */
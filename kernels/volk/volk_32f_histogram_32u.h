@@ -0,0 +1,328 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_histogram_32u
+ *
+ * \b Overview
+ *
+ * Sorts float samples into num_bins equally wide bins spanning
+ * [range_min, range_max). Sample x goes to bin
+ * \f$ \lfloor (x - range\_min) \cdot num\_bins / (range\_max - range\_min) \rfloor \f$;
+ * samples below or above the range are counted in the first or last bin,
+ * so clipping shows up at the edges. NaN samples end up in the first bin.
+ *
+ * The counts are added to the histogram rather than overwriting it. Clear it
+ * once and call the kernel for each block of a stream; histograms of separate
+ * streams merge by adding them bin by bin.
+ *
+ * The SIMD implementations compute the bin indices in vectors. The avx
+ * implementation then spreads consecutive samples over four sub-histograms
+ * (for up to VOLK_32F_HISTOGRAM_SUBHIST_BINS bins) to avoid store-to-load
+ * forwarding stalls on repeated bins, the avx512cd implementation resolves
+ * repeated bins within a vector with the AVX-512 conflict detection.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_histogram_32u(uint32_t* histogram, const float* inputVector,
+ *                             float range_min, float range_max,
+ *                             unsigned int num_bins, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li histogram: The num_bins bins to add the counts to.
+ * \li inputVector: The input samples.
+ * \li range_min: The lower edge of the first bin.
+ * \li range_max: The upper edge of the last bin, must be larger than range_min.
+ * \li num_bins: The number of bins, at least 1.
+ * \li num_points: The number of samples.
+ *
+ * \b Outputs
+ * \li histogram: The updated histogram.
+ *
+ * \b Example
+ * Histogram of a sine wave that overdrives the range [-1, 1).
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   uint32_t histogram[20] = { 0 };
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = 1.2f * sinf(0.01f * ii);
+ *   }
+ *
+ *   volk_32f_histogram_32u(histogram, in, -1.f, 1.f, 20, N);
+ *
+ *   for(unsigned int ii = 0; ii < 20; ++ii){
+ *       printf("bin %2u: %u\n", ii, histogram[ii]);
+ *   }
+ *
+ *   volk_free(in);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_histogram_32u_u_H
+#define INCLUDED_volk_32f_histogram_32u_u_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#define VOLK_32F_HISTOGRAM_SUBHIST_BINS 1024
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_histogram_32u_generic(uint32_t* histogram,
+                                                  const float* inputVector,
+                                                  float range_min,
+                                                  float range_max,
+                                                  unsigned int num_bins,
+                                                  unsigned int num_points)
+{
+    const float scale = (float)num_bins / (range_max - range_min);
+    const float last = (float)(num_bins - 1);
+
+    for (unsigned int number = 0; number < num_points; number++) {
+        float pos = (inputVector[number] - range_min) * scale;
+        // clamp, ordered like max/min instructions so NaN ends up in the first bin
+        pos = (pos > 0.f) ? pos : 0.f;
+        pos = (pos < last) ? pos : last;
+        histogram[(unsigned int)pos]++;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_histogram_32u_u_avx(uint32_t* histogram,
+                                                const float* inputVector,
+                                                float range_min,
+                                                float range_max,
+                                                unsigned int num_bins,
+                                                unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+    const float* inputPtr = inputVector;
+
+    const float scale = (float)num_bins / (range_max - range_min);
+    const __m256 offset = _mm256_set1_ps(range_min);
+    const __m256 scale_vec = _mm256_set1_ps(scale);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 last = _mm256_set1_ps((float)(num_bins - 1));
+
+    __VOLK_ATTR_ALIGNED(32) int32_t index[8];
+    __m256 pos;
+
+    if (num_bins <= VOLK_32F_HISTOGRAM_SUBHIST_BINS) {
+        // consecutive samples never increment the same counter
+        uint32_t sub[4][VOLK_32F_HISTOGRAM_SUBHIST_BINS];
+        for (unsigned int i = 0; i < 4; i++) {
+            memset(sub[i], 0, num_bins * sizeof(uint32_t));
+        }
+
+        for (; number < eighthPoints; number++) {
+            pos = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(inputPtr), offset),
+                                scale_vec);
+            pos = _mm256_min_ps(_mm256_max_ps(pos, zero), last);
+            _mm256_store_si256((__m256i*)index, _mm256_cvttps_epi32(pos));
+            sub[0][index[0]]++;
+            sub[1][index[1]]++;
+            sub[2][index[2]]++;
+            sub[3][index[3]]++;
+            sub[0][index[4]]++;
+            sub[1][index[5]]++;
+            sub[2][index[6]]++;
+            sub[3][index[7]]++;
+            inputPtr += 8;
+        }
+
+        for (unsigned int i = 0; i < num_bins; i++) {
+            histogram[i] += sub[0][i] + sub[1][i] + sub[2][i] + sub[3][i];
+        }
+    } else {
+        for (; number < eighthPoints; number++) {
+            pos = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(inputPtr), offset),
+                                scale_vec);
+            pos = _mm256_min_ps(_mm256_max_ps(pos, zero), last);
+            _mm256_store_si256((__m256i*)index, _mm256_cvttps_epi32(pos));
+            for (unsigned int i = 0; i < 8; i++) {
+                histogram[index[i]]++;
+            }
+            inputPtr += 8;
+        }
+    }
+
+    number = eighthPoints * 8;
+    volk_32f_histogram_32u_generic(
+        histogram, inputPtr, range_min, range_max, num_bins, num_points - number);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512CD
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_histogram_32u_u_avx512cd(uint32_t* histogram,
+                                                     const float* inputVector,
+                                                     float range_min,
+                                                     float range_max,
+                                                     unsigned int num_bins,
+                                                     unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* inputPtr = inputVector;
+
+    const float scale = (float)num_bins / (range_max - range_min);
+    const __m512 offset = _mm512_set1_ps(range_min);
+    const __m512 scale_vec = _mm512_set1_ps(scale);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 last = _mm512_set1_ps((float)(num_bins - 1));
+
+    __m512 pos;
+
+    for (; number < sixteenthPoints; number++) {
+        pos = _mm512_mul_ps(_mm512_sub_ps(_mm512_loadu_ps(inputPtr), offset), scale_vec);
+        pos = _mm512_min_ps(_mm512_max_ps(pos, zero), last);
+        _mm512_histogram_increment_avx512cd(histogram, _mm512_cvttps_epi32(pos));
+        inputPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    volk_32f_histogram_32u_generic(
+        histogram, inputPtr, range_min, range_max, num_bins, num_points - number);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512CD */
+
+#endif /* INCLUDED_volk_32f_histogram_32u_u_H */
+
+
+#ifndef INCLUDED_volk_32f_histogram_32u_a_H
+#define INCLUDED_volk_32f_histogram_32u_a_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_histogram_32u_a_avx(uint32_t* histogram,
+                                                const float* inputVector,
+                                                float range_min,
+                                                float range_max,
+                                                unsigned int num_bins,
+                                                unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+    const float* inputPtr = inputVector;
+
+    const float scale = (float)num_bins / (range_max - range_min);
+    const __m256 offset = _mm256_set1_ps(range_min);
+    const __m256 scale_vec = _mm256_set1_ps(scale);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 last = _mm256_set1_ps((float)(num_bins - 1));
+
+    __VOLK_ATTR_ALIGNED(32) int32_t index[8];
+    __m256 pos;
+
+    if (num_bins <= VOLK_32F_HISTOGRAM_SUBHIST_BINS) {
+        // consecutive samples never increment the same counter
+        uint32_t sub[4][VOLK_32F_HISTOGRAM_SUBHIST_BINS];
+        for (unsigned int i = 0; i < 4; i++) {
+            memset(sub[i], 0, num_bins * sizeof(uint32_t));
+        }
+
+        for (; number < eighthPoints; number++) {
+            pos = _mm256_mul_ps(_mm256_sub_ps(_mm256_load_ps(inputPtr), offset),
+                                scale_vec);
+            pos = _mm256_min_ps(_mm256_max_ps(pos, zero), last);
+            _mm256_store_si256((__m256i*)index, _mm256_cvttps_epi32(pos));
+            sub[0][index[0]]++;
+            sub[1][index[1]]++;
+            sub[2][index[2]]++;
+            sub[3][index[3]]++;
+            sub[0][index[4]]++;
+            sub[1][index[5]]++;
+            sub[2][index[6]]++;
+            sub[3][index[7]]++;
+            inputPtr += 8;
+        }
+
+        for (unsigned int i = 0; i < num_bins; i++) {
+            histogram[i] += sub[0][i] + sub[1][i] + sub[2][i] + sub[3][i];
+        }
+    } else {
+        for (; number < eighthPoints; number++) {
+            pos = _mm256_mul_ps(_mm256_sub_ps(_mm256_load_ps(inputPtr), offset),
+                                scale_vec);
+            pos = _mm256_min_ps(_mm256_max_ps(pos, zero), last);
+            _mm256_store_si256((__m256i*)index, _mm256_cvttps_epi32(pos));
+            for (unsigned int i = 0; i < 8; i++) {
+                histogram[index[i]]++;
+            }
+            inputPtr += 8;
+        }
+    }
+
+    number = eighthPoints * 8;
+    volk_32f_histogram_32u_generic(
+        histogram, inputPtr, range_min, range_max, num_bins, num_points - number);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512CD
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_histogram_32u_a_avx512cd(uint32_t* histogram,
+                                                     const float* inputVector,
+                                                     float range_min,
+                                                     float range_max,
+                                                     unsigned int num_bins,
+                                                     unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* inputPtr = inputVector;
+
+    const float scale = (float)num_bins / (range_max - range_min);
+    const __m512 offset = _mm512_set1_ps(range_min);
+    const __m512 scale_vec = _mm512_set1_ps(scale);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 last = _mm512_set1_ps((float)(num_bins - 1));
+
+    __m512 pos;
+
+    for (; number < sixteenthPoints; number++) {
+        pos = _mm512_mul_ps(_mm512_sub_ps(_mm512_load_ps(inputPtr), offset), scale_vec);
+        pos = _mm512_min_ps(_mm512_max_ps(pos, zero), last);
+        _mm512_histogram_increment_avx512cd(histogram, _mm512_cvttps_epi32(pos));
+        inputPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    volk_32f_histogram_32u_generic(
+        histogram, inputPtr, range_min, range_max, num_bins, num_points - number);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512CD */
+
+#endif /* INCLUDED_volk_32f_histogram_32u_a_H */
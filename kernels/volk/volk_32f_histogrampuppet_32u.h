@@ -0,0 +1,162 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_32F_HISTOGRAMPUPPET_32U_H
+#define INCLUDED_VOLK_32F_HISTOGRAMPUPPET_32U_H
+
+#include <string.h>
+#include <volk/volk_32f_histogram_32u.h>
+
+// The first half of the input goes into HISTOGRAMPUPPET_BINS_LO bins over a range
+// narrower than the data, the second half into HISTOGRAMPUPPET_BINS_HI bins,
+// which is too many for sub-histograms. The remaining outputs are zero.
+#define HISTOGRAMPUPPET_BINS_LO 100
+#define HISTOGRAMPUPPET_BINS_HI 3000
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_histogrampuppet_32u_generic(uint32_t* outputVector,
+                                                        const float* inputVector,
+                                                        unsigned int num_points)
+{
+    memset(outputVector, 0, num_points * sizeof(uint32_t));
+    if (num_points < HISTOGRAMPUPPET_BINS_LO + HISTOGRAMPUPPET_BINS_HI) {
+        return;
+    }
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    volk_32f_histogram_32u_generic(outputVector,
+                                   inputVector,
+                                   -0.9f,
+                                   0.9f,
+                                   HISTOGRAMPUPPET_BINS_LO,
+                                   split);
+    volk_32f_histogram_32u_generic(outputVector + HISTOGRAMPUPPET_BINS_LO,
+                                   inputVector + split,
+                                   -1.f,
+                                   1.f,
+                                   HISTOGRAMPUPPET_BINS_HI,
+                                   num_points - split);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_histogrampuppet_32u_u_avx(uint32_t* outputVector,
+                                                      const float* inputVector,
+                                                      unsigned int num_points)
+{
+    memset(outputVector, 0, num_points * sizeof(uint32_t));
+    if (num_points < HISTOGRAMPUPPET_BINS_LO + HISTOGRAMPUPPET_BINS_HI) {
+        return;
+    }
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    volk_32f_histogram_32u_u_avx(outputVector,
+                                 inputVector,
+                                 -0.9f,
+                                 0.9f,
+                                 HISTOGRAMPUPPET_BINS_LO,
+                                 split);
+    volk_32f_histogram_32u_u_avx(outputVector + HISTOGRAMPUPPET_BINS_LO,
+                                 inputVector + split,
+                                 -1.f,
+                                 1.f,
+                                 HISTOGRAMPUPPET_BINS_HI,
+                                 num_points - split);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_histogrampuppet_32u_a_avx(uint32_t* outputVector,
+                                                      const float* inputVector,
+                                                      unsigned int num_points)
+{
+    memset(outputVector, 0, num_points * sizeof(uint32_t));
+    if (num_points < HISTOGRAMPUPPET_BINS_LO + HISTOGRAMPUPPET_BINS_HI) {
+        return;
+    }
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    volk_32f_histogram_32u_a_avx(outputVector,
+                                 inputVector,
+                                 -0.9f,
+                                 0.9f,
+                                 HISTOGRAMPUPPET_BINS_LO,
+                                 split);
+    volk_32f_histogram_32u_a_avx(outputVector + HISTOGRAMPUPPET_BINS_LO,
+                                 inputVector + split,
+                                 -1.f,
+                                 1.f,
+                                 HISTOGRAMPUPPET_BINS_HI,
+                                 num_points - split);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512CD
+
+static inline void volk_32f_histogrampuppet_32u_u_avx512cd(uint32_t* outputVector,
+                                                           const float* inputVector,
+                                                           unsigned int num_points)
+{
+    memset(outputVector, 0, num_points * sizeof(uint32_t));
+    if (num_points < HISTOGRAMPUPPET_BINS_LO + HISTOGRAMPUPPET_BINS_HI) {
+        return;
+    }
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    volk_32f_histogram_32u_u_avx512cd(outputVector,
+                                      inputVector,
+                                      -0.9f,
+                                      0.9f,
+                                      HISTOGRAMPUPPET_BINS_LO,
+                                      split);
+    volk_32f_histogram_32u_u_avx512cd(outputVector + HISTOGRAMPUPPET_BINS_LO,
+                                      inputVector + split,
+                                      -1.f,
+                                      1.f,
+                                      HISTOGRAMPUPPET_BINS_HI,
+                                      num_points - split);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512CD */
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512CD
+
+static inline void volk_32f_histogrampuppet_32u_a_avx512cd(uint32_t* outputVector,
+                                                           const float* inputVector,
+                                                           unsigned int num_points)
+{
+    memset(outputVector, 0, num_points * sizeof(uint32_t));
+    if (num_points < HISTOGRAMPUPPET_BINS_LO + HISTOGRAMPUPPET_BINS_HI) {
+        return;
+    }
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    volk_32f_histogram_32u_a_avx512cd(outputVector,
+                                      inputVector,
+                                      -0.9f,
+                                      0.9f,
+                                      HISTOGRAMPUPPET_BINS_LO,
+                                      split);
+    volk_32f_histogram_32u_a_avx512cd(outputVector + HISTOGRAMPUPPET_BINS_LO,
+                                      inputVector + split,
+                                      -1.f,
+                                      1.f,
+                                      HISTOGRAMPUPPET_BINS_HI,
+                                      num_points - split);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512CD */
+
+#endif /* INCLUDED_VOLK_32F_HISTOGRAMPUPPET_32U_H */
@@ -346,4 +346,68 @@ volk_32f_index_min_16u_u_avx(uint16_t* target, const float* source, uint32_t num
 
 #endif /*LV_HAVE_AVX*/
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void
+volk_32f_index_min_16u_neon(uint16_t* target, const float* source, uint32_t num_points)
+{
+    num_points = (num_points > USHRT_MAX) ? USHRT_MAX : num_points;
+
+    uint32_t number = 0;
+    const uint32_t quarterPoints = num_points / 4;
+
+    const float* inputPtr = source;
+
+    const uint32x4_t indexIncrementValues = vdupq_n_u32(4);
+    __VOLK_ATTR_ALIGNED(16) uint32_t currentIndexesBuffer[4] = { 0, 1, 2, 3 };
+    uint32x4_t currentIndexes = vld1q_u32(currentIndexesBuffer);
+
+    float min = source[0];
+    uint32_t index = 0;
+    float32x4_t minValues = vdupq_n_f32(min);
+    uint32x4_t minValuesIndex = vdupq_n_u32(0);
+    uint32x4_t compareResults;
+    float32x4_t currentValues;
+
+    __VOLK_ATTR_ALIGNED(16) float minValuesBuffer[4];
+    __VOLK_ATTR_ALIGNED(16) uint32_t minIndexesBuffer[4];
+
+    for (; number < quarterPoints; number++) {
+        currentValues = vld1q_f32(inputPtr);
+        inputPtr += 4;
+
+        compareResults = vcltq_f32(currentValues, minValues);
+
+        minValuesIndex = vbslq_u32(compareResults, currentIndexes, minValuesIndex);
+        minValues = vbslq_f32(compareResults, currentValues, minValues);
+        currentIndexes = vaddq_u32(currentIndexes, indexIncrementValues);
+    }
+
+    // Calculate the smallest value from the remaining 4 points
+    vst1q_f32(minValuesBuffer, minValues);
+    vst1q_u32(minIndexesBuffer, minValuesIndex);
+
+    for (number = 0; number < 4; number++) {
+        if (minValuesBuffer[number] < min) {
+            index = minIndexesBuffer[number];
+            min = minValuesBuffer[number];
+        } else if (minValuesBuffer[number] == min) {
+            if (index > minIndexesBuffer[number])
+                index = minIndexesBuffer[number];
+        }
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        if (source[number] < min) {
+            index = number;
+            min = source[number];
+        }
+    }
+    target[0] = (uint16_t)index;
+}
+
+#endif /*LV_HAVE_NEON*/
+
 #endif /*INCLUDED_volk_32f_index_min_16u_u_H*/
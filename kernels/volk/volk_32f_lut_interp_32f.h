@@ -0,0 +1,329 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_lut_interp_32f
+ *
+ * \b Overview
+ *
+ * Maps each input value onto a lookup table with piecewise-linear
+ * interpolation between neighbouring entries. The interval
+ * [range_min, range_max] is spread evenly over the table, so that
+ * range_min hits table[0] and range_max hits table[table_size - 1].
+ * Inputs outside of the interval are clamped to the first/last table entry.
+ *
+ * Expressed as a formula, with \f$ N \f$ = table_size:
+ * \f$ p = clamp((x - min) \cdot \frac{N - 1}{max - min}, 0, N - 1) \f$,
+ * \f$ i = min(\lfloor p \rfloor, N - 2) \f$,
+ * \f$ y = t_i + (p - i) \cdot (t_{i+1} - t_i) \f$
+ *
+ * This is the typical building block of AM/AM or AM/PM predistortion curves
+ * and other memoryless non-linear mappings. For tables of up to 16 entries
+ * the AVX2 implementations keep the whole table in registers and use
+ * permutes instead of memory lookups; larger tables are gathered.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_lut_interp_32f(float* outputVector, const float* inputVector,
+ *                              const float* table, unsigned int table_size,
+ *                              float range_min, float range_max,
+ *                              unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The input vector of floats.
+ * \li table: The lookup table. Its alignment is not relevant.
+ * \li table_size: The number of table entries, must be at least 2.
+ * \li range_min: The input value mapped onto the first table entry.
+ * \li range_max: The input value mapped onto the last table entry, must be
+ * larger than range_min.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The interpolated table values.
+ *
+ * \b Example
+ * Evaluate a coarse 9-entry table of x^2 on [-1, 1].
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float table[9];
+ *
+ *   for(unsigned int ii = 0; ii < 9; ++ii){
+ *       float x = -1.f + 0.25f * (float)ii;
+ *       table[ii] = x * x;
+ *   }
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = 2.f * ((float)ii / (float)N) - 1.f;
+ *   }
+ *
+ *   volk_32f_lut_interp_32f(out, in, table, 9, -1.f, 1.f, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %f\n", ii, out[ii]);
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_lut_interp_32f_u_H
+#define INCLUDED_volk_32f_lut_interp_32f_u_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_lut_interp_32f_generic(float* outputVector,
+                                                   const float* inputVector,
+                                                   const float* table,
+                                                   unsigned int table_size,
+                                                   float range_min,
+                                                   float range_max,
+                                                   unsigned int num_points)
+{
+    const float scale = (float)(table_size - 1) / (range_max - range_min);
+    const float last = (float)(table_size - 1);
+    const int max_index = (int)table_size - 2;
+
+    for (unsigned int number = 0; number < num_points; number++) {
+        float pos = (inputVector[number] - range_min) * scale;
+        // clamp, ordered like max/min instructions so NaN ends up on the first entry
+        pos = (pos > 0.f) ? pos : 0.f;
+        pos = (pos < last) ? pos : last;
+        int index = (int)pos;
+        index = (index < max_index) ? index : max_index;
+        const float frac = pos - (float)index;
+        outputVector[number] = table[index] + frac * (table[index + 1] - table[index]);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_lut_interp_32f_u_avx2(float* outputVector,
+                                                  const float* inputVector,
+                                                  const float* table,
+                                                  unsigned int table_size,
+                                                  float range_min,
+                                                  float range_max,
+                                                  unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    const float* inputPtr = inputVector;
+    float* outputPtr = outputVector;
+
+    const float scale = (float)(table_size - 1) / (range_max - range_min);
+    const __m256 offset = _mm256_set1_ps(range_min);
+    const __m256 scale_vec = _mm256_set1_ps(scale);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 last = _mm256_set1_ps((float)(table_size - 1));
+    const __m256i max_index = _mm256_set1_epi32((int)table_size - 2);
+
+    __m256 x, pos, frac, base, slope, result;
+    __m256i index;
+
+    if (table_size <= 16) {
+        // Small table: keep entries and slopes in two registers each and
+        // select with permutes instead of going through memory.
+        __VOLK_ATTR_ALIGNED(32) float base_buf[16] = { 0.f };
+        __VOLK_ATTR_ALIGNED(32) float slope_buf[16] = { 0.f };
+        for (unsigned int i = 0; i < table_size - 1; i++) {
+            base_buf[i] = table[i];
+            slope_buf[i] = table[i + 1] - table[i];
+        }
+        base_buf[table_size - 1] = table[table_size - 1];
+
+        const __m256 base_lo = _mm256_load_ps(base_buf);
+        const __m256 base_hi = _mm256_load_ps(base_buf + 8);
+        const __m256 slope_lo = _mm256_load_ps(slope_buf);
+        const __m256 slope_hi = _mm256_load_ps(slope_buf + 8);
+        const __m256i seven = _mm256_set1_epi32(7);
+        __m256 use_hi;
+
+        for (; number < eighthPoints; number++) {
+            x = _mm256_loadu_ps(inputPtr);
+            pos = _mm256_mul_ps(_mm256_sub_ps(x, offset), scale_vec);
+            pos = _mm256_max_ps(pos, zero);
+            pos = _mm256_min_ps(pos, last);
+            index = _mm256_min_epi32(_mm256_cvttps_epi32(pos), max_index);
+            frac = _mm256_sub_ps(pos, _mm256_cvtepi32_ps(index));
+
+            // permutevar8x32 only looks at the lower 3 bits of the index
+            use_hi = _mm256_castsi256_ps(_mm256_cmpgt_epi32(index, seven));
+            base = _mm256_blendv_ps(_mm256_permutevar8x32_ps(base_lo, index),
+                                    _mm256_permutevar8x32_ps(base_hi, index),
+                                    use_hi);
+            slope = _mm256_blendv_ps(_mm256_permutevar8x32_ps(slope_lo, index),
+                                     _mm256_permutevar8x32_ps(slope_hi, index),
+                                     use_hi);
+
+            result = _mm256_add_ps(base, _mm256_mul_ps(frac, slope));
+            _mm256_storeu_ps(outputPtr, result);
+
+            inputPtr += 8;
+            outputPtr += 8;
+        }
+    } else {
+        __m256 next;
+        for (; number < eighthPoints; number++) {
+            x = _mm256_loadu_ps(inputPtr);
+            pos = _mm256_mul_ps(_mm256_sub_ps(x, offset), scale_vec);
+            pos = _mm256_max_ps(pos, zero);
+            pos = _mm256_min_ps(pos, last);
+            index = _mm256_min_epi32(_mm256_cvttps_epi32(pos), max_index);
+            frac = _mm256_sub_ps(pos, _mm256_cvtepi32_ps(index));
+
+            base = _mm256_i32gather_ps(table, index, 4);
+            next = _mm256_i32gather_ps(table + 1, index, 4);
+            slope = _mm256_sub_ps(next, base);
+
+            result = _mm256_add_ps(base, _mm256_mul_ps(frac, slope));
+            _mm256_storeu_ps(outputPtr, result);
+
+            inputPtr += 8;
+            outputPtr += 8;
+        }
+    }
+
+    number = eighthPoints * 8;
+    volk_32f_lut_interp_32f_generic(outputPtr,
+                                    inputPtr,
+                                    table,
+                                    table_size,
+                                    range_min,
+                                    range_max,
+                                    num_points - number);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#endif /* INCLUDED_volk_32f_lut_interp_32f_u_H */
+
+
+#ifndef INCLUDED_volk_32f_lut_interp_32f_a_H
+#define INCLUDED_volk_32f_lut_interp_32f_a_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_lut_interp_32f_a_avx2(float* outputVector,
+                                                  const float* inputVector,
+                                                  const float* table,
+                                                  unsigned int table_size,
+                                                  float range_min,
+                                                  float range_max,
+                                                  unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    const float* inputPtr = inputVector;
+    float* outputPtr = outputVector;
+
+    const float scale = (float)(table_size - 1) / (range_max - range_min);
+    const __m256 offset = _mm256_set1_ps(range_min);
+    const __m256 scale_vec = _mm256_set1_ps(scale);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 last = _mm256_set1_ps((float)(table_size - 1));
+    const __m256i max_index = _mm256_set1_epi32((int)table_size - 2);
+
+    __m256 x, pos, frac, base, slope, result;
+    __m256i index;
+
+    if (table_size <= 16) {
+        // Small table: keep entries and slopes in two registers each and
+        // select with permutes instead of going through memory.
+        __VOLK_ATTR_ALIGNED(32) float base_buf[16] = { 0.f };
+        __VOLK_ATTR_ALIGNED(32) float slope_buf[16] = { 0.f };
+        for (unsigned int i = 0; i < table_size - 1; i++) {
+            base_buf[i] = table[i];
+            slope_buf[i] = table[i + 1] - table[i];
+        }
+        base_buf[table_size - 1] = table[table_size - 1];
+
+        const __m256 base_lo = _mm256_load_ps(base_buf);
+        const __m256 base_hi = _mm256_load_ps(base_buf + 8);
+        const __m256 slope_lo = _mm256_load_ps(slope_buf);
+        const __m256 slope_hi = _mm256_load_ps(slope_buf + 8);
+        const __m256i seven = _mm256_set1_epi32(7);
+        __m256 use_hi;
+
+        for (; number < eighthPoints; number++) {
+            x = _mm256_load_ps(inputPtr);
+            pos = _mm256_mul_ps(_mm256_sub_ps(x, offset), scale_vec);
+            pos = _mm256_max_ps(pos, zero);
+            pos = _mm256_min_ps(pos, last);
+            index = _mm256_min_epi32(_mm256_cvttps_epi32(pos), max_index);
+            frac = _mm256_sub_ps(pos, _mm256_cvtepi32_ps(index));
+
+            // permutevar8x32 only looks at the lower 3 bits of the index
+            use_hi = _mm256_castsi256_ps(_mm256_cmpgt_epi32(index, seven));
+            base = _mm256_blendv_ps(_mm256_permutevar8x32_ps(base_lo, index),
+                                    _mm256_permutevar8x32_ps(base_hi, index),
+                                    use_hi);
+            slope = _mm256_blendv_ps(_mm256_permutevar8x32_ps(slope_lo, index),
+                                     _mm256_permutevar8x32_ps(slope_hi, index),
+                                     use_hi);
+
+            result = _mm256_add_ps(base, _mm256_mul_ps(frac, slope));
+            _mm256_store_ps(outputPtr, result);
+
+            inputPtr += 8;
+            outputPtr += 8;
+        }
+    } else {
+        __m256 next;
+        for (; number < eighthPoints; number++) {
+            x = _mm256_load_ps(inputPtr);
+            pos = _mm256_mul_ps(_mm256_sub_ps(x, offset), scale_vec);
+            pos = _mm256_max_ps(pos, zero);
+            pos = _mm256_min_ps(pos, last);
+            index = _mm256_min_epi32(_mm256_cvttps_epi32(pos), max_index);
+            frac = _mm256_sub_ps(pos, _mm256_cvtepi32_ps(index));
+
+            base = _mm256_i32gather_ps(table, index, 4);
+            next = _mm256_i32gather_ps(table + 1, index, 4);
+            slope = _mm256_sub_ps(next, base);
+
+            result = _mm256_add_ps(base, _mm256_mul_ps(frac, slope));
+            _mm256_store_ps(outputPtr, result);
+
+            inputPtr += 8;
+            outputPtr += 8;
+        }
+    }
+
+    number = eighthPoints * 8;
+    volk_32f_lut_interp_32f_generic(outputPtr,
+                                    inputPtr,
+                                    table,
+                                    table_size,
+                                    range_min,
+                                    range_max,
+                                    num_points - number);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#endif /* INCLUDED_volk_32f_lut_interp_32f_a_H */
@@ -0,0 +1,268 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_lut_interp_32fc
+ *
+ * \b Overview
+ *
+ * Maps each real input value onto a complex lookup table with
+ * piecewise-linear interpolation between neighbouring entries. This is the
+ * complex gain table variant of \ref volk_32f_lut_interp_32f, e.g. for joint
+ * AM/AM and AM/PM predistortion indexed by the input magnitude.
+ *
+ * The interval [range_min, range_max] is spread evenly over the table, so that
+ * range_min hits table[0] and range_max hits table[table_size - 1]. Inputs
+ * outside of the interval are clamped to the first/last table entry.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_lut_interp_32fc(lv_32fc_t* outputVector, const float* inputVector,
+ *                               const lv_32fc_t* table, unsigned int table_size,
+ *                               float range_min, float range_max,
+ *                               unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The input vector of floats.
+ * \li table: The complex lookup table. Its alignment is not relevant.
+ * \li table_size: The number of table entries, must be at least 2.
+ * \li range_min: The input value mapped onto the first table entry.
+ * \li range_max: The input value mapped onto the last table entry, must be
+ * larger than range_min.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The interpolated complex table values.
+ *
+ * \b Example
+ * Look up a gain with a phase that rotates by 90 degrees over the input range.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t table[5];
+ *
+ *   for(unsigned int ii = 0; ii < 5; ++ii){
+ *       float phase = (float)ii * 0.125f * (float)M_PI;
+ *       table[ii] = lv_cmake(cosf(phase), sinf(phase));
+ *   }
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = (float)ii / (float)N;
+ *   }
+ *
+ *   volk_32f_lut_interp_32fc(out, in, table, 5, 0.f, 1.f, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.2f %+1.2fj\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_lut_interp_32fc_u_H
+#define INCLUDED_volk_32f_lut_interp_32fc_u_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_lut_interp_32fc_generic(lv_32fc_t* outputVector,
+                                                    const float* inputVector,
+                                                    const lv_32fc_t* table,
+                                                    unsigned int table_size,
+                                                    float range_min,
+                                                    float range_max,
+                                                    unsigned int num_points)
+{
+    const float scale = (float)(table_size - 1) / (range_max - range_min);
+    const float last = (float)(table_size - 1);
+    const int max_index = (int)table_size - 2;
+    const float* tablePtr = (const float*)table;
+
+    for (unsigned int number = 0; number < num_points; number++) {
+        float pos = (inputVector[number] - range_min) * scale;
+        // clamp, ordered like max/min instructions so NaN ends up on the first entry
+        pos = (pos > 0.f) ? pos : 0.f;
+        pos = (pos < last) ? pos : last;
+        int index = (int)pos;
+        index = (index < max_index) ? index : max_index;
+        const float frac = pos - (float)index;
+        const float* entry = tablePtr + 2 * index;
+        const float re = entry[0] + frac * (entry[2] - entry[0]);
+        const float im = entry[1] + frac * (entry[3] - entry[1]);
+        outputVector[number] = lv_cmake(re, im);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_lut_interp_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                   const float* inputVector,
+                                                   const lv_32fc_t* table,
+                                                   unsigned int table_size,
+                                                   float range_min,
+                                                   float range_max,
+                                                   unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    const float* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    // each complex entry is gathered as one 64-bit element
+    const double* tablePtr = (const double*)table;
+
+    const float scale = (float)(table_size - 1) / (range_max - range_min);
+    const __m256 offset = _mm256_set1_ps(range_min);
+    const __m256 scale_vec = _mm256_set1_ps(scale);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 last = _mm256_set1_ps((float)(table_size - 1));
+    const __m256i max_index = _mm256_set1_epi32((int)table_size - 2);
+    // duplicate each fraction onto the real and imaginary slot
+    const __m256i dup_lo = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    const __m256i dup_hi = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+
+    __m256 x, pos, frac, frac0, frac1, base0, base1, next0, next1, result0, result1;
+    __m256i index;
+    __m128i index0, index1;
+
+    for (; number < eighthPoints; number++) {
+        x = _mm256_loadu_ps(inputPtr);
+        pos = _mm256_mul_ps(_mm256_sub_ps(x, offset), scale_vec);
+        pos = _mm256_max_ps(pos, zero);
+        pos = _mm256_min_ps(pos, last);
+        index = _mm256_min_epi32(_mm256_cvttps_epi32(pos), max_index);
+        frac = _mm256_sub_ps(pos, _mm256_cvtepi32_ps(index));
+
+        index0 = _mm256_castsi256_si128(index);
+        index1 = _mm256_extracti128_si256(index, 1);
+        base0 = _mm256_castpd_ps(_mm256_i32gather_pd(tablePtr, index0, 8));
+        base1 = _mm256_castpd_ps(_mm256_i32gather_pd(tablePtr, index1, 8));
+        next0 = _mm256_castpd_ps(_mm256_i32gather_pd(tablePtr + 1, index0, 8));
+        next1 = _mm256_castpd_ps(_mm256_i32gather_pd(tablePtr + 1, index1, 8));
+
+        frac0 = _mm256_permutevar8x32_ps(frac, dup_lo);
+        frac1 = _mm256_permutevar8x32_ps(frac, dup_hi);
+
+        result0 = _mm256_add_ps(base0, _mm256_mul_ps(frac0, _mm256_sub_ps(next0, base0)));
+        result1 = _mm256_add_ps(base1, _mm256_mul_ps(frac1, _mm256_sub_ps(next1, base1)));
+        _mm256_storeu_ps(outputPtr, result0);
+        _mm256_storeu_ps(outputPtr + 8, result1);
+
+        inputPtr += 8;
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    volk_32f_lut_interp_32fc_generic((lv_32fc_t*)outputPtr,
+                                     inputPtr,
+                                     table,
+                                     table_size,
+                                     range_min,
+                                     range_max,
+                                     num_points - number);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#endif /* INCLUDED_volk_32f_lut_interp_32fc_u_H */
+
+
+#ifndef INCLUDED_volk_32f_lut_interp_32fc_a_H
+#define INCLUDED_volk_32f_lut_interp_32fc_a_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_lut_interp_32fc_a_avx2(lv_32fc_t* outputVector,
+                                                   const float* inputVector,
+                                                   const lv_32fc_t* table,
+                                                   unsigned int table_size,
+                                                   float range_min,
+                                                   float range_max,
+                                                   unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    const float* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    // each complex entry is gathered as one 64-bit element
+    const double* tablePtr = (const double*)table;
+
+    const float scale = (float)(table_size - 1) / (range_max - range_min);
+    const __m256 offset = _mm256_set1_ps(range_min);
+    const __m256 scale_vec = _mm256_set1_ps(scale);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 last = _mm256_set1_ps((float)(table_size - 1));
+    const __m256i max_index = _mm256_set1_epi32((int)table_size - 2);
+    // duplicate each fraction onto the real and imaginary slot
+    const __m256i dup_lo = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    const __m256i dup_hi = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+
+    __m256 x, pos, frac, frac0, frac1, base0, base1, next0, next1, result0, result1;
+    __m256i index;
+    __m128i index0, index1;
+
+    for (; number < eighthPoints; number++) {
+        x = _mm256_load_ps(inputPtr);
+        pos = _mm256_mul_ps(_mm256_sub_ps(x, offset), scale_vec);
+        pos = _mm256_max_ps(pos, zero);
+        pos = _mm256_min_ps(pos, last);
+        index = _mm256_min_epi32(_mm256_cvttps_epi32(pos), max_index);
+        frac = _mm256_sub_ps(pos, _mm256_cvtepi32_ps(index));
+
+        index0 = _mm256_castsi256_si128(index);
+        index1 = _mm256_extracti128_si256(index, 1);
+        base0 = _mm256_castpd_ps(_mm256_i32gather_pd(tablePtr, index0, 8));
+        base1 = _mm256_castpd_ps(_mm256_i32gather_pd(tablePtr, index1, 8));
+        next0 = _mm256_castpd_ps(_mm256_i32gather_pd(tablePtr + 1, index0, 8));
+        next1 = _mm256_castpd_ps(_mm256_i32gather_pd(tablePtr + 1, index1, 8));
+
+        frac0 = _mm256_permutevar8x32_ps(frac, dup_lo);
+        frac1 = _mm256_permutevar8x32_ps(frac, dup_hi);
+
+        result0 = _mm256_add_ps(base0, _mm256_mul_ps(frac0, _mm256_sub_ps(next0, base0)));
+        result1 = _mm256_add_ps(base1, _mm256_mul_ps(frac1, _mm256_sub_ps(next1, base1)));
+        _mm256_store_ps(outputPtr, result0);
+        _mm256_store_ps(outputPtr + 8, result1);
+
+        inputPtr += 8;
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    volk_32f_lut_interp_32fc_generic((lv_32fc_t*)outputPtr,
+                                     inputPtr,
+                                     table,
+                                     table_size,
+                                     range_min,
+                                     range_max,
+                                     num_points - number);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#endif /* INCLUDED_volk_32f_lut_interp_32fc_a_H */
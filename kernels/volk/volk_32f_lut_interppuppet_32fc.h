@@ -0,0 +1,124 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_32F_LUT_INTERPPUPPET_32FC_H
+#define INCLUDED_VOLK_32F_LUT_INTERPPUPPET_32FC_H
+
+#include <math.h>
+#include <volk/volk_32f_lut_interp_32fc.h>
+
+// Half of the points go through a table small enough for the register
+// based AVX2 path, the other half through the gather path.
+#define LUT_INTERPPUPPET_32FC_SMALL 13
+#define LUT_INTERPPUPPET_32FC_LARGE 97
+
+static inline void lut_interppuppet_32fc_tables(lv_32fc_t* small_table,
+                                                lv_32fc_t* large_table)
+{
+    for (unsigned int i = 0; i < LUT_INTERPPUPPET_32FC_SMALL; i++) {
+        const float u = (float)i / (float)(LUT_INTERPPUPPET_32FC_SMALL - 1);
+        small_table[i] = lv_cmake(1.f + u * u, 0.5f - u);
+    }
+    for (unsigned int i = 0; i < LUT_INTERPPUPPET_32FC_LARGE; i++) {
+        large_table[i] = lv_cmake(1.5f + 0.5f * cosf(0.3f * (float)i),
+                            0.5f * sinf(0.3f * (float)i));
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_lut_interppuppet_32fc_generic(lv_32fc_t* outputVector,
+                                                          const float* inputVector,
+                                                          unsigned int num_points)
+{
+    lv_32fc_t small_table[LUT_INTERPPUPPET_32FC_SMALL];
+    lv_32fc_t large_table[LUT_INTERPPUPPET_32FC_LARGE];
+    lut_interppuppet_32fc_tables(small_table, large_table);
+
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    volk_32f_lut_interp_32fc_generic(outputVector,
+                                     inputVector,
+                                     small_table,
+                                     LUT_INTERPPUPPET_32FC_SMALL,
+                                     -0.8f,
+                                     0.8f,
+                                     split);
+    volk_32f_lut_interp_32fc_generic(outputVector + split,
+                                     inputVector + split,
+                                     large_table,
+                                     LUT_INTERPPUPPET_32FC_LARGE,
+                                     -0.8f,
+                                     0.8f,
+                                     num_points - split);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32f_lut_interppuppet_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                         const float* inputVector,
+                                                         unsigned int num_points)
+{
+    lv_32fc_t small_table[LUT_INTERPPUPPET_32FC_SMALL];
+    lv_32fc_t large_table[LUT_INTERPPUPPET_32FC_LARGE];
+    lut_interppuppet_32fc_tables(small_table, large_table);
+
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    volk_32f_lut_interp_32fc_u_avx2(outputVector,
+                                    inputVector,
+                                    small_table,
+                                    LUT_INTERPPUPPET_32FC_SMALL,
+                                    -0.8f,
+                                    0.8f,
+                                    split);
+    volk_32f_lut_interp_32fc_u_avx2(outputVector + split,
+                                    inputVector + split,
+                                    large_table,
+                                    LUT_INTERPPUPPET_32FC_LARGE,
+                                    -0.8f,
+                                    0.8f,
+                                    num_points - split);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32f_lut_interppuppet_32fc_a_avx2(lv_32fc_t* outputVector,
+                                                         const float* inputVector,
+                                                         unsigned int num_points)
+{
+    lv_32fc_t small_table[LUT_INTERPPUPPET_32FC_SMALL];
+    lv_32fc_t large_table[LUT_INTERPPUPPET_32FC_LARGE];
+    lut_interppuppet_32fc_tables(small_table, large_table);
+
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    volk_32f_lut_interp_32fc_a_avx2(outputVector,
+                                    inputVector,
+                                    small_table,
+                                    LUT_INTERPPUPPET_32FC_SMALL,
+                                    -0.8f,
+                                    0.8f,
+                                    split);
+    volk_32f_lut_interp_32fc_a_avx2(outputVector + split,
+                                    inputVector + split,
+                                    large_table,
+                                    LUT_INTERPPUPPET_32FC_LARGE,
+                                    -0.8f,
+                                    0.8f,
+                                    num_points - split);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#endif /* INCLUDED_VOLK_32F_LUT_INTERPPUPPET_32FC_H */
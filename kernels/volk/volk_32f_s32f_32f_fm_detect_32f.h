@@ -334,5 +334,61 @@ static inline void volk_32f_s32f_32f_fm_detect_32f_u_avx(float* outputVector,
 }
 #endif /* LV_HAVE_AVX */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_32f_fm_detect_32f_neon(float* outputVector,
+                                                        const float* inputVector,
+                                                        const float bound,
+                                                        float* saveValue,
+                                                        unsigned int num_points)
+{
+    if (num_points < 1) {
+        return;
+    }
+    unsigned int number = 0;
+    const unsigned int quarterPoints = (num_points - 1) / 4;
+
+    float* outPtr = outputVector;
+    const float* inPtr = inputVector;
+    const float32x4_t upperBound = vdupq_n_f32(bound);
+    const float32x4_t lowerBound = vdupq_n_f32(-bound);
+    const float32x4_t boundAdjust = vdupq_n_f32(2 * bound);
+    float32x4_t next3old1, next4, diff;
+
+    // Do the first 1 by hand since we're going in from the saveValue:
+    *outPtr = *inPtr - *saveValue;
+    if (*outPtr > bound)
+        *outPtr -= 2 * bound;
+    if (*outPtr < -bound)
+        *outPtr += 2 * bound;
+    inPtr++;
+    outPtr++;
+
+    for (; number < quarterPoints; number++) {
+        next3old1 = vld1q_f32(inPtr - 1);
+        next4 = vld1q_f32(inPtr);
+        diff = vsubq_f32(next4, next3old1);
+        // Make sure we're in the bounding interval, in the order of the generic
+        diff = vbslq_f32(vcgtq_f32(diff, upperBound), vsubq_f32(diff, boundAdjust), diff);
+        diff = vbslq_f32(vcltq_f32(diff, lowerBound), vaddq_f32(diff, boundAdjust), diff);
+        vst1q_f32(outPtr, diff);
+        inPtr += 4;
+        outPtr += 4;
+    }
+
+    for (number = 1 + quarterPoints * 4; number < num_points; number++) {
+        *outPtr = *(inPtr) - *(inPtr - 1);
+        if (*outPtr > bound)
+            *outPtr -= 2 * bound;
+        if (*outPtr < -bound)
+            *outPtr += 2 * bound;
+        inPtr++;
+        outPtr++;
+    }
+
+    *saveValue = inputVector[num_points - 1];
+}
+#endif /* LV_HAVE_NEON */
 
 #endif /* INCLUDED_volk_32f_s32f_32f_fm_detect_32f_u_H */
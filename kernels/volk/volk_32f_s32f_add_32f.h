@@ -110,6 +110,7 @@ static inline void volk_32f_s32f_add_32f_u_sse(float* cVector,
 
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_32f_s32f_add_32f_u_avx(float* cVector,
                                                const float* aVector,
@@ -136,8 +137,11 @@ static inline void volk_32f_s32f_add_32f_u_avx(float* cVector,
         cPtr += 8;
     }
 
-    number = eighthPoints * 8;
-    volk_32f_s32f_add_32f_generic(cPtr, aPtr, scalar, num_points - number);
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __m256i mask = _mm256_tail_mask_ps(num_points - eighthPoints * 8);
+    aVal = _mm256_maskload_ps(aPtr, mask);
+    cVal = _mm256_add_ps(aVal, bVal);
+    _mm256_maskstore_ps(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX */
 
@@ -212,6 +216,7 @@ static inline void volk_32f_s32f_add_32f_a_sse(float* cVector,
 
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_32f_s32f_add_32f_a_avx(float* cVector,
                                                const float* aVector,
@@ -237,8 +242,11 @@ static inline void volk_32f_s32f_add_32f_a_avx(float* cVector,
         cPtr += 8;
     }
 
-    number = eighthPoints * 8;
-    volk_32f_s32f_add_32f_generic(cPtr, aPtr, scalar, num_points - number);
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __m256i mask = _mm256_tail_mask_ps(num_points - eighthPoints * 8);
+    aVal = _mm256_maskload_ps(aPtr, mask);
+    cVal = _mm256_add_ps(aVal, bVal);
+    _mm256_maskstore_ps(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX */
 
@@ -458,4 +458,101 @@ volk_32f_s32f_calc_spectral_noise_floor_32f_u_avx(float* noiseFloorAmplitude,
     *noiseFloorAmplitude = localNoiseFloorAmplitude;
 }
 #endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void
+volk_32f_s32f_calc_spectral_noise_floor_32f_neon(float* noiseFloorAmplitude,
+                                                 const float* realDataPoints,
+                                                 const float spectralExclusionValue,
+                                                 const unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float* dataPointsPtr = realDataPoints;
+
+    float32x4_t dataPointsVal;
+    float32x4_t avgPointsVal = vdupq_n_f32(0.0f);
+    // Calculate the sum (for mean) for all points
+    for (; number < quarterPoints; number++) {
+        dataPointsVal = vld1q_f32(dataPointsPtr);
+        dataPointsPtr += 4;
+        avgPointsVal = vaddq_f32(avgPointsVal, dataPointsVal);
+    }
+
+    float sumMean = 0.0;
+    sumMean += vgetq_lane_f32(avgPointsVal, 0);
+    sumMean += vgetq_lane_f32(avgPointsVal, 1);
+    sumMean += vgetq_lane_f32(avgPointsVal, 2);
+    sumMean += vgetq_lane_f32(avgPointsVal, 3);
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        sumMean += realDataPoints[number];
+    }
+
+    // calculate the spectral mean
+    // +20 because for the comparison below we only want to throw out bins
+    // that are significantly higher (and would, thus, affect the mean more
+    const float meanAmplitude = (sumMean / ((float)num_points)) + spectralExclusionValue;
+
+    dataPointsPtr = realDataPoints; // Reset the dataPointsPtr
+    const float32x4_t vMeanAmplitudeVector = vdupq_n_f32(meanAmplitude);
+    uint32x4_t vValidBinCount = vdupq_n_u32(0);
+    uint32x4_t compareMask;
+    avgPointsVal = vdupq_n_f32(0.0f);
+    number = 0;
+    // Calculate the sum (for mean) for any points which do NOT exceed the mean amplitude
+    for (; number < quarterPoints; number++) {
+        dataPointsVal = vld1q_f32(dataPointsPtr);
+        dataPointsPtr += 4;
+
+        // Identify which items do not exceed the mean amplitude
+        compareMask = vcleq_f32(dataPointsVal, vMeanAmplitudeVector);
+
+        // Mask off the items that exceed the mean amplitude and add the avg Points that
+        // do not exceed the mean amplitude
+        avgPointsVal = vaddq_f32(
+            avgPointsVal,
+            vreinterpretq_f32_u32(
+                vandq_u32(compareMask, vreinterpretq_u32_f32(dataPointsVal))));
+
+        // Count the number of bins which do not exceed the mean amplitude, the mask
+        // is all ones, i.e. -1, for them
+        vValidBinCount = vsubq_u32(vValidBinCount, compareMask);
+    }
+
+    sumMean = 0.0;
+    sumMean += vgetq_lane_f32(avgPointsVal, 0);
+    sumMean += vgetq_lane_f32(avgPointsVal, 1);
+    sumMean += vgetq_lane_f32(avgPointsVal, 2);
+    sumMean += vgetq_lane_f32(avgPointsVal, 3);
+
+    unsigned int validBinCount = vgetq_lane_u32(vValidBinCount, 0) +
+                                 vgetq_lane_u32(vValidBinCount, 1) +
+                                 vgetq_lane_u32(vValidBinCount, 2) +
+                                 vgetq_lane_u32(vValidBinCount, 3);
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        if (realDataPoints[number] <= meanAmplitude) {
+            sumMean += realDataPoints[number];
+            validBinCount += 1;
+        }
+    }
+
+    float localNoiseFloorAmplitude = 0;
+    if (validBinCount > 0) {
+        localNoiseFloorAmplitude = sumMean / ((float)validBinCount);
+    } else {
+        localNoiseFloorAmplitude =
+            meanAmplitude; // For the odd case that all the amplitudes are equal...
+    }
+
+    *noiseFloorAmplitude = localNoiseFloorAmplitude;
+}
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_32f_s32f_calc_spectral_noise_floor_32f_u_H */
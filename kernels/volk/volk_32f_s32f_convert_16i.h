@@ -314,6 +314,57 @@ static inline void volk_32f_s32f_convert_16i_generic(int16_t* outputVector,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_convert_16i_neonv8(int16_t* outputVector,
+                                                    const float* inputVector,
+                                                    const float scalar,
+                                                    unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    const float* inputVectorPtr = inputVector;
+    int16_t* outputVectorPtr = outputVector;
+
+    float min_val = SHRT_MIN;
+    float max_val = SHRT_MAX;
+    float r;
+
+    const float32x4_t vmin_val = vdupq_n_f32(min_val);
+    const float32x4_t vmax_val = vdupq_n_f32(max_val);
+    float32x4_t inputVal1, inputVal2;
+    int32x4_t intInputVal1, intInputVal2;
+
+    for (; number < eighthPoints; number++) {
+        inputVal1 = vmulq_n_f32(vld1q_f32(inputVectorPtr), scalar);
+        inputVal2 = vmulq_n_f32(vld1q_f32(inputVectorPtr + 4), scalar);
+        inputVectorPtr += 8;
+
+        inputVal1 = vmaxq_f32(vminq_f32(inputVal1, vmax_val), vmin_val);
+        inputVal2 = vmaxq_f32(vminq_f32(inputVal2, vmax_val), vmin_val);
+
+        // vrndiq takes into account the current rounding mode (as does rintf)
+        intInputVal1 = vcvtq_s32_f32(vrndiq_f32(inputVal1));
+        intInputVal2 = vcvtq_s32_f32(vrndiq_f32(inputVal2));
+
+        vst1q_s16(outputVectorPtr,
+                  vcombine_s16(vqmovn_s32(intInputVal1), vqmovn_s32(intInputVal2)));
+        outputVectorPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        r = *inputVectorPtr++ * scalar;
+        if (r > max_val)
+            r = max_val;
+        else if (r < min_val)
+            r = min_val;
+        *outputVectorPtr++ = (int16_t)rintf(r);
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
 
 #endif /* INCLUDED_volk_32f_s32f_convert_16i_u_H */
 #ifndef INCLUDED_volk_32f_s32f_convert_16i_a_H
@@ -578,4 +629,25 @@ static inline void volk_32f_s32f_convert_16i_a_generic(int16_t* outputVector,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_32f_s32f_convert_16i_rvv(int16_t* outputVector,
+                                                 const float* inputVector,
+                                                 const float scalar,
+                                                 unsigned int num_points)
+{
+    size_t n = num_points;
+    size_t vl;
+
+    for (; n > 0; n -= vl, inputVector += vl, outputVector += vl) {
+        vl = __riscv_vsetvl_e32m8(n);
+        const vfloat32m8_t inVal =
+            __riscv_vfmul_vf_f32m8(__riscv_vle32_v_f32m8(inputVector, vl), scalar, vl);
+        // rounds to nearest even and saturates, like the clamp and rintf() of generic
+        __riscv_vse16_v_i16m4(outputVector, __riscv_vfncvt_x_f_w_i16m4(inVal, vl), vl);
+    }
+}
+#endif /* LV_HAVE_RVV */
+
 #endif /* INCLUDED_volk_32f_s32f_convert_16i_a_H */
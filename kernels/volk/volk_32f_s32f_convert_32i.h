@@ -242,6 +242,47 @@ static inline void volk_32f_s32f_convert_32i_generic(int32_t* outputVector,
 
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_convert_32i_neonv8(int32_t* outputVector,
+                                                    const float* inputVector,
+                                                    const float scalar,
+                                                    unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float* inputVectorPtr = inputVector;
+    int32_t* outputVectorPtr = outputVector;
+    const float min_val = (float)INT_MIN;
+    const float max_val = (float)INT_MAX;
+
+    float32x4_t inputVal;
+    for (; number < quarterPoints; number++) {
+        inputVal = vmulq_n_f32(vld1q_f32(inputVectorPtr), scalar);
+        inputVectorPtr += 4;
+
+        // the conversion saturates to INT_MIN and INT_MAX, vrndiq takes
+        // into account the current rounding mode (as does rintf)
+        vst1q_s32(outputVectorPtr, vcvtq_s32_f32(vrndiq_f32(inputVal)));
+        outputVectorPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        const float r = *inputVectorPtr++ * scalar;
+        int s;
+        if (r >= max_val)
+            s = INT_MAX;
+        else if (r < min_val)
+            s = INT_MIN;
+        else
+            s = (int32_t)rintf(r);
+        *outputVectorPtr++ = s;
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
 
 #endif /* INCLUDED_volk_32f_s32f_convert_32i_u_H */
 #ifndef INCLUDED_volk_32f_s32f_convert_32i_a_H
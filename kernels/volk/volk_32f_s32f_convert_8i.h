@@ -284,6 +284,51 @@ static inline void volk_32f_s32f_convert_8i_generic(int8_t* outputVector,
 
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_convert_8i_neonv8(int8_t* outputVector,
+                                                   const float* inputVector,
+                                                   const float scalar,
+                                                   unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* inputVectorPtr = inputVector;
+    int8_t* outputVectorPtr = outputVector;
+
+    const float32x4_t vmin_val = vdupq_n_f32(INT8_MIN);
+    const float32x4_t vmax_val = vdupq_n_f32(INT8_MAX);
+    float32x4_t inputVal[4];
+    int16x8_t intInputVal1, intInputVal2;
+    int i;
+
+    for (; number < sixteenthPoints; number++) {
+        for (i = 0; i < 4; i++) {
+            inputVal[i] = vmulq_n_f32(vld1q_f32(inputVectorPtr + 4 * i), scalar);
+            inputVal[i] = vmaxq_f32(vminq_f32(inputVal[i], vmax_val), vmin_val);
+            // vrndiq takes into account the current rounding mode (as does rintf)
+            inputVal[i] = vrndiq_f32(inputVal[i]);
+        }
+        inputVectorPtr += 16;
+
+        intInputVal1 = vcombine_s16(vqmovn_s32(vcvtq_s32_f32(inputVal[0])),
+                                    vqmovn_s32(vcvtq_s32_f32(inputVal[1])));
+        intInputVal2 = vcombine_s16(vqmovn_s32(vcvtq_s32_f32(inputVal[2])),
+                                    vqmovn_s32(vcvtq_s32_f32(inputVal[3])));
+
+        vst1q_s8(outputVectorPtr,
+                 vcombine_s8(vqmovn_s16(intInputVal1), vqmovn_s16(intInputVal2)));
+        outputVectorPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        volk_32f_s32f_convert_8i_single(&outputVector[number], *inputVectorPtr++ * scalar);
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
 
 #endif /* INCLUDED_volk_32f_s32f_convert_8i_u_H */
 #ifndef INCLUDED_volk_32f_s32f_convert_8i_a_H
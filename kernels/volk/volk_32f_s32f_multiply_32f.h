@@ -95,6 +95,7 @@ static inline void volk_32f_s32f_multiply_32f_u_sse(float* cVector,
 
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_32f_s32f_multiply_32f_u_avx(float* cVector,
                                                     const float* aVector,
@@ -121,10 +122,11 @@ static inline void volk_32f_s32f_multiply_32f_u_avx(float* cVector,
         cPtr += 8;
     }
 
-    number = eighthPoints * 8;
-    for (; number < num_points; number++) {
-        *cPtr++ = (*aPtr++) * scalar;
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __m256i mask = _mm256_tail_mask_ps(num_points - eighthPoints * 8);
+    aVal = _mm256_maskload_ps(aPtr, mask);
+    cVal = _mm256_mul_ps(aVal, bVal);
+    _mm256_maskstore_ps(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX */
 
@@ -191,6 +193,7 @@ static inline void volk_32f_s32f_multiply_32f_a_sse(float* cVector,
 
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_32f_s32f_multiply_32f_a_avx(float* cVector,
                                                     const float* aVector,
@@ -216,10 +219,11 @@ static inline void volk_32f_s32f_multiply_32f_a_avx(float* cVector,
         cPtr += 8;
     }
 
-    number = eighthPoints * 8;
-    for (; number < num_points; number++) {
-        *cPtr++ = (*aPtr++) * scalar;
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __m256i mask = _mm256_tail_mask_ps(num_points - eighthPoints * 8);
+    aVal = _mm256_maskload_ps(aPtr, mask);
+    cVal = _mm256_mul_ps(aVal, bVal);
+    _mm256_maskstore_ps(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX */
 
@@ -288,4 +292,42 @@ static inline void volk_32f_s32f_multiply_32f_u_orc(float* cVector,
 
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_32f_s32f_multiply_32f_sve(float* cVector,
+                                                  const float* aVector,
+                                                  const float scalar,
+                                                  unsigned int num_points)
+{
+    unsigned int number;
+
+    // predicated on the points left, the last iteration covers the tail
+    for (number = 0; number < num_points; number += svcntw()) {
+        const svbool_t pg = svwhilelt_b32(number, num_points);
+        const svfloat32_t aVal = svld1(pg, aVector + number);
+        svst1(pg, cVector + number, svmul_x(pg, aVal, scalar));
+    }
+}
+#endif /* LV_HAVE_SVE */
+
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_32f_s32f_multiply_32f_rvv(float* cVector,
+                                                  const float* aVector,
+                                                  const float scalar,
+                                                  unsigned int num_points)
+{
+    size_t n = num_points;
+    size_t vl;
+
+    for (; n > 0; n -= vl, aVector += vl, cVector += vl) {
+        vl = __riscv_vsetvl_e32m8(n);
+        const vfloat32m8_t aVal = __riscv_vle32_v_f32m8(aVector, vl);
+        __riscv_vse32_v_f32m8(cVector, __riscv_vfmul_vf_f32m8(aVal, scalar, vl), vl);
+    }
+}
+#endif /* LV_HAVE_RVV */
+
 #endif /* INCLUDED_volk_32f_s32f_multiply_32f_a_H */
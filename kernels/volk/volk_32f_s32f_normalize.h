@@ -203,5 +203,31 @@ static inline void volk_32f_s32f_normalize_u_avx(float* vecBuffer,
 }
 #endif /* LV_HAVE_AVX */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_normalize_neon(float* vecBuffer,
+                                                const float scalar,
+                                                unsigned int num_points)
+{
+    unsigned int number = 0;
+    float* inputPtr = vecBuffer;
+    const float invScalar = 1.0 / scalar;
+    const unsigned int quarterPoints = num_points / 4;
+
+    float32x4_t inputVal;
+    for (; number < quarterPoints; number++) {
+        inputVal = vld1q_f32(inputPtr);
+        vst1q_f32(inputPtr, vmulq_n_f32(inputVal, invScalar));
+        inputPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *inputPtr *= invScalar;
+        inputPtr++;
+    }
+}
+#endif /* LV_HAVE_NEON */
 
 #endif /* INCLUDED_volk_32f_s32f_normalize_u_H */
@@ -184,7 +184,7 @@ static inline void volk_32f_s32f_s32f_mod_range_32f_u_sse2(float* outputVector,
     float* outPtr = outputVector;
     const size_t quarter_points = num_points / 4;
     for (size_t counter = 0; counter < quarter_points; counter++) {
-        input = _mm_load_ps(inPtr);
+        input = _mm_loadu_ps(inPtr);
         // calculate mask: input < lower, input > upper
         is_smaller = _mm_cmplt_ps(input, lower);
         is_bigger = _mm_cmpgt_ps(input, upper);
@@ -204,7 +204,7 @@ static inline void volk_32f_s32f_s32f_mod_range_32f_u_sse2(float* outputVector,
         // scale by distance, sign
         excess = _mm_mul_ps(_mm_mul_ps(excess, adj), distance);
         output = _mm_add_ps(input, excess);
-        _mm_store_ps(outPtr, output);
+        _mm_storeu_ps(outPtr, output);
         inPtr += 4;
         outPtr += 4;
     }
@@ -281,7 +281,7 @@ static inline void volk_32f_s32f_s32f_mod_range_32f_u_sse(float* outputVector,
     float* outPtr = outputVector;
     const size_t quarter_points = num_points / 4;
     for (size_t counter = 0; counter < quarter_points; counter++) {
-        input = _mm_load_ps(inPtr);
+        input = _mm_loadu_ps(inPtr);
         // calculate mask: input < lower, input > upper
         is_smaller = _mm_cmplt_ps(input, lower);
         is_bigger = _mm_cmpgt_ps(input, upper);
@@ -302,7 +302,7 @@ static inline void volk_32f_s32f_s32f_mod_range_32f_u_sse(float* outputVector,
         // scale by distance, sign
         excess = _mm_mul_ps(_mm_mul_ps(excess, adj), distance);
         output = _mm_add_ps(input, excess);
-        _mm_store_ps(outPtr, output);
+        _mm_storeu_ps(outPtr, output);
         inPtr += 4;
         outPtr += 4;
     }
@@ -359,5 +359,51 @@ static inline void volk_32f_s32f_s32f_mod_range_32f_a_sse(float* outputVector,
 }
 #endif /* LV_HAVE_SSE */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_s32f_mod_range_32f_neonv8(float* outputVector,
+                                                            const float* inputVector,
+                                                            const float lower_bound,
+                                                            const float upper_bound,
+                                                            unsigned int num_points)
+{
+    const float32x4_t lower = vdupq_n_f32(lower_bound);
+    const float32x4_t upper = vdupq_n_f32(upper_bound);
+    const float32x4_t distance = vsubq_f32(upper, lower);
+    const float32x4_t ones = vdupq_n_f32(1.0f);
+    float32x4_t input, output;
+    uint32x4_t is_smaller, is_bigger;
+    float32x4_t excess, adj;
+
+    const float* inPtr = inputVector;
+    float* outPtr = outputVector;
+    const size_t quarter_points = num_points / 4;
+    for (size_t counter = 0; counter < quarter_points; counter++) {
+        input = vld1q_f32(inPtr);
+        // calculate mask: input < lower, input > upper
+        is_smaller = vcltq_f32(input, lower);
+        is_bigger = vcgtq_f32(input, upper);
+        // how far we are out-of-bound, zero when inside
+        excess = vbslq_f32(is_smaller, vsubq_f32(lower, input), vdupq_n_f32(0.0f));
+        excess = vbslq_f32(is_bigger, vsubq_f32(input, upper), excess);
+        // how many do we have to add? (int(excess/distance+1)*distance)
+        // a true division, so that the count matches the generic at the boundaries
+        excess = vrndq_f32(vdivq_f32(excess, distance));
+        excess = vaddq_f32(excess, ones);
+        // get the sign right
+        adj = vbslq_f32(is_smaller, ones, vdupq_n_f32(0.0f));
+        adj = vbslq_f32(is_bigger, vdupq_n_f32(-1.0f), adj);
+        // scale by distance, sign
+        output = vmlaq_f32(input, vmulq_f32(excess, adj), distance);
+        vst1q_f32(outPtr, output);
+        inPtr += 4;
+        outPtr += 4;
+    }
+
+    volk_32f_s32f_s32f_mod_range_32f_generic(
+        outPtr, inPtr, lower_bound, upper_bound, num_points - quarter_points * 4);
+}
+#endif /* LV_HAVE_NEONV8 */
 
 #endif /* INCLUDED_VOLK_32F_S32F_S32F_MOD_RANGE_32F_A_H */
@@ -344,4 +344,50 @@ static inline void volk_32f_s32f_stddev_32f_u_avx(float* stddev,
 }
 #endif /* LV_HAVE_AVX */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_stddev_32f_neon(float* stddev,
+                                                 const float* inputBuffer,
+                                                 const float mean,
+                                                 unsigned int num_points)
+{
+    float returnValue = 0;
+    if (num_points > 0) {
+        unsigned int number = 0;
+        const unsigned int eighthPoints = num_points / 8;
+
+        const float* aPtr = inputBuffer;
+        __VOLK_ATTR_ALIGNED(16) float squareBuffer[4];
+
+        float32x4_t squareAccumulator0 = vdupq_n_f32(0.0f);
+        float32x4_t squareAccumulator1 = vdupq_n_f32(0.0f);
+        float32x4_t aVal0, aVal1;
+        for (; number < eighthPoints; number++) {
+            aVal0 = vld1q_f32(aPtr);
+            aVal1 = vld1q_f32(aPtr + 4);
+            squareAccumulator0 = vmlaq_f32(squareAccumulator0, aVal0, aVal0);
+            squareAccumulator1 = vmlaq_f32(squareAccumulator1, aVal1, aVal1);
+            aPtr += 8;
+        }
+        vst1q_f32(squareBuffer, vaddq_f32(squareAccumulator0, squareAccumulator1));
+
+        returnValue = squareBuffer[0];
+        returnValue += squareBuffer[1];
+        returnValue += squareBuffer[2];
+        returnValue += squareBuffer[3];
+
+        number = eighthPoints * 8;
+        for (; number < num_points; number++) {
+            returnValue += (*aPtr) * (*aPtr);
+            aPtr++;
+        }
+        returnValue /= num_points;
+        returnValue -= (mean * mean);
+        returnValue = sqrtf(returnValue);
+    }
+    *stddev = returnValue;
+}
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_32f_s32f_stddev_32f_u_H */
@@ -94,8 +94,8 @@ volk_32f_tanh_32f_series(float* cVector, const float* aVector, unsigned int num_
             float a = (*aPtr) * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
             float b = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f));
             *cPtr++ = a / b;
-            aPtr++;
         }
+        aPtr++;
     }
 }
 
@@ -412,4 +412,51 @@ volk_32f_tanh_32f_u_avx_fma(float* cVector, const float* aVector, unsigned int n
 }
 #endif /* LV_HAVE_AVX && LV_HAVE_FMA */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void
+volk_32f_tanh_32f_neon(float* cVector, const float* aVector, unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    float* cPtr = cVector;
+    const float* aPtr = aVector;
+
+    float32x4_t aVal, cVal, x2, a, b;
+    const float32x4_t const1 = vdupq_n_f32(135135.0f);
+    const float32x4_t const2 = vdupq_n_f32(17325.0f);
+    const float32x4_t const3 = vdupq_n_f32(378.0f);
+    const float32x4_t const4 = vdupq_n_f32(62370.0f);
+    const float32x4_t const5 = vdupq_n_f32(3150.0f);
+    const float32x4_t const6 = vdupq_n_f32(28.0f);
+    const float32x4_t limit = vdupq_n_f32(4.97f);
+    const float32x4_t fones = vdupq_n_f32(1.0f);
+    const uint32x4_t sign_mask = vdupq_n_u32(0x80000000);
+    for (; number < quarterPoints; number++) {
+
+        aVal = vld1q_f32(aPtr);
+        x2 = vmulq_f32(aVal, aVal);
+        a = vmulq_f32(
+            aVal, vmlaq_f32(const1, x2, vmlaq_f32(const2, x2, vaddq_f32(const3, x2))));
+        b = vmlaq_f32(const1, x2, vmlaq_f32(const4, x2, vmlaq_f32(const5, x2, const6)));
+
+        cVal = vmulq_f32(a, _vinvq_f32(b));
+        // saturate to +-1 outside the range of the approximation, like the series
+        cVal =
+            vbslq_f32(vcagtq_f32(aVal, limit), vbslq_f32(sign_mask, aVal, fones), cVal);
+
+        vst1q_f32(cPtr, cVal);
+
+        aPtr += 4;
+        cPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    volk_32f_tanh_32f_series(cPtr, aPtr, num_points - number);
+}
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_32f_tanh_32f_u_H */
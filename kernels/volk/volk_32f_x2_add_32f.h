@@ -66,6 +66,7 @@
 
 #ifdef LV_HAVE_AVX512F
 #include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
 
 static inline void volk_32f_x2_add_32f_u_avx512f(float* cVector,
                                                  const float* aVector,
@@ -94,11 +95,12 @@ static inline void volk_32f_x2_add_32f_u_avx512f(float* cVector,
         cPtr += 16;
     }
 
-    number = sixteenthPoints * 16;
-
-    for (; number < num_points; number++) {
-        *cPtr++ = (*aPtr++) + (*bPtr++);
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __mmask16 mask = _mm512_tail_mask_ps(num_points - sixteenthPoints * 16);
+    aVal = _mm512_maskz_loadu_ps(mask, aPtr);
+    bVal = _mm512_maskz_loadu_ps(mask, bPtr);
+    cVal = _mm512_add_ps(aVal, bVal);
+    _mm512_mask_storeu_ps(cPtr, mask, cVal);
 }
 
 #endif /* LV_HAVE_AVX512F */
@@ -106,6 +108,7 @@ static inline void volk_32f_x2_add_32f_u_avx512f(float* cVector,
 
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_32f_x2_add_32f_u_avx(float* cVector,
                                              const float* aVector,
@@ -132,11 +135,12 @@ static inline void volk_32f_x2_add_32f_u_avx(float* cVector,
         cPtr += 8;
     }
 
-    number = eighthPoints * 8;
-
-    for (; number < num_points; number++) {
-        *cPtr++ = (*aPtr++) + (*bPtr++);
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __m256i mask = _mm256_tail_mask_ps(num_points - eighthPoints * 8);
+    aVal = _mm256_maskload_ps(aPtr, mask);
+    bVal = _mm256_maskload_ps(bPtr, mask);
+    cVal = _mm256_add_ps(aVal, bVal);
+    _mm256_maskstore_ps(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX */
 
@@ -207,6 +211,7 @@ static inline void volk_32f_x2_add_32f_generic(float* cVector,
 
 #ifdef LV_HAVE_AVX512F
 #include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
 
 static inline void volk_32f_x2_add_32f_a_avx512f(float* cVector,
                                                  const float* aVector,
@@ -235,11 +240,12 @@ static inline void volk_32f_x2_add_32f_a_avx512f(float* cVector,
         cPtr += 16;
     }
 
-    number = sixteenthPoints * 16;
-
-    for (; number < num_points; number++) {
-        *cPtr++ = (*aPtr++) + (*bPtr++);
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __mmask16 mask = _mm512_tail_mask_ps(num_points - sixteenthPoints * 16);
+    aVal = _mm512_maskz_load_ps(mask, aPtr);
+    bVal = _mm512_maskz_load_ps(mask, bPtr);
+    cVal = _mm512_add_ps(aVal, bVal);
+    _mm512_mask_store_ps(cPtr, mask, cVal);
 }
 
 #endif /* LV_HAVE_AVX512F */
@@ -247,6 +253,7 @@ static inline void volk_32f_x2_add_32f_a_avx512f(float* cVector,
 
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_32f_x2_add_32f_a_avx(float* cVector,
                                              const float* aVector,
@@ -275,10 +282,12 @@ static inline void volk_32f_x2_add_32f_a_avx(float* cVector,
         cPtr += 8;
     }
 
-    number = eighthPoints * 8;
-    for (; number < num_points; number++) {
-        *cPtr++ = (*aPtr++) + (*bPtr++);
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __m256i mask = _mm256_tail_mask_ps(num_points - eighthPoints * 8);
+    aVal = _mm256_maskload_ps(aPtr, mask);
+    bVal = _mm256_maskload_ps(bPtr, mask);
+    cVal = _mm256_add_ps(aVal, bVal);
+    _mm256_maskstore_ps(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX */
 
@@ -410,4 +419,45 @@ static inline void volk_32f_x2_add_32f_u_orc(float* cVector,
 #endif /* LV_HAVE_ORC */
 
 
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_32f_x2_add_32f_sve(float* cVector,
+                                           const float* aVector,
+                                           const float* bVector,
+                                           unsigned int num_points)
+{
+    unsigned int number;
+
+    // predicated on the points left, the last iteration covers the tail
+    for (number = 0; number < num_points; number += svcntw()) {
+        const svbool_t pg = svwhilelt_b32(number, num_points);
+        const svfloat32_t aVal = svld1(pg, aVector + number);
+        const svfloat32_t bVal = svld1(pg, bVector + number);
+        svst1(pg, cVector + number, svadd_x(pg, aVal, bVal));
+    }
+}
+#endif /* LV_HAVE_SVE */
+
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_32f_x2_add_32f_rvv(float* cVector,
+                                           const float* aVector,
+                                           const float* bVector,
+                                           unsigned int num_points)
+{
+    size_t n = num_points;
+    size_t vl;
+
+    // LMUL 8, the loop only keeps three register groups live
+    for (; n > 0; n -= vl, aVector += vl, bVector += vl, cVector += vl) {
+        vl = __riscv_vsetvl_e32m8(n);
+        const vfloat32m8_t aVal = __riscv_vle32_v_f32m8(aVector, vl);
+        const vfloat32m8_t bVal = __riscv_vle32_v_f32m8(bVector, vl);
+        __riscv_vse32_v_f32m8(cVector, __riscv_vfadd_vv_f32m8(aVal, bVal, vl), vl);
+    }
+}
+#endif /* LV_HAVE_RVV */
+
 #endif /* INCLUDED_volk_32f_x2_add_32f_a_H */
@@ -0,0 +1,283 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_x2_complex_magnitude_32f
+ *
+ * \b Overview
+ *
+ * Calculates the magnitude of a complex vector held in split (planar) form, as
+ * separate arrays of the real and the imaginary parts.
+ * This is the planar variant of volk_32fc_magnitude_32f: the SIMD implementations
+ * square and add whole vectors of real and imaginary parts and need no horizontal
+ * adds or shuffles.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_complex_magnitude_32f(float* magnitudeVector,
+ *     const float* realVector, const float* imagVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li realVector: The real parts of the input vector.
+ * \li imagVector: The imaginary parts of the input vector.
+ * \li num_points: The number of complex values in the input vector.
+ *
+ * \b Outputs
+ * \li magnitudeVector: The magnitude of each complex value.
+ *
+ * \b Example
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* re = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* im = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* magnitude = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       re[ii] = 3.f * ii;
+ *       im[ii] = 4.f * ii;
+ *   }
+ *
+ *   volk_32f_x2_complex_magnitude_32f(magnitude, re, im, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out(%i) = %+.1f\n", ii, magnitude[ii]);
+ *   }
+ *
+ *   volk_free(re);
+ *   volk_free(im);
+ *   volk_free(magnitude);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_complex_magnitude_32f_u_H
+#define INCLUDED_volk_32f_x2_complex_magnitude_32f_u_H
+
+#include <inttypes.h>
+#include <math.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_complex_magnitude_32f_generic(float* magnitudeVector,
+                                                             const float* realVector,
+                                                             const float* imagVector,
+                                                             unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        const float re = realVector[number];
+        const float im = imagVector[number];
+        magnitudeVector[number] = sqrtf(re * re + im * im);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_x2_complex_magnitude_32f_u_sse(float* magnitudeVector,
+                                                           const float* realVector,
+                                                           const float* imagVector,
+                                                           unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const __m128 re = _mm_loadu_ps(realVector);
+        const __m128 im = _mm_loadu_ps(imagVector);
+        const __m128 squared = _mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im));
+        _mm_storeu_ps(magnitudeVector, _mm_sqrt_ps(squared));
+        realVector += 4;
+        imagVector += 4;
+        magnitudeVector += 4;
+    }
+
+    volk_32f_x2_complex_magnitude_32f_generic(
+        magnitudeVector, realVector, imagVector, num_points % 4);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_x2_complex_magnitude_32f_u_avx(float* magnitudeVector,
+                                                           const float* realVector,
+                                                           const float* imagVector,
+                                                           unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        const __m256 re = _mm256_loadu_ps(realVector);
+        const __m256 im = _mm256_loadu_ps(imagVector);
+        const __m256 squared =
+            _mm256_add_ps(_mm256_mul_ps(re, re), _mm256_mul_ps(im, im));
+        _mm256_storeu_ps(magnitudeVector, _mm256_sqrt_ps(squared));
+        realVector += 8;
+        imagVector += 8;
+        magnitudeVector += 8;
+    }
+
+    volk_32f_x2_complex_magnitude_32f_generic(
+        magnitudeVector, realVector, imagVector, num_points % 8);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x2_complex_magnitude_32f_u_avx512f(float* magnitudeVector,
+                                                               const float* realVector,
+                                                               const float* imagVector,
+                                                               unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 re = _mm512_loadu_ps(realVector);
+        const __m512 im = _mm512_loadu_ps(imagVector);
+        const __m512 squared =
+            _mm512_add_ps(_mm512_mul_ps(re, re), _mm512_mul_ps(im, im));
+        _mm512_storeu_ps(magnitudeVector, _mm512_sqrt_ps(squared));
+        realVector += 16;
+        imagVector += 16;
+        magnitudeVector += 16;
+    }
+
+    volk_32f_x2_complex_magnitude_32f_generic(
+        magnitudeVector, realVector, imagVector, num_points % 16);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_complex_magnitude_32f_neonv8(float* magnitudeVector,
+                                                            const float* realVector,
+                                                            const float* imagVector,
+                                                            unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const float32x4_t re = vld1q_f32(realVector);
+        const float32x4_t im = vld1q_f32(imagVector);
+        const float32x4_t squared = vmlaq_f32(vmulq_f32(re, re), im, im);
+        vst1q_f32(magnitudeVector, vsqrtq_f32(squared));
+        realVector += 4;
+        imagVector += 4;
+        magnitudeVector += 4;
+    }
+
+    volk_32f_x2_complex_magnitude_32f_generic(
+        magnitudeVector, realVector, imagVector, num_points % 4);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_x2_complex_magnitude_32f_u_H */
+
+
+#ifndef INCLUDED_volk_32f_x2_complex_magnitude_32f_a_H
+#define INCLUDED_volk_32f_x2_complex_magnitude_32f_a_H
+
+#include <inttypes.h>
+#include <math.h>
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_x2_complex_magnitude_32f_a_sse(float* magnitudeVector,
+                                                           const float* realVector,
+                                                           const float* imagVector,
+                                                           unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const __m128 re = _mm_load_ps(realVector);
+        const __m128 im = _mm_load_ps(imagVector);
+        const __m128 squared = _mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im));
+        _mm_store_ps(magnitudeVector, _mm_sqrt_ps(squared));
+        realVector += 4;
+        imagVector += 4;
+        magnitudeVector += 4;
+    }
+
+    volk_32f_x2_complex_magnitude_32f_generic(
+        magnitudeVector, realVector, imagVector, num_points % 4);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_x2_complex_magnitude_32f_a_avx(float* magnitudeVector,
+                                                           const float* realVector,
+                                                           const float* imagVector,
+                                                           unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        const __m256 re = _mm256_load_ps(realVector);
+        const __m256 im = _mm256_load_ps(imagVector);
+        const __m256 squared =
+            _mm256_add_ps(_mm256_mul_ps(re, re), _mm256_mul_ps(im, im));
+        _mm256_store_ps(magnitudeVector, _mm256_sqrt_ps(squared));
+        realVector += 8;
+        imagVector += 8;
+        magnitudeVector += 8;
+    }
+
+    volk_32f_x2_complex_magnitude_32f_generic(
+        magnitudeVector, realVector, imagVector, num_points % 8);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x2_complex_magnitude_32f_a_avx512f(float* magnitudeVector,
+                                                               const float* realVector,
+                                                               const float* imagVector,
+                                                               unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 re = _mm512_load_ps(realVector);
+        const __m512 im = _mm512_load_ps(imagVector);
+        const __m512 squared =
+            _mm512_add_ps(_mm512_mul_ps(re, re), _mm512_mul_ps(im, im));
+        _mm512_store_ps(magnitudeVector, _mm512_sqrt_ps(squared));
+        realVector += 16;
+        imagVector += 16;
+        magnitudeVector += 16;
+    }
+
+    volk_32f_x2_complex_magnitude_32f_generic(
+        magnitudeVector, realVector, imagVector, num_points % 16);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32f_x2_complex_magnitude_32f_a_H */
@@ -63,6 +63,7 @@
 
 #ifdef LV_HAVE_AVX512F
 #include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
 
 static inline void volk_32f_x2_divide_32f_a_avx512f(float* cVector,
                                                     const float* aVector,
@@ -90,16 +91,19 @@ static inline void volk_32f_x2_divide_32f_a_avx512f(float* cVector,
         cPtr += 16;
     }
 
-    number = sixteenthPoints * 16;
-    for (; number < num_points; number++) {
-        *cPtr++ = (*aPtr++) / (*bPtr++);
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __mmask16 mask = _mm512_tail_mask_ps(num_points - sixteenthPoints * 16);
+    aVal = _mm512_maskz_load_ps(mask, aPtr);
+    bVal = _mm512_maskz_load_ps(mask, bPtr);
+    cVal = _mm512_div_ps(aVal, bVal);
+    _mm512_mask_store_ps(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX512F */
 
 
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_32f_x2_divide_32f_a_avx(float* cVector,
                                                 const float* aVector,
@@ -127,10 +131,12 @@ static inline void volk_32f_x2_divide_32f_a_avx(float* cVector,
         cPtr += 8;
     }
 
-    number = eighthPoints * 8;
-    for (; number < num_points; number++) {
-        *cPtr++ = (*aPtr++) / (*bPtr++);
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __m256i mask = _mm256_tail_mask_ps(num_points - eighthPoints * 8);
+    aVal = _mm256_maskload_ps(aPtr, mask);
+    bVal = _mm256_maskload_ps(bPtr, mask);
+    cVal = _mm256_div_ps(aVal, bVal);
+    _mm256_maskstore_ps(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX */
 
@@ -276,6 +282,7 @@ static inline void volk_32f_x2_divide_32f_u_orc(float* cVector,
 
 #ifdef LV_HAVE_AVX512F
 #include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
 
 static inline void volk_32f_x2_divide_32f_u_avx512f(float* cVector,
                                                     const float* aVector,
@@ -303,16 +310,19 @@ static inline void volk_32f_x2_divide_32f_u_avx512f(float* cVector,
         cPtr += 16;
     }
 
-    number = sixteenthPoints * 16;
-    for (; number < num_points; number++) {
-        *cPtr++ = (*aPtr++) / (*bPtr++);
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __mmask16 mask = _mm512_tail_mask_ps(num_points - sixteenthPoints * 16);
+    aVal = _mm512_maskz_loadu_ps(mask, aPtr);
+    bVal = _mm512_maskz_loadu_ps(mask, bPtr);
+    cVal = _mm512_div_ps(aVal, bVal);
+    _mm512_mask_storeu_ps(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX512F */
 
 
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_32f_x2_divide_32f_u_avx(float* cVector,
                                                 const float* aVector,
@@ -340,10 +350,12 @@ static inline void volk_32f_x2_divide_32f_u_avx(float* cVector,
         cPtr += 8;
     }
 
-    number = eighthPoints * 8;
-    for (; number < num_points; number++) {
-        *cPtr++ = (*aPtr++) / (*bPtr++);
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __m256i mask = _mm256_tail_mask_ps(num_points - eighthPoints * 8);
+    aVal = _mm256_maskload_ps(aPtr, mask);
+    bVal = _mm256_maskload_ps(bPtr, mask);
+    cVal = _mm256_div_ps(aVal, bVal);
+    _mm256_maskstore_ps(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX */
 
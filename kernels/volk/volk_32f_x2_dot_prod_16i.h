@@ -678,5 +678,53 @@ static inline void volk_32f_x2_dot_prod_16i_u_avx512f(int16_t* result,
 
 #endif /*LV_HAVE_AVX512F*/
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_dot_prod_16i_neon(int16_t* result,
+                                                 const float* input,
+                                                 const float* taps,
+                                                 unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    float dotProduct = 0;
+    const float* aPtr = input;
+    const float* bPtr = taps;
+    __VOLK_ATTR_ALIGNED(16) float dotProductVector[4];
+
+    float32x4_t dotProdVal0 = vdupq_n_f32(0.0f);
+    float32x4_t dotProdVal1 = vdupq_n_f32(0.0f);
+    float32x4_t dotProdVal2 = vdupq_n_f32(0.0f);
+    float32x4_t dotProdVal3 = vdupq_n_f32(0.0f);
+
+    for (; number < sixteenthPoints; number++) {
+        dotProdVal0 = vmlaq_f32(dotProdVal0, vld1q_f32(aPtr), vld1q_f32(bPtr));
+        dotProdVal1 = vmlaq_f32(dotProdVal1, vld1q_f32(aPtr + 4), vld1q_f32(bPtr + 4));
+        dotProdVal2 = vmlaq_f32(dotProdVal2, vld1q_f32(aPtr + 8), vld1q_f32(bPtr + 8));
+        dotProdVal3 = vmlaq_f32(dotProdVal3, vld1q_f32(aPtr + 12), vld1q_f32(bPtr + 12));
+        aPtr += 16;
+        bPtr += 16;
+    }
+
+    dotProdVal0 = vaddq_f32(dotProdVal0, dotProdVal1);
+    dotProdVal0 = vaddq_f32(dotProdVal0, dotProdVal2);
+    dotProdVal0 = vaddq_f32(dotProdVal0, dotProdVal3);
+    vst1q_f32(dotProductVector, dotProdVal0);
+
+    dotProduct = dotProductVector[0];
+    dotProduct += dotProductVector[1];
+    dotProduct += dotProductVector[2];
+    dotProduct += dotProductVector[3];
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        dotProduct += ((*aPtr++) * (*bPtr++));
+    }
+
+    *result = (int16_t)dotProduct;
+}
+#endif /*LV_HAVE_NEON*/
 
 #endif /*INCLUDED_volk_32f_x2_dot_prod_16i_H*/
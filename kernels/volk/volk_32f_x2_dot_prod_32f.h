@@ -310,6 +310,7 @@ static inline void volk_32f_x2_dot_prod_32f_u_sse4_1(float* result,
 #ifdef LV_HAVE_AVX
 
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_32f_x2_dot_prod_32f_u_avx(float* result,
                                                   const float* input,
@@ -348,6 +349,17 @@ static inline void volk_32f_x2_dot_prod_32f_u_avx(float* result,
         bPtr += 16;
     }
 
+    // the up to 15 remaining points through masked loads, the lanes past them add 0
+    const unsigned int remainder = num_points - sixteenthPoints * 16;
+    const __m256i mask0 = _mm256_tail_mask_ps(remainder > 8 ? 8 : remainder);
+    const __m256i mask1 = _mm256_tail_mask_ps(remainder > 8 ? remainder - 8 : 0);
+    a0Val = _mm256_maskload_ps(aPtr, mask0);
+    a1Val = _mm256_maskload_ps(aPtr + 8, mask1);
+    b0Val = _mm256_maskload_ps(bPtr, mask0);
+    b1Val = _mm256_maskload_ps(bPtr + 8, mask1);
+    dotProdVal0 = _mm256_add_ps(_mm256_mul_ps(a0Val, b0Val), dotProdVal0);
+    dotProdVal1 = _mm256_add_ps(_mm256_mul_ps(a1Val, b1Val), dotProdVal1);
+
     dotProdVal0 = _mm256_add_ps(dotProdVal0, dotProdVal1);
 
     __VOLK_ATTR_ALIGNED(32) float dotProductVector[8];
@@ -364,11 +376,6 @@ static inline void volk_32f_x2_dot_prod_32f_u_avx(float* result,
     dotProduct += dotProductVector[6];
     dotProduct += dotProductVector[7];
 
-    number = sixteenthPoints * 16;
-    for (; number < num_points; number++) {
-        dotProduct += ((*aPtr++) * (*bPtr++));
-    }
-
     *result = dotProduct;
 }
 
@@ -376,6 +383,7 @@ static inline void volk_32f_x2_dot_prod_32f_u_avx(float* result,
 
 #if LV_HAVE_AVX2 && LV_HAVE_FMA
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 static inline void volk_32f_x2_dot_prod_32f_u_avx2_fma(float* result,
                                                        const float* input,
                                                        const float* taps,
@@ -400,6 +408,12 @@ static inline void volk_32f_x2_dot_prod_32f_u_avx2_fma(float* result,
         dotProdVal = _mm256_fmadd_ps(aVal1, bVal1, dotProdVal);
     }
 
+    // masked tail, the lanes past num_points add 0
+    const __m256i mask = _mm256_tail_mask_ps(num_points - eighthPoints * 8);
+    aVal1 = _mm256_maskload_ps(aPtr, mask);
+    bVal1 = _mm256_maskload_ps(bPtr, mask);
+    dotProdVal = _mm256_fmadd_ps(aVal1, bVal1, dotProdVal);
+
     __VOLK_ATTR_ALIGNED(32) float dotProductVector[8];
     _mm256_storeu_ps(dotProductVector,
                      dotProdVal); // Store the results back into the dot product vector
@@ -408,16 +422,13 @@ static inline void volk_32f_x2_dot_prod_32f_u_avx2_fma(float* result,
                        dotProductVector[3] + dotProductVector[4] + dotProductVector[5] +
                        dotProductVector[6] + dotProductVector[7];
 
-    for (number = eighthPoints * 8; number < num_points; number++) {
-        dotProduct += ((*aPtr++) * (*bPtr++));
-    }
-
     *result = dotProduct;
 }
 #endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
 
 #if LV_HAVE_AVX512F
 #include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
 static inline void volk_32f_x2_dot_prod_32f_u_avx512f(float* result,
                                                       const float* input,
                                                       const float* taps,
@@ -442,6 +453,12 @@ static inline void volk_32f_x2_dot_prod_32f_u_avx512f(float* result,
         dotProdVal = _mm512_fmadd_ps(aVal1, bVal1, dotProdVal);
     }
 
+    // masked tail, the lanes past num_points add 0
+    const __mmask16 mask = _mm512_tail_mask_ps(num_points - sixteenthPoints * 16);
+    aVal1 = _mm512_maskz_loadu_ps(mask, aPtr);
+    bVal1 = _mm512_maskz_loadu_ps(mask, bPtr);
+    dotProdVal = _mm512_fmadd_ps(aVal1, bVal1, dotProdVal);
+
     __VOLK_ATTR_ALIGNED(64) float dotProductVector[16];
     _mm512_storeu_ps(dotProductVector,
                      dotProdVal); // Store the results back into the dot product vector
@@ -453,10 +470,6 @@ static inline void volk_32f_x2_dot_prod_32f_u_avx512f(float* result,
                        dotProductVector[12] + dotProductVector[13] +
                        dotProductVector[14] + dotProductVector[15];
 
-    for (number = sixteenthPoints * 16; number < num_points; number++) {
-        dotProduct += ((*aPtr++) * (*bPtr++));
-    }
-
     *result = dotProduct;
 }
 #endif /* LV_HAVE_AVX512F */
@@ -718,6 +731,7 @@ static inline void volk_32f_x2_dot_prod_32f_a_sse4_1(float* result,
 #ifdef LV_HAVE_AVX
 
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_32f_x2_dot_prod_32f_a_avx(float* result,
                                                   const float* input,
@@ -756,6 +770,17 @@ static inline void volk_32f_x2_dot_prod_32f_a_avx(float* result,
         bPtr += 16;
     }
 
+    // the up to 15 remaining points through masked loads, the lanes past them add 0
+    const unsigned int remainder = num_points - sixteenthPoints * 16;
+    const __m256i mask0 = _mm256_tail_mask_ps(remainder > 8 ? 8 : remainder);
+    const __m256i mask1 = _mm256_tail_mask_ps(remainder > 8 ? remainder - 8 : 0);
+    a0Val = _mm256_maskload_ps(aPtr, mask0);
+    a1Val = _mm256_maskload_ps(aPtr + 8, mask1);
+    b0Val = _mm256_maskload_ps(bPtr, mask0);
+    b1Val = _mm256_maskload_ps(bPtr + 8, mask1);
+    dotProdVal0 = _mm256_add_ps(_mm256_mul_ps(a0Val, b0Val), dotProdVal0);
+    dotProdVal1 = _mm256_add_ps(_mm256_mul_ps(a1Val, b1Val), dotProdVal1);
+
     dotProdVal0 = _mm256_add_ps(dotProdVal0, dotProdVal1);
 
     __VOLK_ATTR_ALIGNED(32) float dotProductVector[8];
@@ -772,11 +797,6 @@ static inline void volk_32f_x2_dot_prod_32f_a_avx(float* result,
     dotProduct += dotProductVector[6];
     dotProduct += dotProductVector[7];
 
-    number = sixteenthPoints * 16;
-    for (; number < num_points; number++) {
-        dotProduct += ((*aPtr++) * (*bPtr++));
-    }
-
     *result = dotProduct;
 }
 #endif /*LV_HAVE_AVX*/
@@ -784,6 +804,7 @@ static inline void volk_32f_x2_dot_prod_32f_a_avx(float* result,
 
 #if LV_HAVE_AVX2 && LV_HAVE_FMA
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 static inline void volk_32f_x2_dot_prod_32f_a_avx2_fma(float* result,
                                                        const float* input,
                                                        const float* taps,
@@ -808,6 +829,12 @@ static inline void volk_32f_x2_dot_prod_32f_a_avx2_fma(float* result,
         dotProdVal = _mm256_fmadd_ps(aVal1, bVal1, dotProdVal);
     }
 
+    // masked tail, the lanes past num_points add 0
+    const __m256i mask = _mm256_tail_mask_ps(num_points - eighthPoints * 8);
+    aVal1 = _mm256_maskload_ps(aPtr, mask);
+    bVal1 = _mm256_maskload_ps(bPtr, mask);
+    dotProdVal = _mm256_fmadd_ps(aVal1, bVal1, dotProdVal);
+
     __VOLK_ATTR_ALIGNED(32) float dotProductVector[8];
     _mm256_store_ps(dotProductVector,
                     dotProdVal); // Store the results back into the dot product vector
@@ -816,16 +843,13 @@ static inline void volk_32f_x2_dot_prod_32f_a_avx2_fma(float* result,
                        dotProductVector[3] + dotProductVector[4] + dotProductVector[5] +
                        dotProductVector[6] + dotProductVector[7];
 
-    for (number = eighthPoints * 8; number < num_points; number++) {
-        dotProduct += ((*aPtr++) * (*bPtr++));
-    }
-
     *result = dotProduct;
 }
 #endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
 
 #if LV_HAVE_AVX512F
 #include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
 static inline void volk_32f_x2_dot_prod_32f_a_avx512f(float* result,
                                                       const float* input,
                                                       const float* taps,
@@ -850,6 +874,12 @@ static inline void volk_32f_x2_dot_prod_32f_a_avx512f(float* result,
         dotProdVal = _mm512_fmadd_ps(aVal1, bVal1, dotProdVal);
     }
 
+    // masked tail, the lanes past num_points add 0
+    const __mmask16 mask = _mm512_tail_mask_ps(num_points - sixteenthPoints * 16);
+    aVal1 = _mm512_maskz_load_ps(mask, aPtr);
+    bVal1 = _mm512_maskz_load_ps(mask, bPtr);
+    dotProdVal = _mm512_fmadd_ps(aVal1, bVal1, dotProdVal);
+
     __VOLK_ATTR_ALIGNED(64) float dotProductVector[16];
     _mm512_store_ps(dotProductVector,
                     dotProdVal); // Store the results back into the dot product vector
@@ -861,10 +891,6 @@ static inline void volk_32f_x2_dot_prod_32f_a_avx512f(float* result,
                        dotProductVector[12] + dotProductVector[13] +
                        dotProductVector[14] + dotProductVector[15];
 
-    for (number = sixteenthPoints * 16; number < num_points; number++) {
-        dotProduct += ((*aPtr++) * (*bPtr++));
-    }
-
     *result = dotProduct;
 }
 #endif /* LV_HAVE_AVX512F */
@@ -973,4 +999,54 @@ extern void volk_32f_x2_dot_prod_32f_a_neonasm_opts(float* cVector,
                                                     unsigned int num_points);
 #endif /* LV_HAVE_NEONV7 */
 
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_32f_x2_dot_prod_32f_sve(float* result,
+                                                const float* input,
+                                                const float* taps,
+                                                unsigned int num_points)
+{
+    svfloat32_t acc = svdup_f32(0.f);
+    unsigned int number;
+
+    for (number = 0; number < num_points; number += svcntw()) {
+        const svbool_t pg = svwhilelt_b32(number, num_points);
+        const svfloat32_t inVal = svld1(pg, input + number);
+        const svfloat32_t tapVal = svld1(pg, taps + number);
+        // merging, the lanes past the end keep their sums
+        acc = svmla_m(pg, acc, inVal, tapVal);
+    }
+
+    *result = svaddv(svptrue_b32(), acc);
+}
+#endif /* LV_HAVE_SVE */
+
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_32f_x2_dot_prod_32f_rvv(float* result,
+                                                const float* input,
+                                                const float* taps,
+                                                unsigned int num_points)
+{
+    const size_t vlmax = __riscv_vsetvlmax_e32m8();
+    vfloat32m8_t acc = __riscv_vfmv_v_f_f32m8(0.f, vlmax);
+    size_t n = num_points;
+    size_t vl;
+
+    for (; n > 0; n -= vl, input += vl, taps += vl) {
+        vl = __riscv_vsetvl_e32m8(n);
+        const vfloat32m8_t inVal = __riscv_vle32_v_f32m8(input, vl);
+        const vfloat32m8_t tapVal = __riscv_vle32_v_f32m8(taps, vl);
+        // tail undisturbed, the lanes past vl keep their sums
+        acc = __riscv_vfmacc_vv_f32m8_tu(acc, inVal, tapVal, vl);
+    }
+
+    const vfloat32m1_t sum =
+        __riscv_vfredusum_vs_f32m8_f32m1(acc, __riscv_vfmv_s_f_f32m1(0.f, 1), vlmax);
+    *result = __riscv_vfmv_f_s_f32m1_f32(sum);
+}
+#endif /* LV_HAVE_RVV */
+
 #endif /*INCLUDED_volk_32f_x2_dot_prod_32f_a_H*/
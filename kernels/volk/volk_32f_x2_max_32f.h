@@ -63,6 +63,7 @@
 
 #ifdef LV_HAVE_AVX512F
 #include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
 
 static inline void volk_32f_x2_max_32f_a_avx512f(float* cVector,
                                                  const float* aVector,
@@ -90,12 +91,12 @@ static inline void volk_32f_x2_max_32f_a_avx512f(float* cVector,
         cPtr += 16;
     }
 
-    number = sixteenthPoints * 16;
-    for (; number < num_points; number++) {
-        const float a = *aPtr++;
-        const float b = *bPtr++;
-        *cPtr++ = (a > b ? a : b);
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __mmask16 mask = _mm512_tail_mask_ps(num_points - sixteenthPoints * 16);
+    aVal = _mm512_maskz_load_ps(mask, aPtr);
+    bVal = _mm512_maskz_load_ps(mask, bPtr);
+    cVal = _mm512_max_ps(aVal, bVal);
+    _mm512_mask_store_ps(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX512F */
 
@@ -139,6 +140,7 @@ static inline void volk_32f_x2_max_32f_a_sse(float* cVector,
 
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_32f_x2_max_32f_a_avx(float* cVector,
                                              const float* aVector,
@@ -166,12 +168,12 @@ static inline void volk_32f_x2_max_32f_a_avx(float* cVector,
         cPtr += 8;
     }
 
-    number = eighthPoints * 8;
-    for (; number < num_points; number++) {
-        const float a = *aPtr++;
-        const float b = *bPtr++;
-        *cPtr++ = (a > b ? a : b);
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __m256i mask = _mm256_tail_mask_ps(num_points - eighthPoints * 8);
+    aVal = _mm256_maskload_ps(aPtr, mask);
+    bVal = _mm256_maskload_ps(bPtr, mask);
+    cVal = _mm256_max_ps(aVal, bVal);
+    _mm256_maskstore_ps(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX */
 
@@ -256,6 +258,7 @@ static inline void volk_32f_x2_max_32f_u_orc(float* cVector,
 
 #ifdef LV_HAVE_AVX512F
 #include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
 
 static inline void volk_32f_x2_max_32f_u_avx512f(float* cVector,
                                                  const float* aVector,
@@ -283,17 +286,18 @@ static inline void volk_32f_x2_max_32f_u_avx512f(float* cVector,
         cPtr += 16;
     }
 
-    number = sixteenthPoints * 16;
-    for (; number < num_points; number++) {
-        const float a = *aPtr++;
-        const float b = *bPtr++;
-        *cPtr++ = (a > b ? a : b);
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __mmask16 mask = _mm512_tail_mask_ps(num_points - sixteenthPoints * 16);
+    aVal = _mm512_maskz_loadu_ps(mask, aPtr);
+    bVal = _mm512_maskz_loadu_ps(mask, bPtr);
+    cVal = _mm512_max_ps(aVal, bVal);
+    _mm512_mask_storeu_ps(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX512F */
 
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_32f_x2_max_32f_u_avx(float* cVector,
                                              const float* aVector,
@@ -321,12 +325,12 @@ static inline void volk_32f_x2_max_32f_u_avx(float* cVector,
         cPtr += 8;
     }
 
-    number = eighthPoints * 8;
-    for (; number < num_points; number++) {
-        const float a = *aPtr++;
-        const float b = *bPtr++;
-        *cPtr++ = (a > b ? a : b);
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __m256i mask = _mm256_tail_mask_ps(num_points - eighthPoints * 8);
+    aVal = _mm256_maskload_ps(aPtr, mask);
+    bVal = _mm256_maskload_ps(bPtr, mask);
+    cVal = _mm256_max_ps(aVal, bVal);
+    _mm256_maskstore_ps(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX */
 
@@ -974,4 +974,39 @@ static inline void volk_32f_x2_pow_32f_u_avx2(float* cVector,
 
 #endif /* LV_HAVE_AVX2 for unaligned */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_x2_pow_32f_neon(float* cVector,
+                                            const float* bVector,
+                                            const float* aVector,
+                                            unsigned int num_points)
+{
+    float* cPtr = cVector;
+    const float* bPtr = bVector;
+    const float* aPtr = aVector;
+
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    float32x4_t aVal, bVal;
+    for (; number < quarterPoints; number++) {
+        aVal = vld1q_f32(aPtr);
+        bVal = vld1q_f32(bPtr);
+        // exp(b * ln(a))
+        vst1q_f32(cPtr, _vexpq_f32(vmulq_f32(bVal, _vlogq_f32(aVal))));
+        aPtr += 4;
+        bPtr += 4;
+        cPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *cPtr++ = powf(*aPtr++, *bPtr++);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_32f_x2_log2_32f_u_H */
@@ -326,5 +326,43 @@ static inline void volk_32f_x2_s32f_interleave_16ic_u_avx2(lv_16sc_t* complexVec
 }
 #endif /* LV_HAVE_AVX2 */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_s32f_interleave_16ic_neonv8(lv_16sc_t* complexVector,
+                                                           const float* iBuffer,
+                                                           const float* qBuffer,
+                                                           const float scalar,
+                                                           unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    int16_t* complexVectorPtr = (int16_t*)complexVector;
+    const float* iBufferPtr = iBuffer;
+    const float* qBufferPtr = qBuffer;
+
+    float32x4_t iValue, qValue;
+    int16x4x2_t complexValue;
+    for (; number < quarterPoints; number++) {
+        iValue = vmulq_n_f32(vld1q_f32(iBufferPtr), scalar);
+        qValue = vmulq_n_f32(vld1q_f32(qBufferPtr), scalar);
+        iBufferPtr += 4;
+        qBufferPtr += 4;
+
+        // vrndiq takes into account the current rounding mode (as does rintf)
+        complexValue.val[0] = vqmovn_s32(vcvtq_s32_f32(vrndiq_f32(iValue)));
+        complexValue.val[1] = vqmovn_s32(vcvtq_s32_f32(vrndiq_f32(qValue)));
+        vst2_s16(complexVectorPtr, complexValue);
+        complexVectorPtr += 8;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *complexVectorPtr++ = (int16_t)rintf(*iBufferPtr++ * scalar);
+        *complexVectorPtr++ = (int16_t)rintf(*qBufferPtr++ * scalar);
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
 
 #endif /* INCLUDED_volk_32f_x2_s32f_interleave_16ic_u_H */
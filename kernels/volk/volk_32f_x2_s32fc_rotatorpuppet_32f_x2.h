@@ -0,0 +1,193 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+#ifndef INCLUDED_volk_32f_x2_s32fc_rotatorpuppet_32f_x2_a_H
+#define INCLUDED_volk_32f_x2_s32fc_rotatorpuppet_32f_x2_a_H
+
+
+#include <volk/volk_32f_x2_s32fc_x2_rotator_32f_x2.h>
+#include <volk/volk_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32f_x2_s32fc_rotatorpuppet_32f_x2_generic(float* outReal,
+                                               float* outImag,
+                                               const float* inReal,
+                                               const float* inImag,
+                                               const lv_32fc_t phase_inc,
+                                               unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32f_x2_s32fc_x2_rotator_32f_x2_generic(
+        outReal, outImag, inReal, inImag, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_s32fc_rotatorpuppet_32f_x2_neon(float* outReal,
+                                                               float* outImag,
+                                                               const float* inReal,
+                                                               const float* inImag,
+                                                               const lv_32fc_t phase_inc,
+                                                               unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32f_x2_s32fc_x2_rotator_32f_x2_neon(
+        outReal, outImag, inReal, inImag, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void
+volk_32f_x2_s32fc_rotatorpuppet_32f_x2_a_sse(float* outReal,
+                                             float* outImag,
+                                             const float* inReal,
+                                             const float* inImag,
+                                             const lv_32fc_t phase_inc,
+                                             unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32f_x2_s32fc_x2_rotator_32f_x2_a_sse(
+        outReal, outImag, inReal, inImag, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void
+volk_32f_x2_s32fc_rotatorpuppet_32f_x2_u_sse(float* outReal,
+                                             float* outImag,
+                                             const float* inReal,
+                                             const float* inImag,
+                                             const lv_32fc_t phase_inc,
+                                             unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32f_x2_s32fc_x2_rotator_32f_x2_u_sse(
+        outReal, outImag, inReal, inImag, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void
+volk_32f_x2_s32fc_rotatorpuppet_32f_x2_a_avx(float* outReal,
+                                             float* outImag,
+                                             const float* inReal,
+                                             const float* inImag,
+                                             const lv_32fc_t phase_inc,
+                                             unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32f_x2_s32fc_x2_rotator_32f_x2_a_avx(
+        outReal, outImag, inReal, inImag, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void
+volk_32f_x2_s32fc_rotatorpuppet_32f_x2_u_avx(float* outReal,
+                                             float* outImag,
+                                             const float* inReal,
+                                             const float* inImag,
+                                             const lv_32fc_t phase_inc,
+                                             unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32f_x2_s32fc_x2_rotator_32f_x2_u_avx(
+        outReal, outImag, inReal, inImag, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32f_x2_s32fc_rotatorpuppet_32f_x2_a_avx512f(float* outReal,
+                                                 float* outImag,
+                                                 const float* inReal,
+                                                 const float* inImag,
+                                                 const lv_32fc_t phase_inc,
+                                                 unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32f_x2_s32fc_x2_rotator_32f_x2_a_avx512f(
+        outReal, outImag, inReal, inImag, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32f_x2_s32fc_rotatorpuppet_32f_x2_u_avx512f(float* outReal,
+                                                 float* outImag,
+                                                 const float* inReal,
+                                                 const float* inImag,
+                                                 const lv_32fc_t phase_inc,
+                                                 unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32f_x2_s32fc_x2_rotator_32f_x2_u_avx512f(
+        outReal, outImag, inReal, inImag, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#endif /* INCLUDED_volk_32f_x2_s32fc_rotatorpuppet_32f_x2_a_H */
@@ -0,0 +1,620 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_x2_s32fc_x2_rotator_32f_x2
+ *
+ * \b Overview
+ *
+ * Rotates a complex vector held in split (planar) form, as separate arrays of the
+ * real and the imaginary parts, at a fixed rate per sample from an initial phase
+ * offset.
+ * This is the planar variant of volk_32fc_s32fc_x2_rotator_32fc: the SIMD
+ * implementations keep one phase per lane in separate registers for the real and
+ * the imaginary part and need no shuffles to rotate the samples or advance the
+ * phase. Like the interleaved kernel, the phase is normalized every ROTATOR_RELOAD
+ * samples and at the end of each call.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_s32fc_x2_rotator_32f_x2(float* outReal, float* outImag,
+ *     const float* inReal, const float* inImag, const lv_32fc_t phase_inc,
+ *     lv_32fc_t* phase, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inReal: The real parts of the vector to be rotated.
+ * \li inImag: The imaginary parts of the vector to be rotated.
+ * \li phase_inc: rotational velocity.
+ * \li phase: initial phase offset, updated to the phase of the next sample.
+ * \li num_points: The number of complex values to be rotated.
+ *
+ * \b Outputs
+ * \li outReal: The real parts of the rotated vector.
+ * \li outImag: The imaginary parts of the rotated vector.
+ *
+ * \b Example
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* re = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* im = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       // Generate a tone at f=0.3
+ *       re[ii] = std::cos(0.3f * (float)ii);
+ *       im[ii] = std::sin(0.3f * (float)ii);
+ *   }
+ *   // The oscillator rotates at f=0.1
+ *   float frequency = 0.1f;
+ *   lv_32fc_t phase_increment = lv_cmake(std::cos(frequency), std::sin(frequency));
+ *   lv_32fc_t phase = lv_cmake(1.f, 0.0f); // start at 1 (0 rad phase)
+ *
+ *   // rotate in place so the samples are a tone at f=0.4
+ *   volk_32f_x2_s32fc_x2_rotator_32f_x2(re, im, re, im, phase_increment, &phase, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.2f %+1.2fj\n", ii, re[ii], im[ii]);
+ *   }
+ *
+ *   volk_free(re);
+ *   volk_free(im);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_s32fc_x2_rotator_32f_x2_u_H
+#define INCLUDED_volk_32f_x2_s32fc_x2_rotator_32f_x2_u_H
+
+#include <math.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+#define ROTATOR_RELOAD 512
+#define ROTATOR_RELOAD_2 (ROTATOR_RELOAD / 2)
+#define ROTATOR_RELOAD_4 (ROTATOR_RELOAD / 4)
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_s32fc_x2_rotator_32f_x2_generic(float* outReal,
+                                                               float* outImag,
+                                                               const float* inReal,
+                                                               const float* inImag,
+                                                               const lv_32fc_t phase_inc,
+                                                               lv_32fc_t* phase,
+                                                               unsigned int num_points)
+{
+    const float incReal = lv_creal(phase_inc);
+    const float incImag = lv_cimag(phase_inc);
+    float phaseReal = lv_creal(*phase);
+    float phaseImag = lv_cimag(*phase);
+
+    unsigned int number = 0;
+    while (number < num_points) {
+        unsigned int blockEnd = number + ROTATOR_RELOAD;
+        if (blockEnd > num_points) {
+            blockEnd = num_points;
+        }
+        for (; number < blockEnd; number++) {
+            const float re = inReal[number];
+            const float im = inImag[number];
+            outReal[number] = re * phaseReal - im * phaseImag;
+            outImag[number] = re * phaseImag + im * phaseReal;
+            const float nextReal = phaseReal * incReal - phaseImag * incImag;
+            phaseImag = phaseReal * incImag + phaseImag * incReal;
+            phaseReal = nextReal;
+        }
+        // normalize phase so magnitude doesn't grow because of
+        // floating point rounding error
+        const float magnitude = hypotf(phaseReal, phaseImag);
+        phaseReal /= magnitude;
+        phaseImag /= magnitude;
+    }
+    *phase = lv_cmake(phaseReal, phaseImag);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_x2_s32fc_x2_rotator_32f_x2_u_sse(float* outReal,
+                                                             float* outImag,
+                                                             const float* inReal,
+                                                             const float* inImag,
+                                                             const lv_32fc_t phase_inc,
+                                                             lv_32fc_t* phase,
+                                                             unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    __VOLK_ATTR_ALIGNED(16) float phaseReal[4];
+    __VOLK_ATTR_ALIGNED(16) float phaseImag[4];
+
+    // lane i starts at phase * phase_inc^i and all lanes advance by phase_inc^4
+    lv_32fc_t incr = lv_cmake(1.0f, 0.0f);
+    for (unsigned int i = 0; i < 4; i++) {
+        const lv_32fc_t lanePhase = (*phase) * incr;
+        phaseReal[i] = lv_creal(lanePhase);
+        phaseImag[i] = lv_cimag(lanePhase);
+        incr *= phase_inc;
+    }
+    const __m128 incReal = _mm_set1_ps(lv_creal(incr));
+    const __m128 incImag = _mm_set1_ps(lv_cimag(incr));
+    __m128 pr = _mm_load_ps(phaseReal);
+    __m128 pi = _mm_load_ps(phaseImag);
+
+    unsigned int number = 0;
+    while (number < quarterPoints) {
+        unsigned int blockEnd = number + ROTATOR_RELOAD / 4;
+        if (blockEnd > quarterPoints) {
+            blockEnd = quarterPoints;
+        }
+        for (; number < blockEnd; number++) {
+            const __m128 re = _mm_loadu_ps(inReal);
+            const __m128 im = _mm_loadu_ps(inImag);
+            const __m128 rotatedReal = _mm_sub_ps(_mm_mul_ps(re, pr), _mm_mul_ps(im, pi));
+            const __m128 rotatedImag = _mm_add_ps(_mm_mul_ps(re, pi), _mm_mul_ps(im, pr));
+            _mm_storeu_ps(outReal, rotatedReal);
+            _mm_storeu_ps(outImag, rotatedImag);
+            const __m128 nextReal =
+                _mm_sub_ps(_mm_mul_ps(pr, incReal), _mm_mul_ps(pi, incImag));
+            pi = _mm_add_ps(_mm_mul_ps(pr, incImag), _mm_mul_ps(pi, incReal));
+            pr = nextReal;
+            inReal += 4;
+            inImag += 4;
+            outReal += 4;
+            outImag += 4;
+        }
+        // normalize phase so magnitude doesn't grow because of
+        // floating point rounding error
+        const __m128 magnitude =
+            _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(pr, pr), _mm_mul_ps(pi, pi)));
+        pr = _mm_div_ps(pr, magnitude);
+        pi = _mm_div_ps(pi, magnitude);
+    }
+    _mm_store_ps(phaseReal, pr);
+    _mm_store_ps(phaseImag, pi);
+
+    *phase = lv_cmake(phaseReal[0], phaseImag[0]);
+    volk_32f_x2_s32fc_x2_rotator_32f_x2_generic(
+        outReal, outImag, inReal, inImag, phase_inc, phase, num_points % 4);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_x2_s32fc_x2_rotator_32f_x2_u_avx(float* outReal,
+                                                             float* outImag,
+                                                             const float* inReal,
+                                                             const float* inImag,
+                                                             const lv_32fc_t phase_inc,
+                                                             lv_32fc_t* phase,
+                                                             unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    __VOLK_ATTR_ALIGNED(32) float phaseReal[8];
+    __VOLK_ATTR_ALIGNED(32) float phaseImag[8];
+
+    // lane i starts at phase * phase_inc^i and all lanes advance by phase_inc^8
+    lv_32fc_t incr = lv_cmake(1.0f, 0.0f);
+    for (unsigned int i = 0; i < 8; i++) {
+        const lv_32fc_t lanePhase = (*phase) * incr;
+        phaseReal[i] = lv_creal(lanePhase);
+        phaseImag[i] = lv_cimag(lanePhase);
+        incr *= phase_inc;
+    }
+    const __m256 incReal = _mm256_set1_ps(lv_creal(incr));
+    const __m256 incImag = _mm256_set1_ps(lv_cimag(incr));
+    __m256 pr = _mm256_load_ps(phaseReal);
+    __m256 pi = _mm256_load_ps(phaseImag);
+
+    unsigned int number = 0;
+    while (number < eighthPoints) {
+        unsigned int blockEnd = number + ROTATOR_RELOAD / 8;
+        if (blockEnd > eighthPoints) {
+            blockEnd = eighthPoints;
+        }
+        for (; number < blockEnd; number++) {
+            const __m256 re = _mm256_loadu_ps(inReal);
+            const __m256 im = _mm256_loadu_ps(inImag);
+            const __m256 rotatedReal =
+                _mm256_sub_ps(_mm256_mul_ps(re, pr), _mm256_mul_ps(im, pi));
+            const __m256 rotatedImag =
+                _mm256_add_ps(_mm256_mul_ps(re, pi), _mm256_mul_ps(im, pr));
+            _mm256_storeu_ps(outReal, rotatedReal);
+            _mm256_storeu_ps(outImag, rotatedImag);
+            const __m256 nextReal =
+                _mm256_sub_ps(_mm256_mul_ps(pr, incReal), _mm256_mul_ps(pi, incImag));
+            pi = _mm256_add_ps(_mm256_mul_ps(pr, incImag), _mm256_mul_ps(pi, incReal));
+            pr = nextReal;
+            inReal += 8;
+            inImag += 8;
+            outReal += 8;
+            outImag += 8;
+        }
+        // normalize phase so magnitude doesn't grow because of
+        // floating point rounding error
+        const __m256 magnitude =
+            _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(pr, pr), _mm256_mul_ps(pi, pi)));
+        pr = _mm256_div_ps(pr, magnitude);
+        pi = _mm256_div_ps(pi, magnitude);
+    }
+    _mm256_store_ps(phaseReal, pr);
+    _mm256_store_ps(phaseImag, pi);
+
+    *phase = lv_cmake(phaseReal[0], phaseImag[0]);
+    volk_32f_x2_s32fc_x2_rotator_32f_x2_generic(
+        outReal, outImag, inReal, inImag, phase_inc, phase, num_points % 8);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32f_x2_s32fc_x2_rotator_32f_x2_u_avx512f(float* outReal,
+                                              float* outImag,
+                                              const float* inReal,
+                                              const float* inImag,
+                                              const lv_32fc_t phase_inc,
+                                              lv_32fc_t* phase,
+                                              unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    __VOLK_ATTR_ALIGNED(64) float phaseReal[16];
+    __VOLK_ATTR_ALIGNED(64) float phaseImag[16];
+
+    // lane i starts at phase * phase_inc^i and all lanes advance by phase_inc^16
+    lv_32fc_t incr = lv_cmake(1.0f, 0.0f);
+    for (unsigned int i = 0; i < 16; i++) {
+        const lv_32fc_t lanePhase = (*phase) * incr;
+        phaseReal[i] = lv_creal(lanePhase);
+        phaseImag[i] = lv_cimag(lanePhase);
+        incr *= phase_inc;
+    }
+    const __m512 incReal = _mm512_set1_ps(lv_creal(incr));
+    const __m512 incImag = _mm512_set1_ps(lv_cimag(incr));
+    __m512 pr = _mm512_load_ps(phaseReal);
+    __m512 pi = _mm512_load_ps(phaseImag);
+
+    unsigned int number = 0;
+    while (number < sixteenthPoints) {
+        unsigned int blockEnd = number + ROTATOR_RELOAD / 16;
+        if (blockEnd > sixteenthPoints) {
+            blockEnd = sixteenthPoints;
+        }
+        for (; number < blockEnd; number++) {
+            const __m512 re = _mm512_loadu_ps(inReal);
+            const __m512 im = _mm512_loadu_ps(inImag);
+            const __m512 rotatedReal =
+                _mm512_sub_ps(_mm512_mul_ps(re, pr), _mm512_mul_ps(im, pi));
+            const __m512 rotatedImag =
+                _mm512_add_ps(_mm512_mul_ps(re, pi), _mm512_mul_ps(im, pr));
+            _mm512_storeu_ps(outReal, rotatedReal);
+            _mm512_storeu_ps(outImag, rotatedImag);
+            const __m512 nextReal =
+                _mm512_sub_ps(_mm512_mul_ps(pr, incReal), _mm512_mul_ps(pi, incImag));
+            pi = _mm512_add_ps(_mm512_mul_ps(pr, incImag), _mm512_mul_ps(pi, incReal));
+            pr = nextReal;
+            inReal += 16;
+            inImag += 16;
+            outReal += 16;
+            outImag += 16;
+        }
+        // normalize phase so magnitude doesn't grow because of
+        // floating point rounding error
+        const __m512 magnitude =
+            _mm512_sqrt_ps(_mm512_add_ps(_mm512_mul_ps(pr, pr), _mm512_mul_ps(pi, pi)));
+        pr = _mm512_div_ps(pr, magnitude);
+        pi = _mm512_div_ps(pi, magnitude);
+    }
+    _mm512_store_ps(phaseReal, pr);
+    _mm512_store_ps(phaseImag, pi);
+
+    *phase = lv_cmake(phaseReal[0], phaseImag[0]);
+    volk_32f_x2_s32fc_x2_rotator_32f_x2_generic(
+        outReal, outImag, inReal, inImag, phase_inc, phase, num_points % 16);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_x2_s32fc_x2_rotator_32f_x2_neon(float* outReal,
+                                                            float* outImag,
+                                                            const float* inReal,
+                                                            const float* inImag,
+                                                            const lv_32fc_t phase_inc,
+                                                            lv_32fc_t* phase,
+                                                            unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    __VOLK_ATTR_ALIGNED(16) float phaseReal[4];
+    __VOLK_ATTR_ALIGNED(16) float phaseImag[4];
+
+    // lane i starts at phase * phase_inc^i and all lanes advance by phase_inc^4
+    lv_32fc_t incr = lv_cmake(1.0f, 0.0f);
+    for (unsigned int i = 0; i < 4; i++) {
+        const lv_32fc_t lanePhase = (*phase) * incr;
+        phaseReal[i] = lv_creal(lanePhase);
+        phaseImag[i] = lv_cimag(lanePhase);
+        incr *= phase_inc;
+    }
+    const float32x4_t incReal = vdupq_n_f32(lv_creal(incr));
+    const float32x4_t incImag = vdupq_n_f32(lv_cimag(incr));
+    float32x4_t pr = vld1q_f32(phaseReal);
+    float32x4_t pi = vld1q_f32(phaseImag);
+
+    unsigned int number = 0;
+    while (number < quarterPoints) {
+        unsigned int blockEnd = number + ROTATOR_RELOAD / 4;
+        if (blockEnd > quarterPoints) {
+            blockEnd = quarterPoints;
+        }
+        for (; number < blockEnd; number++) {
+            const float32x4_t re = vld1q_f32(inReal);
+            const float32x4_t im = vld1q_f32(inImag);
+            const float32x4_t rotatedReal = vmlsq_f32(vmulq_f32(re, pr), im, pi);
+            const float32x4_t rotatedImag = vmlaq_f32(vmulq_f32(re, pi), im, pr);
+            vst1q_f32(outReal, rotatedReal);
+            vst1q_f32(outImag, rotatedImag);
+            const float32x4_t nextReal = vmlsq_f32(vmulq_f32(pr, incReal), pi, incImag);
+            pi = vmlaq_f32(vmulq_f32(pr, incImag), pi, incReal);
+            pr = nextReal;
+            inReal += 4;
+            inImag += 4;
+            outReal += 4;
+            outImag += 4;
+        }
+        // normalize phase so magnitude doesn't grow because of
+        // floating point rounding error
+        const float32x4_t invMagnitude =
+            _vinvsqrtq_f32(vmlaq_f32(vmulq_f32(pr, pr), pi, pi));
+        pr = vmulq_f32(pr, invMagnitude);
+        pi = vmulq_f32(pi, invMagnitude);
+    }
+    vst1q_f32(phaseReal, pr);
+    vst1q_f32(phaseImag, pi);
+
+    *phase = lv_cmake(phaseReal[0], phaseImag[0]);
+    volk_32f_x2_s32fc_x2_rotator_32f_x2_generic(
+        outReal, outImag, inReal, inImag, phase_inc, phase, num_points % 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_s32fc_x2_rotator_32f_x2_u_H */
+
+
+#ifndef INCLUDED_volk_32f_x2_s32fc_x2_rotator_32f_x2_a_H
+#define INCLUDED_volk_32f_x2_s32fc_x2_rotator_32f_x2_a_H
+
+#include <math.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+#define ROTATOR_RELOAD 512
+#define ROTATOR_RELOAD_2 (ROTATOR_RELOAD / 2)
+#define ROTATOR_RELOAD_4 (ROTATOR_RELOAD / 4)
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_x2_s32fc_x2_rotator_32f_x2_a_sse(float* outReal,
+                                                             float* outImag,
+                                                             const float* inReal,
+                                                             const float* inImag,
+                                                             const lv_32fc_t phase_inc,
+                                                             lv_32fc_t* phase,
+                                                             unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    __VOLK_ATTR_ALIGNED(16) float phaseReal[4];
+    __VOLK_ATTR_ALIGNED(16) float phaseImag[4];
+
+    // lane i starts at phase * phase_inc^i and all lanes advance by phase_inc^4
+    lv_32fc_t incr = lv_cmake(1.0f, 0.0f);
+    for (unsigned int i = 0; i < 4; i++) {
+        const lv_32fc_t lanePhase = (*phase) * incr;
+        phaseReal[i] = lv_creal(lanePhase);
+        phaseImag[i] = lv_cimag(lanePhase);
+        incr *= phase_inc;
+    }
+    const __m128 incReal = _mm_set1_ps(lv_creal(incr));
+    const __m128 incImag = _mm_set1_ps(lv_cimag(incr));
+    __m128 pr = _mm_load_ps(phaseReal);
+    __m128 pi = _mm_load_ps(phaseImag);
+
+    unsigned int number = 0;
+    while (number < quarterPoints) {
+        unsigned int blockEnd = number + ROTATOR_RELOAD / 4;
+        if (blockEnd > quarterPoints) {
+            blockEnd = quarterPoints;
+        }
+        for (; number < blockEnd; number++) {
+            const __m128 re = _mm_load_ps(inReal);
+            const __m128 im = _mm_load_ps(inImag);
+            const __m128 rotatedReal = _mm_sub_ps(_mm_mul_ps(re, pr), _mm_mul_ps(im, pi));
+            const __m128 rotatedImag = _mm_add_ps(_mm_mul_ps(re, pi), _mm_mul_ps(im, pr));
+            _mm_store_ps(outReal, rotatedReal);
+            _mm_store_ps(outImag, rotatedImag);
+            const __m128 nextReal =
+                _mm_sub_ps(_mm_mul_ps(pr, incReal), _mm_mul_ps(pi, incImag));
+            pi = _mm_add_ps(_mm_mul_ps(pr, incImag), _mm_mul_ps(pi, incReal));
+            pr = nextReal;
+            inReal += 4;
+            inImag += 4;
+            outReal += 4;
+            outImag += 4;
+        }
+        // normalize phase so magnitude doesn't grow because of
+        // floating point rounding error
+        const __m128 magnitude =
+            _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(pr, pr), _mm_mul_ps(pi, pi)));
+        pr = _mm_div_ps(pr, magnitude);
+        pi = _mm_div_ps(pi, magnitude);
+    }
+    _mm_store_ps(phaseReal, pr);
+    _mm_store_ps(phaseImag, pi);
+
+    *phase = lv_cmake(phaseReal[0], phaseImag[0]);
+    volk_32f_x2_s32fc_x2_rotator_32f_x2_generic(
+        outReal, outImag, inReal, inImag, phase_inc, phase, num_points % 4);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_x2_s32fc_x2_rotator_32f_x2_a_avx(float* outReal,
+                                                             float* outImag,
+                                                             const float* inReal,
+                                                             const float* inImag,
+                                                             const lv_32fc_t phase_inc,
+                                                             lv_32fc_t* phase,
+                                                             unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    __VOLK_ATTR_ALIGNED(32) float phaseReal[8];
+    __VOLK_ATTR_ALIGNED(32) float phaseImag[8];
+
+    // lane i starts at phase * phase_inc^i and all lanes advance by phase_inc^8
+    lv_32fc_t incr = lv_cmake(1.0f, 0.0f);
+    for (unsigned int i = 0; i < 8; i++) {
+        const lv_32fc_t lanePhase = (*phase) * incr;
+        phaseReal[i] = lv_creal(lanePhase);
+        phaseImag[i] = lv_cimag(lanePhase);
+        incr *= phase_inc;
+    }
+    const __m256 incReal = _mm256_set1_ps(lv_creal(incr));
+    const __m256 incImag = _mm256_set1_ps(lv_cimag(incr));
+    __m256 pr = _mm256_load_ps(phaseReal);
+    __m256 pi = _mm256_load_ps(phaseImag);
+
+    unsigned int number = 0;
+    while (number < eighthPoints) {
+        unsigned int blockEnd = number + ROTATOR_RELOAD / 8;
+        if (blockEnd > eighthPoints) {
+            blockEnd = eighthPoints;
+        }
+        for (; number < blockEnd; number++) {
+            const __m256 re = _mm256_load_ps(inReal);
+            const __m256 im = _mm256_load_ps(inImag);
+            const __m256 rotatedReal =
+                _mm256_sub_ps(_mm256_mul_ps(re, pr), _mm256_mul_ps(im, pi));
+            const __m256 rotatedImag =
+                _mm256_add_ps(_mm256_mul_ps(re, pi), _mm256_mul_ps(im, pr));
+            _mm256_store_ps(outReal, rotatedReal);
+            _mm256_store_ps(outImag, rotatedImag);
+            const __m256 nextReal =
+                _mm256_sub_ps(_mm256_mul_ps(pr, incReal), _mm256_mul_ps(pi, incImag));
+            pi = _mm256_add_ps(_mm256_mul_ps(pr, incImag), _mm256_mul_ps(pi, incReal));
+            pr = nextReal;
+            inReal += 8;
+            inImag += 8;
+            outReal += 8;
+            outImag += 8;
+        }
+        // normalize phase so magnitude doesn't grow because of
+        // floating point rounding error
+        const __m256 magnitude =
+            _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(pr, pr), _mm256_mul_ps(pi, pi)));
+        pr = _mm256_div_ps(pr, magnitude);
+        pi = _mm256_div_ps(pi, magnitude);
+    }
+    _mm256_store_ps(phaseReal, pr);
+    _mm256_store_ps(phaseImag, pi);
+
+    *phase = lv_cmake(phaseReal[0], phaseImag[0]);
+    volk_32f_x2_s32fc_x2_rotator_32f_x2_generic(
+        outReal, outImag, inReal, inImag, phase_inc, phase, num_points % 8);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32f_x2_s32fc_x2_rotator_32f_x2_a_avx512f(float* outReal,
+                                              float* outImag,
+                                              const float* inReal,
+                                              const float* inImag,
+                                              const lv_32fc_t phase_inc,
+                                              lv_32fc_t* phase,
+                                              unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    __VOLK_ATTR_ALIGNED(64) float phaseReal[16];
+    __VOLK_ATTR_ALIGNED(64) float phaseImag[16];
+
+    // lane i starts at phase * phase_inc^i and all lanes advance by phase_inc^16
+    lv_32fc_t incr = lv_cmake(1.0f, 0.0f);
+    for (unsigned int i = 0; i < 16; i++) {
+        const lv_32fc_t lanePhase = (*phase) * incr;
+        phaseReal[i] = lv_creal(lanePhase);
+        phaseImag[i] = lv_cimag(lanePhase);
+        incr *= phase_inc;
+    }
+    const __m512 incReal = _mm512_set1_ps(lv_creal(incr));
+    const __m512 incImag = _mm512_set1_ps(lv_cimag(incr));
+    __m512 pr = _mm512_load_ps(phaseReal);
+    __m512 pi = _mm512_load_ps(phaseImag);
+
+    unsigned int number = 0;
+    while (number < sixteenthPoints) {
+        unsigned int blockEnd = number + ROTATOR_RELOAD / 16;
+        if (blockEnd > sixteenthPoints) {
+            blockEnd = sixteenthPoints;
+        }
+        for (; number < blockEnd; number++) {
+            const __m512 re = _mm512_load_ps(inReal);
+            const __m512 im = _mm512_load_ps(inImag);
+            const __m512 rotatedReal =
+                _mm512_sub_ps(_mm512_mul_ps(re, pr), _mm512_mul_ps(im, pi));
+            const __m512 rotatedImag =
+                _mm512_add_ps(_mm512_mul_ps(re, pi), _mm512_mul_ps(im, pr));
+            _mm512_store_ps(outReal, rotatedReal);
+            _mm512_store_ps(outImag, rotatedImag);
+            const __m512 nextReal =
+                _mm512_sub_ps(_mm512_mul_ps(pr, incReal), _mm512_mul_ps(pi, incImag));
+            pi = _mm512_add_ps(_mm512_mul_ps(pr, incImag), _mm512_mul_ps(pi, incReal));
+            pr = nextReal;
+            inReal += 16;
+            inImag += 16;
+            outReal += 16;
+            outImag += 16;
+        }
+        // normalize phase so magnitude doesn't grow because of
+        // floating point rounding error
+        const __m512 magnitude =
+            _mm512_sqrt_ps(_mm512_add_ps(_mm512_mul_ps(pr, pr), _mm512_mul_ps(pi, pi)));
+        pr = _mm512_div_ps(pr, magnitude);
+        pi = _mm512_div_ps(pi, magnitude);
+    }
+    _mm512_store_ps(phaseReal, pr);
+    _mm512_store_ps(phaseImag, pi);
+
+    *phase = lv_cmake(phaseReal[0], phaseImag[0]);
+    volk_32f_x2_s32fc_x2_rotator_32f_x2_generic(
+        outReal, outImag, inReal, inImag, phase_inc, phase, num_points % 16);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32f_x2_s32fc_x2_rotator_32f_x2_a_H */
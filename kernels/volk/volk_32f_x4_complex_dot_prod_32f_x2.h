@@ -0,0 +1,445 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_x4_complex_dot_prod_32f_x2
+ *
+ * \b Overview
+ *
+ * Computes the dot product (the sum of the element-wise products, without
+ * conjugation) of two complex vectors held in split (planar) form, as separate
+ * arrays of the real and the imaginary parts.
+ * This is the planar variant of volk_32fc_x2_dot_prod_32fc: the SIMD
+ * implementations keep one accumulator for the real and one for the imaginary part
+ * and need no shuffles in the loop, only one horizontal sum at the end.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x4_complex_dot_prod_32f_x2(float* resultReal, float* resultImag,
+ *     const float* aReal, const float* aImag, const float* bReal, const float* bImag,
+ *     unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aReal: The real parts of the first vector.
+ * \li aImag: The imaginary parts of the first vector.
+ * \li bReal: The real parts of the second vector.
+ * \li bImag: The imaginary parts of the second vector.
+ * \li num_points: The number of complex values in each vector.
+ *
+ * \b Outputs
+ * \li resultReal: The real part of the dot product.
+ * \li resultImag: The imaginary part of the dot product.
+ *
+ * \b Example
+ * \code
+ *   int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* re = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* im = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* taps_re = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* taps_im = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float res_re, res_im;
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       re[ii] = cosf(0.1f * ii);
+ *       im[ii] = sinf(0.1f * ii);
+ *       taps_re[ii] = cosf(0.1f * ii);
+ *       taps_im[ii] = -sinf(0.1f * ii);
+ *   }
+ *
+ *   volk_32f_x4_complex_dot_prod_32f_x2(&res_re, &res_im, re, im, taps_re, taps_im, N);
+ *   printf("dot product = %+.2f %+.2fi\n", res_re, res_im);
+ *
+ *   volk_free(re);
+ *   volk_free(im);
+ *   volk_free(taps_re);
+ *   volk_free(taps_im);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x4_complex_dot_prod_32f_x2_u_H
+#define INCLUDED_volk_32f_x4_complex_dot_prod_32f_x2_u_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x4_complex_dot_prod_32f_x2_generic(float* resultReal,
+                                                               float* resultImag,
+                                                               const float* aReal,
+                                                               const float* aImag,
+                                                               const float* bReal,
+                                                               const float* bImag,
+                                                               unsigned int num_points)
+{
+    float sumReal = 0.0f;
+    float sumImag = 0.0f;
+    for (unsigned int number = 0; number < num_points; number++) {
+        const float ar = aReal[number];
+        const float ai = aImag[number];
+        const float br = bReal[number];
+        const float bi = bImag[number];
+        sumReal += ar * br - ai * bi;
+        sumImag += ar * bi + ai * br;
+    }
+    *resultReal = sumReal;
+    *resultImag = sumImag;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_x4_complex_dot_prod_32f_x2_u_sse(float* resultReal,
+                                                             float* resultImag,
+                                                             const float* aReal,
+                                                             const float* aImag,
+                                                             const float* bReal,
+                                                             const float* bImag,
+                                                             unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    __m128 accRR = _mm_setzero_ps();
+    __m128 accII = _mm_setzero_ps();
+    __m128 accRI = _mm_setzero_ps();
+    __m128 accIR = _mm_setzero_ps();
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const __m128 ar = _mm_loadu_ps(aReal);
+        const __m128 ai = _mm_loadu_ps(aImag);
+        const __m128 br = _mm_loadu_ps(bReal);
+        const __m128 bi = _mm_loadu_ps(bImag);
+        accRR = _mm_add_ps(accRR, _mm_mul_ps(ar, br));
+        accII = _mm_add_ps(accII, _mm_mul_ps(ai, bi));
+        accRI = _mm_add_ps(accRI, _mm_mul_ps(ar, bi));
+        accIR = _mm_add_ps(accIR, _mm_mul_ps(ai, br));
+        aReal += 4;
+        aImag += 4;
+        bReal += 4;
+        bImag += 4;
+    }
+
+    const __m128 accReal = _mm_sub_ps(accRR, accII);
+    const __m128 accImag = _mm_add_ps(accRI, accIR);
+    __VOLK_ATTR_ALIGNED(16) float partialReal[4];
+    __VOLK_ATTR_ALIGNED(16) float partialImag[4];
+    _mm_store_ps(partialReal, accReal);
+    _mm_store_ps(partialImag, accImag);
+
+    volk_32f_x4_complex_dot_prod_32f_x2_generic(
+        resultReal, resultImag, aReal, aImag, bReal, bImag, num_points % 4);
+    for (unsigned int i = 0; i < 4; i++) {
+        *resultReal += partialReal[i];
+        *resultImag += partialImag[i];
+    }
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_x4_complex_dot_prod_32f_x2_u_avx(float* resultReal,
+                                                             float* resultImag,
+                                                             const float* aReal,
+                                                             const float* aImag,
+                                                             const float* bReal,
+                                                             const float* bImag,
+                                                             unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    __m256 accRR = _mm256_setzero_ps();
+    __m256 accII = _mm256_setzero_ps();
+    __m256 accRI = _mm256_setzero_ps();
+    __m256 accIR = _mm256_setzero_ps();
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        const __m256 ar = _mm256_loadu_ps(aReal);
+        const __m256 ai = _mm256_loadu_ps(aImag);
+        const __m256 br = _mm256_loadu_ps(bReal);
+        const __m256 bi = _mm256_loadu_ps(bImag);
+        accRR = _mm256_add_ps(accRR, _mm256_mul_ps(ar, br));
+        accII = _mm256_add_ps(accII, _mm256_mul_ps(ai, bi));
+        accRI = _mm256_add_ps(accRI, _mm256_mul_ps(ar, bi));
+        accIR = _mm256_add_ps(accIR, _mm256_mul_ps(ai, br));
+        aReal += 8;
+        aImag += 8;
+        bReal += 8;
+        bImag += 8;
+    }
+
+    const __m256 accReal = _mm256_sub_ps(accRR, accII);
+    const __m256 accImag = _mm256_add_ps(accRI, accIR);
+    __VOLK_ATTR_ALIGNED(32) float partialReal[8];
+    __VOLK_ATTR_ALIGNED(32) float partialImag[8];
+    _mm256_store_ps(partialReal, accReal);
+    _mm256_store_ps(partialImag, accImag);
+
+    volk_32f_x4_complex_dot_prod_32f_x2_generic(
+        resultReal, resultImag, aReal, aImag, bReal, bImag, num_points % 8);
+    for (unsigned int i = 0; i < 8; i++) {
+        *resultReal += partialReal[i];
+        *resultImag += partialImag[i];
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x4_complex_dot_prod_32f_x2_u_avx512f(float* resultReal,
+                                                                 float* resultImag,
+                                                                 const float* aReal,
+                                                                 const float* aImag,
+                                                                 const float* bReal,
+                                                                 const float* bImag,
+                                                                 unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    __m512 accRR = _mm512_setzero_ps();
+    __m512 accII = _mm512_setzero_ps();
+    __m512 accRI = _mm512_setzero_ps();
+    __m512 accIR = _mm512_setzero_ps();
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 ar = _mm512_loadu_ps(aReal);
+        const __m512 ai = _mm512_loadu_ps(aImag);
+        const __m512 br = _mm512_loadu_ps(bReal);
+        const __m512 bi = _mm512_loadu_ps(bImag);
+        accRR = _mm512_add_ps(accRR, _mm512_mul_ps(ar, br));
+        accII = _mm512_add_ps(accII, _mm512_mul_ps(ai, bi));
+        accRI = _mm512_add_ps(accRI, _mm512_mul_ps(ar, bi));
+        accIR = _mm512_add_ps(accIR, _mm512_mul_ps(ai, br));
+        aReal += 16;
+        aImag += 16;
+        bReal += 16;
+        bImag += 16;
+    }
+
+    const __m512 accReal = _mm512_sub_ps(accRR, accII);
+    const __m512 accImag = _mm512_add_ps(accRI, accIR);
+
+    float tailReal, tailImag;
+    volk_32f_x4_complex_dot_prod_32f_x2_generic(
+        &tailReal, &tailImag, aReal, aImag, bReal, bImag, num_points % 16);
+    *resultReal = _mm512_reduce_add_ps(accReal) + tailReal;
+    *resultImag = _mm512_reduce_add_ps(accImag) + tailImag;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_x4_complex_dot_prod_32f_x2_neon(float* resultReal,
+                                                            float* resultImag,
+                                                            const float* aReal,
+                                                            const float* aImag,
+                                                            const float* bReal,
+                                                            const float* bImag,
+                                                            unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    float32x4_t accRR = vdupq_n_f32(0.0f);
+    float32x4_t accII = vdupq_n_f32(0.0f);
+    float32x4_t accRI = vdupq_n_f32(0.0f);
+    float32x4_t accIR = vdupq_n_f32(0.0f);
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const float32x4_t ar = vld1q_f32(aReal);
+        const float32x4_t ai = vld1q_f32(aImag);
+        const float32x4_t br = vld1q_f32(bReal);
+        const float32x4_t bi = vld1q_f32(bImag);
+        accRR = vmlaq_f32(accRR, ar, br);
+        accII = vmlaq_f32(accII, ai, bi);
+        accRI = vmlaq_f32(accRI, ar, bi);
+        accIR = vmlaq_f32(accIR, ai, br);
+        aReal += 4;
+        aImag += 4;
+        bReal += 4;
+        bImag += 4;
+    }
+
+    __VOLK_ATTR_ALIGNED(16) float partialReal[4];
+    __VOLK_ATTR_ALIGNED(16) float partialImag[4];
+    vst1q_f32(partialReal, vsubq_f32(accRR, accII));
+    vst1q_f32(partialImag, vaddq_f32(accRI, accIR));
+
+    volk_32f_x4_complex_dot_prod_32f_x2_generic(
+        resultReal, resultImag, aReal, aImag, bReal, bImag, num_points % 4);
+    for (unsigned int i = 0; i < 4; i++) {
+        *resultReal += partialReal[i];
+        *resultImag += partialImag[i];
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x4_complex_dot_prod_32f_x2_u_H */
+
+
+#ifndef INCLUDED_volk_32f_x4_complex_dot_prod_32f_x2_a_H
+#define INCLUDED_volk_32f_x4_complex_dot_prod_32f_x2_a_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_x4_complex_dot_prod_32f_x2_a_sse(float* resultReal,
+                                                             float* resultImag,
+                                                             const float* aReal,
+                                                             const float* aImag,
+                                                             const float* bReal,
+                                                             const float* bImag,
+                                                             unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    __m128 accRR = _mm_setzero_ps();
+    __m128 accII = _mm_setzero_ps();
+    __m128 accRI = _mm_setzero_ps();
+    __m128 accIR = _mm_setzero_ps();
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const __m128 ar = _mm_load_ps(aReal);
+        const __m128 ai = _mm_load_ps(aImag);
+        const __m128 br = _mm_load_ps(bReal);
+        const __m128 bi = _mm_load_ps(bImag);
+        accRR = _mm_add_ps(accRR, _mm_mul_ps(ar, br));
+        accII = _mm_add_ps(accII, _mm_mul_ps(ai, bi));
+        accRI = _mm_add_ps(accRI, _mm_mul_ps(ar, bi));
+        accIR = _mm_add_ps(accIR, _mm_mul_ps(ai, br));
+        aReal += 4;
+        aImag += 4;
+        bReal += 4;
+        bImag += 4;
+    }
+
+    const __m128 accReal = _mm_sub_ps(accRR, accII);
+    const __m128 accImag = _mm_add_ps(accRI, accIR);
+    __VOLK_ATTR_ALIGNED(16) float partialReal[4];
+    __VOLK_ATTR_ALIGNED(16) float partialImag[4];
+    _mm_store_ps(partialReal, accReal);
+    _mm_store_ps(partialImag, accImag);
+
+    volk_32f_x4_complex_dot_prod_32f_x2_generic(
+        resultReal, resultImag, aReal, aImag, bReal, bImag, num_points % 4);
+    for (unsigned int i = 0; i < 4; i++) {
+        *resultReal += partialReal[i];
+        *resultImag += partialImag[i];
+    }
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_x4_complex_dot_prod_32f_x2_a_avx(float* resultReal,
+                                                             float* resultImag,
+                                                             const float* aReal,
+                                                             const float* aImag,
+                                                             const float* bReal,
+                                                             const float* bImag,
+                                                             unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    __m256 accRR = _mm256_setzero_ps();
+    __m256 accII = _mm256_setzero_ps();
+    __m256 accRI = _mm256_setzero_ps();
+    __m256 accIR = _mm256_setzero_ps();
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        const __m256 ar = _mm256_load_ps(aReal);
+        const __m256 ai = _mm256_load_ps(aImag);
+        const __m256 br = _mm256_load_ps(bReal);
+        const __m256 bi = _mm256_load_ps(bImag);
+        accRR = _mm256_add_ps(accRR, _mm256_mul_ps(ar, br));
+        accII = _mm256_add_ps(accII, _mm256_mul_ps(ai, bi));
+        accRI = _mm256_add_ps(accRI, _mm256_mul_ps(ar, bi));
+        accIR = _mm256_add_ps(accIR, _mm256_mul_ps(ai, br));
+        aReal += 8;
+        aImag += 8;
+        bReal += 8;
+        bImag += 8;
+    }
+
+    const __m256 accReal = _mm256_sub_ps(accRR, accII);
+    const __m256 accImag = _mm256_add_ps(accRI, accIR);
+    __VOLK_ATTR_ALIGNED(32) float partialReal[8];
+    __VOLK_ATTR_ALIGNED(32) float partialImag[8];
+    _mm256_store_ps(partialReal, accReal);
+    _mm256_store_ps(partialImag, accImag);
+
+    volk_32f_x4_complex_dot_prod_32f_x2_generic(
+        resultReal, resultImag, aReal, aImag, bReal, bImag, num_points % 8);
+    for (unsigned int i = 0; i < 8; i++) {
+        *resultReal += partialReal[i];
+        *resultImag += partialImag[i];
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x4_complex_dot_prod_32f_x2_a_avx512f(float* resultReal,
+                                                                 float* resultImag,
+                                                                 const float* aReal,
+                                                                 const float* aImag,
+                                                                 const float* bReal,
+                                                                 const float* bImag,
+                                                                 unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    __m512 accRR = _mm512_setzero_ps();
+    __m512 accII = _mm512_setzero_ps();
+    __m512 accRI = _mm512_setzero_ps();
+    __m512 accIR = _mm512_setzero_ps();
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 ar = _mm512_load_ps(aReal);
+        const __m512 ai = _mm512_load_ps(aImag);
+        const __m512 br = _mm512_load_ps(bReal);
+        const __m512 bi = _mm512_load_ps(bImag);
+        accRR = _mm512_add_ps(accRR, _mm512_mul_ps(ar, br));
+        accII = _mm512_add_ps(accII, _mm512_mul_ps(ai, bi));
+        accRI = _mm512_add_ps(accRI, _mm512_mul_ps(ar, bi));
+        accIR = _mm512_add_ps(accIR, _mm512_mul_ps(ai, br));
+        aReal += 16;
+        aImag += 16;
+        bReal += 16;
+        bImag += 16;
+    }
+
+    const __m512 accReal = _mm512_sub_ps(accRR, accII);
+    const __m512 accImag = _mm512_add_ps(accRI, accIR);
+
+    float tailReal, tailImag;
+    volk_32f_x4_complex_dot_prod_32f_x2_generic(
+        &tailReal, &tailImag, aReal, aImag, bReal, bImag, num_points % 16);
+    *resultReal = _mm512_reduce_add_ps(accReal) + tailReal;
+    *resultImag = _mm512_reduce_add_ps(accImag) + tailImag;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32f_x4_complex_dot_prod_32f_x2_a_H */
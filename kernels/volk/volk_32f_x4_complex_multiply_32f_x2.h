@@ -0,0 +1,358 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_x4_complex_multiply_32f_x2
+ *
+ * \b Overview
+ *
+ * Multiplies two complex vectors held in split (planar) form, as separate arrays of
+ * the real and the imaginary parts, and stores a times b
+ * in the same form.
+ * This is the planar variant of volk_32fc_x2_multiply_32fc: without interleaved
+ * samples the SIMD implementations need no shuffles, so data that is already
+ * planar, e.g. in beamforming or after an FFT, is best processed in place of
+ * interleaving it first.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x4_complex_multiply_32f_x2(float* cReal, float* cImag,
+ *     const float* aReal, const float* aImag, const float* bReal, const float* bImag,
+ *     unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aReal: The real parts of the first vector.
+ * \li aImag: The imaginary parts of the first vector.
+ * \li bReal: The real parts of the second vector.
+ * \li bImag: The imaginary parts of the second vector.
+ * \li num_points: The number of complex values in each vector.
+ *
+ * \b Outputs
+ * \li cReal: The real parts of the products.
+ * \li cImag: The imaginary parts of the products.
+ *
+ * \b Example
+ * \code
+ *   int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* re = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* im = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* w_re = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* w_im = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       re[ii] = cosf(0.1f * ii);
+ *       im[ii] = sinf(0.1f * ii);
+ *       w_re[ii] = 0.5f;
+ *       w_im[ii] = -0.5f;
+ *   }
+ *
+ *   // weight the samples in place
+ *   volk_32f_x4_complex_multiply_32f_x2(re, im, re, im, w_re, w_im, N);
+ *
+ *   volk_free(re);
+ *   volk_free(im);
+ *   volk_free(w_re);
+ *   volk_free(w_im);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x4_complex_multiply_32f_x2_u_H
+#define INCLUDED_volk_32f_x4_complex_multiply_32f_x2_u_H
+
+#include <inttypes.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x4_complex_multiply_32f_x2_generic(float* cReal,
+                                                               float* cImag,
+                                                               const float* aReal,
+                                                               const float* aImag,
+                                                               const float* bReal,
+                                                               const float* bImag,
+                                                               unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        const float ar = aReal[number];
+        const float ai = aImag[number];
+        const float br = bReal[number];
+        const float bi = bImag[number];
+        cReal[number] = ar * br - ai * bi;
+        cImag[number] = ar * bi + ai * br;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_x4_complex_multiply_32f_x2_u_sse(float* cReal,
+                                                             float* cImag,
+                                                             const float* aReal,
+                                                             const float* aImag,
+                                                             const float* bReal,
+                                                             const float* bImag,
+                                                             unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const __m128 ar = _mm_loadu_ps(aReal);
+        const __m128 ai = _mm_loadu_ps(aImag);
+        const __m128 br = _mm_loadu_ps(bReal);
+        const __m128 bi = _mm_loadu_ps(bImag);
+        const __m128 re = _mm_sub_ps(_mm_mul_ps(ar, br), _mm_mul_ps(ai, bi));
+        const __m128 im = _mm_add_ps(_mm_mul_ps(ar, bi), _mm_mul_ps(ai, br));
+        _mm_storeu_ps(cReal, re);
+        _mm_storeu_ps(cImag, im);
+        aReal += 4;
+        aImag += 4;
+        bReal += 4;
+        bImag += 4;
+        cReal += 4;
+        cImag += 4;
+    }
+
+    volk_32f_x4_complex_multiply_32f_x2_generic(
+        cReal, cImag, aReal, aImag, bReal, bImag, num_points % 4);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_x4_complex_multiply_32f_x2_u_avx(float* cReal,
+                                                             float* cImag,
+                                                             const float* aReal,
+                                                             const float* aImag,
+                                                             const float* bReal,
+                                                             const float* bImag,
+                                                             unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        const __m256 ar = _mm256_loadu_ps(aReal);
+        const __m256 ai = _mm256_loadu_ps(aImag);
+        const __m256 br = _mm256_loadu_ps(bReal);
+        const __m256 bi = _mm256_loadu_ps(bImag);
+        const __m256 re = _mm256_sub_ps(_mm256_mul_ps(ar, br), _mm256_mul_ps(ai, bi));
+        const __m256 im = _mm256_add_ps(_mm256_mul_ps(ar, bi), _mm256_mul_ps(ai, br));
+        _mm256_storeu_ps(cReal, re);
+        _mm256_storeu_ps(cImag, im);
+        aReal += 8;
+        aImag += 8;
+        bReal += 8;
+        bImag += 8;
+        cReal += 8;
+        cImag += 8;
+    }
+
+    volk_32f_x4_complex_multiply_32f_x2_generic(
+        cReal, cImag, aReal, aImag, bReal, bImag, num_points % 8);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x4_complex_multiply_32f_x2_u_avx512f(float* cReal,
+                                                                 float* cImag,
+                                                                 const float* aReal,
+                                                                 const float* aImag,
+                                                                 const float* bReal,
+                                                                 const float* bImag,
+                                                                 unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 ar = _mm512_loadu_ps(aReal);
+        const __m512 ai = _mm512_loadu_ps(aImag);
+        const __m512 br = _mm512_loadu_ps(bReal);
+        const __m512 bi = _mm512_loadu_ps(bImag);
+        const __m512 re = _mm512_sub_ps(_mm512_mul_ps(ar, br), _mm512_mul_ps(ai, bi));
+        const __m512 im = _mm512_add_ps(_mm512_mul_ps(ar, bi), _mm512_mul_ps(ai, br));
+        _mm512_storeu_ps(cReal, re);
+        _mm512_storeu_ps(cImag, im);
+        aReal += 16;
+        aImag += 16;
+        bReal += 16;
+        bImag += 16;
+        cReal += 16;
+        cImag += 16;
+    }
+
+    volk_32f_x4_complex_multiply_32f_x2_generic(
+        cReal, cImag, aReal, aImag, bReal, bImag, num_points % 16);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_x4_complex_multiply_32f_x2_neon(float* cReal,
+                                                            float* cImag,
+                                                            const float* aReal,
+                                                            const float* aImag,
+                                                            const float* bReal,
+                                                            const float* bImag,
+                                                            unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const float32x4_t ar = vld1q_f32(aReal);
+        const float32x4_t ai = vld1q_f32(aImag);
+        const float32x4_t br = vld1q_f32(bReal);
+        const float32x4_t bi = vld1q_f32(bImag);
+        vst1q_f32(cReal, vmlsq_f32(vmulq_f32(ar, br), ai, bi));
+        vst1q_f32(cImag, vmlaq_f32(vmulq_f32(ar, bi), ai, br));
+        aReal += 4;
+        aImag += 4;
+        bReal += 4;
+        bImag += 4;
+        cReal += 4;
+        cImag += 4;
+    }
+
+    volk_32f_x4_complex_multiply_32f_x2_generic(
+        cReal, cImag, aReal, aImag, bReal, bImag, num_points % 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x4_complex_multiply_32f_x2_u_H */
+
+
+#ifndef INCLUDED_volk_32f_x4_complex_multiply_32f_x2_a_H
+#define INCLUDED_volk_32f_x4_complex_multiply_32f_x2_a_H
+
+#include <inttypes.h>
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_x4_complex_multiply_32f_x2_a_sse(float* cReal,
+                                                             float* cImag,
+                                                             const float* aReal,
+                                                             const float* aImag,
+                                                             const float* bReal,
+                                                             const float* bImag,
+                                                             unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const __m128 ar = _mm_load_ps(aReal);
+        const __m128 ai = _mm_load_ps(aImag);
+        const __m128 br = _mm_load_ps(bReal);
+        const __m128 bi = _mm_load_ps(bImag);
+        const __m128 re = _mm_sub_ps(_mm_mul_ps(ar, br), _mm_mul_ps(ai, bi));
+        const __m128 im = _mm_add_ps(_mm_mul_ps(ar, bi), _mm_mul_ps(ai, br));
+        _mm_store_ps(cReal, re);
+        _mm_store_ps(cImag, im);
+        aReal += 4;
+        aImag += 4;
+        bReal += 4;
+        bImag += 4;
+        cReal += 4;
+        cImag += 4;
+    }
+
+    volk_32f_x4_complex_multiply_32f_x2_generic(
+        cReal, cImag, aReal, aImag, bReal, bImag, num_points % 4);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_x4_complex_multiply_32f_x2_a_avx(float* cReal,
+                                                             float* cImag,
+                                                             const float* aReal,
+                                                             const float* aImag,
+                                                             const float* bReal,
+                                                             const float* bImag,
+                                                             unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        const __m256 ar = _mm256_load_ps(aReal);
+        const __m256 ai = _mm256_load_ps(aImag);
+        const __m256 br = _mm256_load_ps(bReal);
+        const __m256 bi = _mm256_load_ps(bImag);
+        const __m256 re = _mm256_sub_ps(_mm256_mul_ps(ar, br), _mm256_mul_ps(ai, bi));
+        const __m256 im = _mm256_add_ps(_mm256_mul_ps(ar, bi), _mm256_mul_ps(ai, br));
+        _mm256_store_ps(cReal, re);
+        _mm256_store_ps(cImag, im);
+        aReal += 8;
+        aImag += 8;
+        bReal += 8;
+        bImag += 8;
+        cReal += 8;
+        cImag += 8;
+    }
+
+    volk_32f_x4_complex_multiply_32f_x2_generic(
+        cReal, cImag, aReal, aImag, bReal, bImag, num_points % 8);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x4_complex_multiply_32f_x2_a_avx512f(float* cReal,
+                                                                 float* cImag,
+                                                                 const float* aReal,
+                                                                 const float* aImag,
+                                                                 const float* bReal,
+                                                                 const float* bImag,
+                                                                 unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 ar = _mm512_load_ps(aReal);
+        const __m512 ai = _mm512_load_ps(aImag);
+        const __m512 br = _mm512_load_ps(bReal);
+        const __m512 bi = _mm512_load_ps(bImag);
+        const __m512 re = _mm512_sub_ps(_mm512_mul_ps(ar, br), _mm512_mul_ps(ai, bi));
+        const __m512 im = _mm512_add_ps(_mm512_mul_ps(ar, bi), _mm512_mul_ps(ai, br));
+        _mm512_store_ps(cReal, re);
+        _mm512_store_ps(cImag, im);
+        aReal += 16;
+        aImag += 16;
+        bReal += 16;
+        bImag += 16;
+        cReal += 16;
+        cImag += 16;
+    }
+
+    volk_32f_x4_complex_multiply_32f_x2_generic(
+        cReal, cImag, aReal, aImag, bReal, bImag, num_points % 16);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32f_x4_complex_multiply_32f_x2_a_H */
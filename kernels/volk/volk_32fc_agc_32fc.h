@@ -0,0 +1,448 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_agc_32fc
+ *
+ * \b Overview
+ *
+ * Automatic gain control for complex signals that drives the mean output
+ * magnitude \f$ \sqrt{re^2 + im^2} \f$ towards a reference level. The gain is
+ * carried across calls in \p gain and held constant over blocks of
+ * \p block_size samples:
+ *
+ * \f$ y[n] = g_b \cdot x[n] \f$ for all n in block b
+ *
+ * \f$ e_b = \sum_{n \in b} (reference - |y[n]|) \f$
+ *
+ * \f$ g_{b+1} = \min(\max(g_b + r \cdot e_b, 0), max\_gain) \f$
+ *
+ * with \f$ r = attack\_rate \f$ when \f$ e_b < 0 \f$ and
+ * \f$ r = decay\_rate \f$ otherwise. With block_size = 1 this is the exact
+ * per-sample AGC loop; see \ref volk_32f_agc_32f for how larger blocks relate
+ * to it. The SIMD implementations are used when block_size is a multiple of
+ * their vector width and fall back to the generic implementation otherwise.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_agc_32fc(lv_32fc_t* outputVector, const lv_32fc_t* inputVector,
+ *                         float reference, float attack_rate, float decay_rate,
+ *                         float max_gain, unsigned int block_size, float* gain,
+ *                         unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The input signal.
+ * \li reference: The desired output magnitude.
+ * \li attack_rate: The adaption rate while the output is too loud.
+ * \li decay_rate: The adaption rate while the output is too quiet.
+ * \li max_gain: The upper limit of the gain.
+ * \li block_size: The number of samples the gain is held for, at least 1.
+ * \li gain: The gain applied to the first block. Updated to the gain for the
+ * next call.
+ * \li num_points: The number of samples.
+ *
+ * \b Outputs
+ * \li outputVector: The gain controlled signal.
+ *
+ * \b Example
+ * Level a quiet tone to a magnitude of about 1.
+ * \code
+ *   int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   float gain = 1.f;
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(0.1f * cosf(0.3f * ii), 0.1f * sinf(0.3f * ii));
+ *   }
+ *
+ *   volk_32fc_agc_32fc(out, in, 1.f, 1e-2f, 1e-3f, 100.f, 32, &gain, N);
+ *
+ *   printf("final gain = %f\n", gain);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_agc_32fc_u_H
+#define INCLUDED_volk_32fc_agc_32fc_u_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <volk/volk_32f_agc_32f.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_agc_32fc_generic(lv_32fc_t* outputVector,
+                                              const lv_32fc_t* inputVector,
+                                              float reference,
+                                              float attack_rate,
+                                              float decay_rate,
+                                              float max_gain,
+                                              unsigned int block_size,
+                                              float* gain,
+                                              unsigned int num_points)
+{
+    float g = *gain;
+    unsigned int number = 0;
+
+    while (number < num_points) {
+        const unsigned int left = num_points - number;
+        const unsigned int n = (left < block_size) ? left : block_size;
+        float magnitude = 0.f;
+        for (unsigned int i = 0; i < n; i++) {
+            const float re = g * lv_creal(inputVector[number + i]);
+            const float im = g * lv_cimag(inputVector[number + i]);
+            outputVector[number + i] = lv_cmake(re, im);
+            magnitude += sqrtf(re * re + im * im);
+        }
+        g = agc_32f_update(g, magnitude, n, reference, attack_rate, decay_rate, max_gain);
+        number += n;
+    }
+
+    *gain = g;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+
+static inline void volk_32fc_agc_32fc_u_sse3(lv_32fc_t* outputVector,
+                                            const lv_32fc_t* inputVector,
+                                            float reference,
+                                            float attack_rate,
+                                            float decay_rate,
+                                            float max_gain,
+                                            unsigned int block_size,
+                                            float* gain,
+                                            unsigned int num_points)
+{
+    if (block_size % 4) {
+        volk_32fc_agc_32fc_generic(outputVector,
+                                   inputVector,
+                                   reference,
+                                   attack_rate,
+                                   decay_rate,
+                                   max_gain,
+                                   block_size,
+                                   gain,
+                                   num_points);
+        return;
+    }
+
+    unsigned int number = 0;
+    const unsigned int num_blocks = num_points / block_size;
+    const unsigned int quarterBlock = block_size / 4;
+
+    const float* inputPtr = (const float*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    float g = *gain;
+
+    __m128 g_vec, x0, x1, y0, y1, acc;
+
+    for (; number < num_blocks; number++) {
+        g_vec = _mm_set1_ps(g);
+        acc = _mm_setzero_ps();
+        for (unsigned int i = 0; i < quarterBlock; i++) {
+            x0 = _mm_loadu_ps(inputPtr);
+            x1 = _mm_loadu_ps(inputPtr + 4);
+            y0 = _mm_mul_ps(x0, g_vec);
+            y1 = _mm_mul_ps(x1, g_vec);
+            _mm_storeu_ps(outputPtr, y0);
+            _mm_storeu_ps(outputPtr + 4, y1);
+            // the magnitudes come out in a different order, which the sum ignores
+            acc = _mm_add_ps(
+                acc, _mm_sqrt_ps(_mm_hadd_ps(_mm_mul_ps(y0, y0), _mm_mul_ps(y1, y1))));
+            inputPtr += 8;
+            outputPtr += 8;
+        }
+        acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+        acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+        g = agc_32f_update(g,
+                            _mm_cvtss_f32(acc),
+                            block_size,
+                            reference,
+                            attack_rate,
+                            decay_rate,
+                            max_gain);
+    }
+
+    *gain = g;
+    number = num_blocks * block_size;
+    volk_32fc_agc_32fc_generic((lv_32fc_t*)outputPtr,
+                               (const lv_32fc_t*)inputPtr,
+                               reference,
+                               attack_rate,
+                               decay_rate,
+                               max_gain,
+                               block_size,
+                               gain,
+                               num_points - number);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_agc_32fc_u_avx(lv_32fc_t* outputVector,
+                                            const lv_32fc_t* inputVector,
+                                            float reference,
+                                            float attack_rate,
+                                            float decay_rate,
+                                            float max_gain,
+                                            unsigned int block_size,
+                                            float* gain,
+                                            unsigned int num_points)
+{
+    if (block_size % 8) {
+        volk_32fc_agc_32fc_generic(outputVector,
+                                   inputVector,
+                                   reference,
+                                   attack_rate,
+                                   decay_rate,
+                                   max_gain,
+                                   block_size,
+                                   gain,
+                                   num_points);
+        return;
+    }
+
+    unsigned int number = 0;
+    const unsigned int num_blocks = num_points / block_size;
+    const unsigned int eighthBlock = block_size / 8;
+
+    const float* inputPtr = (const float*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    float g = *gain;
+
+    __m256 g_vec, x0, x1, y0, y1, power, acc;
+    __m128 sum;
+
+    for (; number < num_blocks; number++) {
+        g_vec = _mm256_set1_ps(g);
+        acc = _mm256_setzero_ps();
+        for (unsigned int i = 0; i < eighthBlock; i++) {
+            x0 = _mm256_loadu_ps(inputPtr);
+            x1 = _mm256_loadu_ps(inputPtr + 8);
+            y0 = _mm256_mul_ps(x0, g_vec);
+            y1 = _mm256_mul_ps(x1, g_vec);
+            _mm256_storeu_ps(outputPtr, y0);
+            _mm256_storeu_ps(outputPtr + 8, y1);
+            // the magnitudes come out in a different order, which the sum ignores
+            power = _mm256_hadd_ps(_mm256_mul_ps(y0, y0), _mm256_mul_ps(y1, y1));
+            acc = _mm256_add_ps(acc, _mm256_sqrt_ps(power));
+            inputPtr += 16;
+            outputPtr += 16;
+        }
+        sum = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+        g = agc_32f_update(g,
+                            _mm_cvtss_f32(sum),
+                            block_size,
+                            reference,
+                            attack_rate,
+                            decay_rate,
+                            max_gain);
+    }
+
+    *gain = g;
+    number = num_blocks * block_size;
+    volk_32fc_agc_32fc_generic((lv_32fc_t*)outputPtr,
+                               (const lv_32fc_t*)inputPtr,
+                               reference,
+                               attack_rate,
+                               decay_rate,
+                               max_gain,
+                               block_size,
+                               gain,
+                               num_points - number);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#endif /* INCLUDED_volk_32fc_agc_32fc_u_H */
+
+
+#ifndef INCLUDED_volk_32fc_agc_32fc_a_H
+#define INCLUDED_volk_32fc_agc_32fc_a_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+
+static inline void volk_32fc_agc_32fc_a_sse3(lv_32fc_t* outputVector,
+                                            const lv_32fc_t* inputVector,
+                                            float reference,
+                                            float attack_rate,
+                                            float decay_rate,
+                                            float max_gain,
+                                            unsigned int block_size,
+                                            float* gain,
+                                            unsigned int num_points)
+{
+    if (block_size % 4) {
+        volk_32fc_agc_32fc_generic(outputVector,
+                                   inputVector,
+                                   reference,
+                                   attack_rate,
+                                   decay_rate,
+                                   max_gain,
+                                   block_size,
+                                   gain,
+                                   num_points);
+        return;
+    }
+
+    unsigned int number = 0;
+    const unsigned int num_blocks = num_points / block_size;
+    const unsigned int quarterBlock = block_size / 4;
+
+    const float* inputPtr = (const float*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    float g = *gain;
+
+    __m128 g_vec, x0, x1, y0, y1, acc;
+
+    for (; number < num_blocks; number++) {
+        g_vec = _mm_set1_ps(g);
+        acc = _mm_setzero_ps();
+        for (unsigned int i = 0; i < quarterBlock; i++) {
+            x0 = _mm_load_ps(inputPtr);
+            x1 = _mm_load_ps(inputPtr + 4);
+            y0 = _mm_mul_ps(x0, g_vec);
+            y1 = _mm_mul_ps(x1, g_vec);
+            _mm_store_ps(outputPtr, y0);
+            _mm_store_ps(outputPtr + 4, y1);
+            // the magnitudes come out in a different order, which the sum ignores
+            acc = _mm_add_ps(
+                acc, _mm_sqrt_ps(_mm_hadd_ps(_mm_mul_ps(y0, y0), _mm_mul_ps(y1, y1))));
+            inputPtr += 8;
+            outputPtr += 8;
+        }
+        acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+        acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+        g = agc_32f_update(g,
+                            _mm_cvtss_f32(acc),
+                            block_size,
+                            reference,
+                            attack_rate,
+                            decay_rate,
+                            max_gain);
+    }
+
+    *gain = g;
+    number = num_blocks * block_size;
+    volk_32fc_agc_32fc_generic((lv_32fc_t*)outputPtr,
+                               (const lv_32fc_t*)inputPtr,
+                               reference,
+                               attack_rate,
+                               decay_rate,
+                               max_gain,
+                               block_size,
+                               gain,
+                               num_points - number);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_agc_32fc_a_avx(lv_32fc_t* outputVector,
+                                            const lv_32fc_t* inputVector,
+                                            float reference,
+                                            float attack_rate,
+                                            float decay_rate,
+                                            float max_gain,
+                                            unsigned int block_size,
+                                            float* gain,
+                                            unsigned int num_points)
+{
+    if (block_size % 8) {
+        volk_32fc_agc_32fc_generic(outputVector,
+                                   inputVector,
+                                   reference,
+                                   attack_rate,
+                                   decay_rate,
+                                   max_gain,
+                                   block_size,
+                                   gain,
+                                   num_points);
+        return;
+    }
+
+    unsigned int number = 0;
+    const unsigned int num_blocks = num_points / block_size;
+    const unsigned int eighthBlock = block_size / 8;
+
+    const float* inputPtr = (const float*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    float g = *gain;
+
+    __m256 g_vec, x0, x1, y0, y1, power, acc;
+    __m128 sum;
+
+    for (; number < num_blocks; number++) {
+        g_vec = _mm256_set1_ps(g);
+        acc = _mm256_setzero_ps();
+        for (unsigned int i = 0; i < eighthBlock; i++) {
+            x0 = _mm256_load_ps(inputPtr);
+            x1 = _mm256_load_ps(inputPtr + 8);
+            y0 = _mm256_mul_ps(x0, g_vec);
+            y1 = _mm256_mul_ps(x1, g_vec);
+            _mm256_store_ps(outputPtr, y0);
+            _mm256_store_ps(outputPtr + 8, y1);
+            // the magnitudes come out in a different order, which the sum ignores
+            power = _mm256_hadd_ps(_mm256_mul_ps(y0, y0), _mm256_mul_ps(y1, y1));
+            acc = _mm256_add_ps(acc, _mm256_sqrt_ps(power));
+            inputPtr += 16;
+            outputPtr += 16;
+        }
+        sum = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+        g = agc_32f_update(g,
+                            _mm_cvtss_f32(sum),
+                            block_size,
+                            reference,
+                            attack_rate,
+                            decay_rate,
+                            max_gain);
+    }
+
+    *gain = g;
+    number = num_blocks * block_size;
+    volk_32fc_agc_32fc_generic((lv_32fc_t*)outputPtr,
+                               (const lv_32fc_t*)inputPtr,
+                               reference,
+                               attack_rate,
+                               decay_rate,
+                               max_gain,
+                               block_size,
+                               gain,
+                               num_points - number);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#endif /* INCLUDED_volk_32fc_agc_32fc_a_H */
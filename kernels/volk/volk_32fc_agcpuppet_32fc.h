@@ -0,0 +1,171 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_32FC_AGCPUPPET_32FC_H
+#define INCLUDED_VOLK_32FC_AGCPUPPET_32FC_H
+
+#include <volk/volk_32f_agcpuppet_32f.h>
+#include <volk/volk_32fc_agc_32fc.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_agcpuppet_32fc_generic(lv_32fc_t* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    unsigned int num_points)
+{
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    float gain = AGCPUPPET_GAIN;
+    volk_32fc_agc_32fc_generic(outputVector,
+                               inputVector,
+                               AGCPUPPET_REFERENCE,
+                               AGCPUPPET_ATTACK,
+                               AGCPUPPET_DECAY,
+                               AGCPUPPET_MAX_GAIN,
+                               AGCPUPPET_BLOCK_LO,
+                               &gain,
+                               split);
+    volk_32fc_agc_32fc_generic(outputVector + split,
+                               inputVector + split,
+                               AGCPUPPET_REFERENCE,
+                               AGCPUPPET_ATTACK,
+                               AGCPUPPET_DECAY,
+                               AGCPUPPET_MAX_GAIN,
+                               AGCPUPPET_BLOCK_HI,
+                               &gain,
+                               num_points - split);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE3
+
+static inline void volk_32fc_agcpuppet_32fc_u_sse3(lv_32fc_t* outputVector,
+                                                   const lv_32fc_t* inputVector,
+                                                   unsigned int num_points)
+{
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    float gain = AGCPUPPET_GAIN;
+    volk_32fc_agc_32fc_u_sse3(outputVector,
+                              inputVector,
+                              AGCPUPPET_REFERENCE,
+                              AGCPUPPET_ATTACK,
+                              AGCPUPPET_DECAY,
+                              AGCPUPPET_MAX_GAIN,
+                              AGCPUPPET_BLOCK_LO,
+                              &gain,
+                              split);
+    volk_32fc_agc_32fc_u_sse3(outputVector + split,
+                              inputVector + split,
+                              AGCPUPPET_REFERENCE,
+                              AGCPUPPET_ATTACK,
+                              AGCPUPPET_DECAY,
+                              AGCPUPPET_MAX_GAIN,
+                              AGCPUPPET_BLOCK_HI,
+                              &gain,
+                              num_points - split);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+#ifdef LV_HAVE_SSE3
+
+static inline void volk_32fc_agcpuppet_32fc_a_sse3(lv_32fc_t* outputVector,
+                                                   const lv_32fc_t* inputVector,
+                                                   unsigned int num_points)
+{
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    float gain = AGCPUPPET_GAIN;
+    volk_32fc_agc_32fc_a_sse3(outputVector,
+                              inputVector,
+                              AGCPUPPET_REFERENCE,
+                              AGCPUPPET_ATTACK,
+                              AGCPUPPET_DECAY,
+                              AGCPUPPET_MAX_GAIN,
+                              AGCPUPPET_BLOCK_LO,
+                              &gain,
+                              split);
+    volk_32fc_agc_32fc_a_sse3(outputVector + split,
+                              inputVector + split,
+                              AGCPUPPET_REFERENCE,
+                              AGCPUPPET_ATTACK,
+                              AGCPUPPET_DECAY,
+                              AGCPUPPET_MAX_GAIN,
+                              AGCPUPPET_BLOCK_HI,
+                              &gain,
+                              num_points - split);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_agcpuppet_32fc_u_avx(lv_32fc_t* outputVector,
+                                                  const lv_32fc_t* inputVector,
+                                                  unsigned int num_points)
+{
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    float gain = AGCPUPPET_GAIN;
+    volk_32fc_agc_32fc_u_avx(outputVector,
+                             inputVector,
+                             AGCPUPPET_REFERENCE,
+                             AGCPUPPET_ATTACK,
+                             AGCPUPPET_DECAY,
+                             AGCPUPPET_MAX_GAIN,
+                             AGCPUPPET_BLOCK_LO,
+                             &gain,
+                             split);
+    volk_32fc_agc_32fc_u_avx(outputVector + split,
+                             inputVector + split,
+                             AGCPUPPET_REFERENCE,
+                             AGCPUPPET_ATTACK,
+                             AGCPUPPET_DECAY,
+                             AGCPUPPET_MAX_GAIN,
+                             AGCPUPPET_BLOCK_HI,
+                             &gain,
+                             num_points - split);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_agcpuppet_32fc_a_avx(lv_32fc_t* outputVector,
+                                                  const lv_32fc_t* inputVector,
+                                                  unsigned int num_points)
+{
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    float gain = AGCPUPPET_GAIN;
+    volk_32fc_agc_32fc_a_avx(outputVector,
+                             inputVector,
+                             AGCPUPPET_REFERENCE,
+                             AGCPUPPET_ATTACK,
+                             AGCPUPPET_DECAY,
+                             AGCPUPPET_MAX_GAIN,
+                             AGCPUPPET_BLOCK_LO,
+                             &gain,
+                             split);
+    volk_32fc_agc_32fc_a_avx(outputVector + split,
+                             inputVector + split,
+                             AGCPUPPET_REFERENCE,
+                             AGCPUPPET_ATTACK,
+                             AGCPUPPET_DECAY,
+                             AGCPUPPET_MAX_GAIN,
+                             AGCPUPPET_BLOCK_HI,
+                             &gain,
+                             num_points - split);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#endif /* INCLUDED_VOLK_32FC_AGCPUPPET_32FC_H */
@@ -15,6 +15,10 @@
  * Deinterleaves the complex floating point vector into I & Q vector
  * data.
  *
+ * The _nt implementations write the output with non-temporal stores, which bypass
+ * the cache. They are only faster when the output is much larger than the last
+ * level cache and not read again soon, see volk_profile -L.
+ *
  * <b>Dispatcher Prototype</b>
  * \code
  * void volk_32fc_deinterleave_32f_x2(float* iBuffer, float* qBuffer, const lv_32fc_t*
@@ -108,6 +112,82 @@ static inline void volk_32fc_deinterleave_32f_x2_a_avx(float* iBuffer,
 }
 #endif /* LV_HAVE_AVX */
 
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+static inline void volk_32fc_deinterleave_32f_x2_a_avx_nt(float* iBuffer,
+                                                          float* qBuffer,
+                                                          const lv_32fc_t* complexVector,
+                                                          unsigned int num_points)
+{
+    const float* complexVectorPtr = (float*)complexVector;
+    float* iBufferPtr = iBuffer;
+    float* qBufferPtr = qBuffer;
+
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+    for (; number < eighthPoints; number++) {
+        const __m256 cplxValue1 = _mm256_load_ps(complexVectorPtr);
+        const __m256 cplxValue2 = _mm256_load_ps(complexVectorPtr + 8);
+        complexVectorPtr += 16;
+
+        const __m256 complex1 = _mm256_permute2f128_ps(cplxValue1, cplxValue2, 0x20);
+        const __m256 complex2 = _mm256_permute2f128_ps(cplxValue1, cplxValue2, 0x31);
+
+        _mm256_stream_ps(iBufferPtr, _mm256_shuffle_ps(complex1, complex2, 0x88));
+        _mm256_stream_ps(qBufferPtr, _mm256_shuffle_ps(complex1, complex2, 0xdd));
+
+        iBufferPtr += 8;
+        qBufferPtr += 8;
+    }
+    // order the streaming stores before any later store
+    _mm_sfence();
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        *iBufferPtr++ = *complexVectorPtr++;
+        *qBufferPtr++ = *complexVectorPtr++;
+    }
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+#include <volk/volk_avx512_intrinsics.h>
+static inline void
+volk_32fc_deinterleave_32f_x2_a_avx512f_nt(float* iBuffer,
+                                           float* qBuffer,
+                                           const lv_32fc_t* complexVector,
+                                           unsigned int num_points)
+{
+    const float* complexVectorPtr = (float*)complexVector;
+    float* iBufferPtr = iBuffer;
+    float* qBufferPtr = qBuffer;
+
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+    for (; number < sixteenthPoints; number++) {
+        const __m512 cplxValue1 = _mm512_load_ps(complexVectorPtr);
+        const __m512 cplxValue2 = _mm512_load_ps(complexVectorPtr + 16);
+        complexVectorPtr += 32;
+
+        __m512 iValue, qValue;
+        _mm512_deinterleave_ps(&iValue, &qValue, cplxValue1, cplxValue2);
+        _mm512_stream_ps(iBufferPtr, iValue);
+        _mm512_stream_ps(qBufferPtr, qValue);
+
+        iBufferPtr += 16;
+        qBufferPtr += 16;
+    }
+    // order the streaming stores before any later store
+    _mm_sfence();
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *iBufferPtr++ = *complexVectorPtr++;
+        *qBufferPtr++ = *complexVectorPtr++;
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
 #ifdef LV_HAVE_SSE
 #include <xmmintrin.h>
 
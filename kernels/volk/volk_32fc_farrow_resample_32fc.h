@@ -0,0 +1,294 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_farrow_resample_32fc
+ *
+ * \b Overview
+ *
+ * Fractional-delay / arbitrary-ratio resampling of a complex signal with a
+ * Farrow structure. This is the complex variant of
+ * \ref volk_32f_farrow_resample_32f; the real Farrow coefficient matrix is
+ * applied to the real and imaginary parts alike.
+ *
+ * Output sample i is taken at the input position
+ * \f$ t_i = phase + i \cdot phase\_inc \f$. With \f$ n = \lfloor t_i \rfloor \f$,
+ * \f$ \mu = t_i - n \f$ and \f$ L = order + 1 \f$ taps, the output is
+ *
+ * \f$ y_i = \sum_{m=0}^{order} \mu^m \sum_{k=0}^{L-1} C_{m,k} \cdot x[n + k] \f$
+ *
+ * The position is carried across calls in \p phase (relative to the first
+ * input sample, in double precision) and points to the position of the next
+ * output on return. The generic implementation evaluates everything in double
+ * precision and serves as the reference for the SIMD implementations.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_farrow_resample_32fc(lv_32fc_t* outputVector,
+ *                                     const lv_32fc_t* inputVector,
+ *                                     const float* taps, unsigned int order,
+ *                                     double phase_inc, double* phase,
+ *                                     unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The input samples. Samples up to index
+ * \f$ \lfloor phase + (num\_points - 1) \cdot phase\_inc \rfloor + order \f$ are read.
+ * \li taps: The (order + 1) x (order + 1) Farrow coefficient matrix, row-major, row m
+ * holding the coefficients of \f$ \mu^m \f$.
+ * \li order: The polynomial order (at least 1).
+ * \li phase_inc: The input-sample step between two outputs, i.e. the inverse of the
+ * resampling ratio. Must be positive.
+ * \li phase: The position of the first output, must not be negative. Updated to the
+ * position of the next output.
+ * \li num_points: The number of output points.
+ *
+ * \b Outputs
+ * \li outputVector: The resampled signal.
+ *
+ * \b Example
+ * Delay a complex exponential by a quarter sample with a linear interpolator.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*(N + 1), alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   const float taps[4] = { 1.f, 0.f,
+ *                          -1.f, 1.f };
+ *   double phase = 0.25;
+ *
+ *   for(unsigned int ii = 0; ii < N + 1; ++ii){
+ *       in[ii] = lv_cmake(cosf(0.1f * ii), sinf(0.1f * ii));
+ *   }
+ *
+ *   volk_32fc_farrow_resample_32fc(out, in, taps, 1, 1.0, &phase, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.2f %+1.2fj\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_farrow_resample_32fc_u_H
+#define INCLUDED_volk_32fc_farrow_resample_32fc_u_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_farrow_resample_32fc_generic(lv_32fc_t* outputVector,
+                                                          const lv_32fc_t* inputVector,
+                                                          const float* taps,
+                                                          unsigned int order,
+                                                          double phase_inc,
+                                                          double* phase,
+                                                          unsigned int num_points)
+{
+    const unsigned int num_taps = order + 1;
+    const double start = *phase;
+
+    for (unsigned int number = 0; number < num_points; number++) {
+        const double t = start + (double)number * phase_inc;
+        const double n = floor(t);
+        const double mu = t - n;
+        const lv_32fc_t* x = inputVector + (unsigned int)n;
+
+        // Horner over the polynomial branches of the Farrow structure
+        double y_re = 0.0;
+        double y_im = 0.0;
+        for (int m = (int)order; m >= 0; m--) {
+            const float* row = taps + m * num_taps;
+            double v_re = 0.0;
+            double v_im = 0.0;
+            for (unsigned int k = 0; k < num_taps; k++) {
+                v_re += (double)row[k] * (double)lv_creal(x[k]);
+                v_im += (double)row[k] * (double)lv_cimag(x[k]);
+            }
+            y_re = y_re * mu + v_re;
+            y_im = y_im * mu + v_im;
+        }
+        outputVector[number] = lv_cmake((float)y_re, (float)y_im);
+    }
+
+    *phase = start + (double)num_points * phase_inc;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_farrow_resample_32fc_u_avx2_fma(lv_32fc_t* outputVector,
+                                                             const lv_32fc_t* inputVector,
+                                                             const float* taps,
+                                                             unsigned int order,
+                                                             double phase_inc,
+                                                             double* phase,
+                                                             unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+    const unsigned int num_taps = order + 1;
+    const double start = *phase;
+
+    float* outputPtr = (float*)outputVector;
+    // each complex sample is gathered as one 64-bit element
+    const double* inputPtr = (const double*)inputVector;
+
+    const __m256d ramp_lo = _mm256_mul_pd(_mm256_set1_pd(phase_inc),
+                                          _mm256_setr_pd(0.0, 1.0, 2.0, 3.0));
+    const __m256d ramp_hi = _mm256_mul_pd(_mm256_set1_pd(phase_inc),
+                                          _mm256_setr_pd(4.0, 5.0, 6.0, 7.0));
+    // duplicate each weight onto the real and imaginary slot
+    const __m256i dup_lo = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    const __m256i dup_hi = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+
+    __m256d t, t_lo, t_hi, n_lo, n_hi;
+    __m256 mu, weight, x0, x1, y0, y1;
+    __m128i index0, index1;
+
+    for (; number < eighthPoints; number++) {
+        // positions are resolved in double, only mu drops to single precision
+        t = _mm256_set1_pd(start + (double)(number * 8) * phase_inc);
+        t_lo = _mm256_add_pd(t, ramp_lo);
+        t_hi = _mm256_add_pd(t, ramp_hi);
+        n_lo = _mm256_floor_pd(t_lo);
+        n_hi = _mm256_floor_pd(t_hi);
+        mu = _mm256_set_m128(_mm256_cvtpd_ps(_mm256_sub_pd(t_hi, n_hi)),
+                             _mm256_cvtpd_ps(_mm256_sub_pd(t_lo, n_lo)));
+        index0 = _mm256_cvttpd_epi32(n_lo);
+        index1 = _mm256_cvttpd_epi32(n_hi);
+
+        // y = sum_k x[n + k] * l_k(mu), with l_k evaluated by Horner's scheme
+        y0 = _mm256_setzero_ps();
+        y1 = _mm256_setzero_ps();
+        for (unsigned int k = 0; k < num_taps; k++) {
+            x0 = _mm256_castpd_ps(_mm256_i32gather_pd(inputPtr + k, index0, 8));
+            x1 = _mm256_castpd_ps(_mm256_i32gather_pd(inputPtr + k, index1, 8));
+            weight = _mm256_set1_ps(taps[order * num_taps + k]);
+            for (int m = (int)order - 1; m >= 0; m--) {
+                weight =
+                    _mm256_fmadd_ps(weight, mu, _mm256_set1_ps(taps[m * num_taps + k]));
+            }
+            y0 = _mm256_fmadd_ps(x0, _mm256_permutevar8x32_ps(weight, dup_lo), y0);
+            y1 = _mm256_fmadd_ps(x1, _mm256_permutevar8x32_ps(weight, dup_hi), y1);
+        }
+        _mm256_storeu_ps(outputPtr, y0);
+        _mm256_storeu_ps(outputPtr + 8, y1);
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    *phase = start + (double)number * phase_inc;
+    volk_32fc_farrow_resample_32fc_generic((lv_32fc_t*)outputPtr,
+                                           inputVector,
+                                           taps,
+                                           order,
+                                           phase_inc,
+                                           phase,
+                                           num_points - number);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#endif /* INCLUDED_volk_32fc_farrow_resample_32fc_u_H */
+
+
+#ifndef INCLUDED_volk_32fc_farrow_resample_32fc_a_H
+#define INCLUDED_volk_32fc_farrow_resample_32fc_a_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <volk/volk_complex.h>
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_farrow_resample_32fc_a_avx2_fma(lv_32fc_t* outputVector,
+                                                             const lv_32fc_t* inputVector,
+                                                             const float* taps,
+                                                             unsigned int order,
+                                                             double phase_inc,
+                                                             double* phase,
+                                                             unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+    const unsigned int num_taps = order + 1;
+    const double start = *phase;
+
+    float* outputPtr = (float*)outputVector;
+    // each complex sample is gathered as one 64-bit element
+    const double* inputPtr = (const double*)inputVector;
+
+    const __m256d ramp_lo = _mm256_mul_pd(_mm256_set1_pd(phase_inc),
+                                          _mm256_setr_pd(0.0, 1.0, 2.0, 3.0));
+    const __m256d ramp_hi = _mm256_mul_pd(_mm256_set1_pd(phase_inc),
+                                          _mm256_setr_pd(4.0, 5.0, 6.0, 7.0));
+    // duplicate each weight onto the real and imaginary slot
+    const __m256i dup_lo = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    const __m256i dup_hi = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+
+    __m256d t, t_lo, t_hi, n_lo, n_hi;
+    __m256 mu, weight, x0, x1, y0, y1;
+    __m128i index0, index1;
+
+    for (; number < eighthPoints; number++) {
+        // positions are resolved in double, only mu drops to single precision
+        t = _mm256_set1_pd(start + (double)(number * 8) * phase_inc);
+        t_lo = _mm256_add_pd(t, ramp_lo);
+        t_hi = _mm256_add_pd(t, ramp_hi);
+        n_lo = _mm256_floor_pd(t_lo);
+        n_hi = _mm256_floor_pd(t_hi);
+        mu = _mm256_set_m128(_mm256_cvtpd_ps(_mm256_sub_pd(t_hi, n_hi)),
+                             _mm256_cvtpd_ps(_mm256_sub_pd(t_lo, n_lo)));
+        index0 = _mm256_cvttpd_epi32(n_lo);
+        index1 = _mm256_cvttpd_epi32(n_hi);
+
+        // y = sum_k x[n + k] * l_k(mu), with l_k evaluated by Horner's scheme
+        y0 = _mm256_setzero_ps();
+        y1 = _mm256_setzero_ps();
+        for (unsigned int k = 0; k < num_taps; k++) {
+            x0 = _mm256_castpd_ps(_mm256_i32gather_pd(inputPtr + k, index0, 8));
+            x1 = _mm256_castpd_ps(_mm256_i32gather_pd(inputPtr + k, index1, 8));
+            weight = _mm256_set1_ps(taps[order * num_taps + k]);
+            for (int m = (int)order - 1; m >= 0; m--) {
+                weight =
+                    _mm256_fmadd_ps(weight, mu, _mm256_set1_ps(taps[m * num_taps + k]));
+            }
+            y0 = _mm256_fmadd_ps(x0, _mm256_permutevar8x32_ps(weight, dup_lo), y0);
+            y1 = _mm256_fmadd_ps(x1, _mm256_permutevar8x32_ps(weight, dup_hi), y1);
+        }
+        _mm256_store_ps(outputPtr, y0);
+        _mm256_store_ps(outputPtr + 8, y1);
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    *phase = start + (double)number * phase_inc;
+    volk_32fc_farrow_resample_32fc_generic((lv_32fc_t*)outputPtr,
+                                           inputVector,
+                                           taps,
+                                           order,
+                                           phase_inc,
+                                           phase,
+                                           num_points - number);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#endif /* INCLUDED_volk_32fc_farrow_resample_32fc_a_H */
@@ -0,0 +1,136 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_32FC_FARROW_RESAMPLEPUPPET_32FC_H
+#define INCLUDED_VOLK_32FC_FARROW_RESAMPLEPUPPET_32FC_H
+
+#include <volk/volk_32f_farrow_resamplepuppet_32f.h>
+#include <volk/volk_32fc_farrow_resample_32fc.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_farrow_resamplepuppet_32fc_generic(lv_32fc_t* outputVector,
+                                             const lv_32fc_t* inputVector,
+                                             unsigned int num_points)
+{
+    float taps_lo[(FARROW_RESAMPLEPUPPET_ORDER_LO + 1) *
+                  (FARROW_RESAMPLEPUPPET_ORDER_LO + 1)];
+    float taps_hi[(FARROW_RESAMPLEPUPPET_ORDER_HI + 1) *
+                  (FARROW_RESAMPLEPUPPET_ORDER_HI + 1)];
+    farrow_resamplepuppet_lagrange_taps(taps_lo, FARROW_RESAMPLEPUPPET_ORDER_LO);
+    farrow_resamplepuppet_lagrange_taps(taps_hi, FARROW_RESAMPLEPUPPET_ORDER_HI);
+
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    const double inc_lo = farrow_resamplepuppet_phase_inc(split,
+                                                          FARROW_RESAMPLEPUPPET_ORDER_LO);
+    const double inc_hi = farrow_resamplepuppet_phase_inc(num_points - split,
+                                                          FARROW_RESAMPLEPUPPET_ORDER_HI);
+    double phase = FARROW_RESAMPLEPUPPET_PHASE;
+    volk_32fc_farrow_resample_32fc_generic(outputVector,
+                                           inputVector,
+                                           taps_lo,
+                                           FARROW_RESAMPLEPUPPET_ORDER_LO,
+                                           inc_lo,
+                                           &phase,
+                                           split);
+    phase = FARROW_RESAMPLEPUPPET_PHASE;
+    volk_32fc_farrow_resample_32fc_generic(outputVector + split,
+                                           inputVector + split,
+                                           taps_hi,
+                                           FARROW_RESAMPLEPUPPET_ORDER_HI,
+                                           inc_hi,
+                                           &phase,
+                                           num_points - split);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void
+volk_32fc_farrow_resamplepuppet_32fc_u_avx2_fma(lv_32fc_t* outputVector,
+                                                const lv_32fc_t* inputVector,
+                                                unsigned int num_points)
+{
+    float taps_lo[(FARROW_RESAMPLEPUPPET_ORDER_LO + 1) *
+                  (FARROW_RESAMPLEPUPPET_ORDER_LO + 1)];
+    float taps_hi[(FARROW_RESAMPLEPUPPET_ORDER_HI + 1) *
+                  (FARROW_RESAMPLEPUPPET_ORDER_HI + 1)];
+    farrow_resamplepuppet_lagrange_taps(taps_lo, FARROW_RESAMPLEPUPPET_ORDER_LO);
+    farrow_resamplepuppet_lagrange_taps(taps_hi, FARROW_RESAMPLEPUPPET_ORDER_HI);
+
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    const double inc_lo = farrow_resamplepuppet_phase_inc(split,
+                                                          FARROW_RESAMPLEPUPPET_ORDER_LO);
+    const double inc_hi = farrow_resamplepuppet_phase_inc(num_points - split,
+                                                          FARROW_RESAMPLEPUPPET_ORDER_HI);
+    double phase = FARROW_RESAMPLEPUPPET_PHASE;
+    volk_32fc_farrow_resample_32fc_u_avx2_fma(outputVector,
+                                              inputVector,
+                                              taps_lo,
+                                              FARROW_RESAMPLEPUPPET_ORDER_LO,
+                                              inc_lo,
+                                              &phase,
+                                              split);
+    phase = FARROW_RESAMPLEPUPPET_PHASE;
+    volk_32fc_farrow_resample_32fc_u_avx2_fma(outputVector + split,
+                                              inputVector + split,
+                                              taps_hi,
+                                              FARROW_RESAMPLEPUPPET_ORDER_HI,
+                                              inc_hi,
+                                              &phase,
+                                              num_points - split);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void
+volk_32fc_farrow_resamplepuppet_32fc_a_avx2_fma(lv_32fc_t* outputVector,
+                                                const lv_32fc_t* inputVector,
+                                                unsigned int num_points)
+{
+    float taps_lo[(FARROW_RESAMPLEPUPPET_ORDER_LO + 1) *
+                  (FARROW_RESAMPLEPUPPET_ORDER_LO + 1)];
+    float taps_hi[(FARROW_RESAMPLEPUPPET_ORDER_HI + 1) *
+                  (FARROW_RESAMPLEPUPPET_ORDER_HI + 1)];
+    farrow_resamplepuppet_lagrange_taps(taps_lo, FARROW_RESAMPLEPUPPET_ORDER_LO);
+    farrow_resamplepuppet_lagrange_taps(taps_hi, FARROW_RESAMPLEPUPPET_ORDER_HI);
+
+    // keep the second half on an alignment boundary for the aligned kernels
+    const unsigned int split = (num_points / 2) & ~15u;
+    const double inc_lo = farrow_resamplepuppet_phase_inc(split,
+                                                          FARROW_RESAMPLEPUPPET_ORDER_LO);
+    const double inc_hi = farrow_resamplepuppet_phase_inc(num_points - split,
+                                                          FARROW_RESAMPLEPUPPET_ORDER_HI);
+    double phase = FARROW_RESAMPLEPUPPET_PHASE;
+    volk_32fc_farrow_resample_32fc_a_avx2_fma(outputVector,
+                                              inputVector,
+                                              taps_lo,
+                                              FARROW_RESAMPLEPUPPET_ORDER_LO,
+                                              inc_lo,
+                                              &phase,
+                                              split);
+    phase = FARROW_RESAMPLEPUPPET_PHASE;
+    volk_32fc_farrow_resample_32fc_a_avx2_fma(outputVector + split,
+                                              inputVector + split,
+                                              taps_hi,
+                                              FARROW_RESAMPLEPUPPET_ORDER_HI,
+                                              inc_hi,
+                                              &phase,
+                                              num_points - split);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#endif /* INCLUDED_VOLK_32FC_FARROW_RESAMPLEPUPPET_32FC_H */
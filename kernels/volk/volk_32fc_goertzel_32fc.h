@@ -0,0 +1,249 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_goertzel_32fc
+ *
+ * \b Overview
+ *
+ * Evaluates the DTFT of the input at a set of arbitrary frequencies with the
+ * Goertzel algorithm. This is a cheap replacement for a full FFT when only a
+ * few bins are of interest, e.g. for tone detection or pilot tracking:
+ *
+ * \f$ bins[k] = \sum_{n=0}^{N-1} x[n] \cdot e^{-j \omega_k n} \f$
+ *
+ * Each bin runs the second-order recursion
+ * \f$ s[n] = x[n] + 2\cos(\omega_k) s[n-1] - s[n-2] \f$ over all samples; the
+ * final correction to a complex bin value is done once per bin in double
+ * precision. The SIMD implementations run one bin per lane, so the cost is
+ * dominated by a real multiply and two adds per sample and bin.
+ *
+ * The recursion accumulates rounding errors that grow with the block length and
+ * towards \f$ \omega = 0 \f$ and \f$ \omega = \pi \f$. For long signals, evaluate
+ * blocks of a few thousand samples and combine them.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_goertzel_32fc(lv_32fc_t* bins, const lv_32fc_t* inputVector,
+ *                              const float* freqs, unsigned int num_bins,
+ *                              unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The input signal.
+ * \li freqs: The frequencies to evaluate in radians per sample.
+ * \li num_bins: The number of frequencies.
+ * \li num_points: The number of samples in inputVector.
+ *
+ * \b Outputs
+ * \li bins: The num_bins complex bin values.
+ *
+ * \b Example
+ * Look for a tone at 0.4 rad/sample next to two empty bins.
+ * \code
+ *   int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t bins[3];
+ *   const float freqs[3] = { 0.2f, 0.4f, 0.6f };
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(cosf(0.4f * ii), sinf(0.4f * ii));
+ *   }
+ *
+ *   volk_32fc_goertzel_32fc(bins, in, freqs, 3, N);
+ *
+ *   for(unsigned int ii = 0; ii < 3; ++ii){
+ *       printf("|X(%1.1f)|^2 = %f\n", freqs[ii],
+ *              lv_creal(bins[ii]) * lv_creal(bins[ii]) +
+ *              lv_cimag(bins[ii]) * lv_cimag(bins[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_goertzel_32fc_u_H
+#define INCLUDED_volk_32fc_goertzel_32fc_u_H
+
+#include <math.h>
+#include <stdio.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+// Turns the final Goertzel states s[N-1] (s1) and s[N-2] (s2) into the bin value
+// e^{-j w (N-1)} (s1 - e^{-j w} s2).
+static inline lv_32fc_t goertzel_32fc_bin(float freq,
+                                          float s1_re,
+                                          float s1_im,
+                                          float s2_re,
+                                          float s2_im,
+                                          unsigned int num_points)
+{
+    const double cos_w = cos((double)freq);
+    const double sin_w = sin((double)freq);
+    const double y_re = s1_re - (cos_w * s2_re + sin_w * s2_im);
+    const double y_im = s1_im - (cos_w * s2_im - sin_w * s2_re);
+    const double shift = num_points ? (double)freq * (double)(num_points - 1) : 0.0;
+    const double cos_shift = cos(shift);
+    const double sin_shift = sin(shift);
+    return lv_cmake((float)(cos_shift * y_re + sin_shift * y_im),
+                    (float)(cos_shift * y_im - sin_shift * y_re));
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_goertzel_32fc_generic(lv_32fc_t* bins,
+                                                   const lv_32fc_t* inputVector,
+                                                   const float* freqs,
+                                                   unsigned int num_bins,
+                                                   unsigned int num_points)
+{
+    for (unsigned int k = 0; k < num_bins; k++) {
+        const float coeff = 2.f * cosf(freqs[k]);
+        float s0_re, s0_im;
+        float s1_re = 0.f, s1_im = 0.f;
+        float s2_re = 0.f, s2_im = 0.f;
+        for (unsigned int number = 0; number < num_points; number++) {
+            s0_re = lv_creal(inputVector[number]) + coeff * s1_re - s2_re;
+            s0_im = lv_cimag(inputVector[number]) + coeff * s1_im - s2_im;
+            s2_re = s1_re;
+            s2_im = s1_im;
+            s1_re = s0_re;
+            s1_im = s0_im;
+        }
+        bins[k] = goertzel_32fc_bin(freqs[k], s1_re, s1_im, s2_re, s2_im, num_points);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32fc_goertzel_32fc_sse(lv_32fc_t* bins,
+                                               const lv_32fc_t* inputVector,
+                                               const float* freqs,
+                                               unsigned int num_bins,
+                                               unsigned int num_points)
+{
+    unsigned int k = 0;
+    // the last group is padded with idle lanes instead of a scalar tail
+    const unsigned int quarterGroups = (num_bins + 3) / 4;
+    const float* inputPtr = (const float*)inputVector;
+
+    __VOLK_ATTR_ALIGNED(16) float coeffs[4];
+    __VOLK_ATTR_ALIGNED(16) float state[16];
+    __m128 coeff, x_re, x_im, s0_re, s0_im, s1_re, s1_im, s2_re, s2_im;
+
+    // one bin per lane, real and imaginary states kept in separate registers
+    for (; k < quarterGroups; k++) {
+        const unsigned int lanes = (num_bins - 4 * k < 4) ? num_bins - 4 * k : 4;
+        for (unsigned int i = 0; i < 4; i++) {
+            coeffs[i] = (i < lanes) ? 2.f * cosf(freqs[4 * k + i]) : 0.f;
+        }
+        coeff = _mm_load_ps(coeffs);
+        s1_re = _mm_setzero_ps();
+        s1_im = _mm_setzero_ps();
+        s2_re = _mm_setzero_ps();
+        s2_im = _mm_setzero_ps();
+
+        for (unsigned int number = 0; number < num_points; number++) {
+            x_re = _mm_load1_ps(inputPtr + 2 * number);
+            x_im = _mm_load1_ps(inputPtr + 2 * number + 1);
+            s0_re = _mm_add_ps(x_re, _mm_mul_ps(coeff, s1_re));
+            s0_im = _mm_add_ps(x_im, _mm_mul_ps(coeff, s1_im));
+            s0_re = _mm_sub_ps(s0_re, s2_re);
+            s0_im = _mm_sub_ps(s0_im, s2_im);
+            s2_re = s1_re;
+            s2_im = s1_im;
+            s1_re = s0_re;
+            s1_im = s0_im;
+        }
+
+        _mm_store_ps(state, s1_re);
+        _mm_store_ps(state + 4, s1_im);
+        _mm_store_ps(state + 8, s2_re);
+        _mm_store_ps(state + 12, s2_im);
+        for (unsigned int i = 0; i < lanes; i++) {
+            bins[4 * k + i] = goertzel_32fc_bin(freqs[4 * k + i],
+                                                state[i],
+                                                state[4 + i],
+                                                state[8 + i],
+                                                state[12 + i],
+                                                num_points);
+        }
+    }
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_goertzel_32fc_avx(lv_32fc_t* bins,
+                                               const lv_32fc_t* inputVector,
+                                               const float* freqs,
+                                               unsigned int num_bins,
+                                               unsigned int num_points)
+{
+    unsigned int k = 0;
+    // the last group is padded with idle lanes instead of a scalar tail
+    const unsigned int eighthGroups = (num_bins + 7) / 8;
+    const float* inputPtr = (const float*)inputVector;
+
+    __VOLK_ATTR_ALIGNED(32) float coeffs[8];
+    __VOLK_ATTR_ALIGNED(32) float state[32];
+    __m256 coeff, x_re, x_im, s0_re, s0_im, s1_re, s1_im, s2_re, s2_im;
+
+    // one bin per lane, real and imaginary states kept in separate registers
+    for (; k < eighthGroups; k++) {
+        const unsigned int lanes = (num_bins - 8 * k < 8) ? num_bins - 8 * k : 8;
+        for (unsigned int i = 0; i < 8; i++) {
+            coeffs[i] = (i < lanes) ? 2.f * cosf(freqs[8 * k + i]) : 0.f;
+        }
+        coeff = _mm256_load_ps(coeffs);
+        s1_re = _mm256_setzero_ps();
+        s1_im = _mm256_setzero_ps();
+        s2_re = _mm256_setzero_ps();
+        s2_im = _mm256_setzero_ps();
+
+        for (unsigned int number = 0; number < num_points; number++) {
+            x_re = _mm256_broadcast_ss(inputPtr + 2 * number);
+            x_im = _mm256_broadcast_ss(inputPtr + 2 * number + 1);
+            s0_re = _mm256_add_ps(x_re, _mm256_mul_ps(coeff, s1_re));
+            s0_im = _mm256_add_ps(x_im, _mm256_mul_ps(coeff, s1_im));
+            s0_re = _mm256_sub_ps(s0_re, s2_re);
+            s0_im = _mm256_sub_ps(s0_im, s2_im);
+            s2_re = s1_re;
+            s2_im = s1_im;
+            s1_re = s0_re;
+            s1_im = s0_im;
+        }
+
+        _mm256_store_ps(state, s1_re);
+        _mm256_store_ps(state + 8, s1_im);
+        _mm256_store_ps(state + 16, s2_re);
+        _mm256_store_ps(state + 24, s2_im);
+        for (unsigned int i = 0; i < lanes; i++) {
+            bins[8 * k + i] = goertzel_32fc_bin(freqs[8 * k + i],
+                                                state[i],
+                                                state[8 + i],
+                                                state[16 + i],
+                                                state[24 + i],
+                                                num_points);
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+#endif /* INCLUDED_volk_32fc_goertzel_32fc_u_H */
@@ -0,0 +1,103 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_32FC_GOERTZELPUPPET_32FC_H
+#define INCLUDED_VOLK_32FC_GOERTZELPUPPET_32FC_H
+
+#include <volk/volk_32fc_goertzel_32fc.h>
+
+// Every GOERTZELPUPPET_BLOCK outputs hold as many off-grid bins, evaluated over
+// the GOERTZELPUPPET_WINDOW samples starting at the same offset (or what is left
+// of the input).
+#define GOERTZELPUPPET_BLOCK 37
+#define GOERTZELPUPPET_WINDOW 296
+
+static inline void goertzelpuppet_freqs(float* freqs)
+{
+    for (unsigned int k = 0; k < GOERTZELPUPPET_BLOCK; k++) {
+        freqs[k] = 0.17f + 0.163f * (float)k;
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_goertzelpuppet_32fc_generic(lv_32fc_t* outputVector,
+                                                         const lv_32fc_t* inputVector,
+                                                         unsigned int num_points)
+{
+    float freqs[GOERTZELPUPPET_BLOCK];
+    goertzelpuppet_freqs(freqs);
+
+    for (unsigned int number = 0; number < num_points; number += GOERTZELPUPPET_BLOCK) {
+        const unsigned int left = num_points - number;
+        const unsigned int bins =
+            (left < GOERTZELPUPPET_BLOCK) ? left : GOERTZELPUPPET_BLOCK;
+        const unsigned int window =
+            (left < GOERTZELPUPPET_WINDOW) ? left : GOERTZELPUPPET_WINDOW;
+        volk_32fc_goertzel_32fc_generic(outputVector + number,
+                                        inputVector + number,
+                                        freqs,
+                                        bins,
+                                        window);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32fc_goertzelpuppet_32fc_sse(lv_32fc_t* outputVector,
+                                                     const lv_32fc_t* inputVector,
+                                                     unsigned int num_points)
+{
+    float freqs[GOERTZELPUPPET_BLOCK];
+    goertzelpuppet_freqs(freqs);
+
+    for (unsigned int number = 0; number < num_points; number += GOERTZELPUPPET_BLOCK) {
+        const unsigned int left = num_points - number;
+        const unsigned int bins =
+            (left < GOERTZELPUPPET_BLOCK) ? left : GOERTZELPUPPET_BLOCK;
+        const unsigned int window =
+            (left < GOERTZELPUPPET_WINDOW) ? left : GOERTZELPUPPET_WINDOW;
+        volk_32fc_goertzel_32fc_sse(outputVector + number,
+                                    inputVector + number,
+                                    freqs,
+                                    bins,
+                                    window);
+    }
+}
+
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_goertzelpuppet_32fc_avx(lv_32fc_t* outputVector,
+                                                     const lv_32fc_t* inputVector,
+                                                     unsigned int num_points)
+{
+    float freqs[GOERTZELPUPPET_BLOCK];
+    goertzelpuppet_freqs(freqs);
+
+    for (unsigned int number = 0; number < num_points; number += GOERTZELPUPPET_BLOCK) {
+        const unsigned int left = num_points - number;
+        const unsigned int bins =
+            (left < GOERTZELPUPPET_BLOCK) ? left : GOERTZELPUPPET_BLOCK;
+        const unsigned int window =
+            (left < GOERTZELPUPPET_WINDOW) ? left : GOERTZELPUPPET_WINDOW;
+        volk_32fc_goertzel_32fc_avx(outputVector + number,
+                                    inputVector + number,
+                                    freqs,
+                                    bins,
+                                    window);
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+#endif /* INCLUDED_VOLK_32FC_GOERTZELPUPPET_32FC_H */
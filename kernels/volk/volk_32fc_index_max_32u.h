@@ -321,6 +321,57 @@ volk_32fc_index_max_32u_generic(uint32_t* target, lv_32fc_t* src0, uint32_t num_
 
 #endif /*LV_HAVE_GENERIC*/
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_index_max_32u_a_avx512f(uint32_t* target,
+                                                     lv_32fc_t* src0,
+                                                     uint32_t num_points)
+{
+    const __m512i indices_increment = _mm512_set1_epi32(16);
+    // indices of the complex numbers loaded from memory in the current iteration
+    __m512i current_indices =
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    __m512 max_values = _mm512_setzero_ps();
+    __m512i max_indices = _mm512_setzero_si512();
+
+    for (unsigned i = 0; i < num_points / 16u; ++i) {
+        const __m512 in0 = _mm512_load_ps((float*)src0);
+        const __m512 in1 = _mm512_load_ps((float*)(src0 + 8));
+        vector_32fc_index_max_avx512f(in0,
+                                      in1,
+                                      0xffff,
+                                      &max_values,
+                                      &max_indices,
+                                      &current_indices,
+                                      indices_increment);
+        src0 += 16;
+    }
+
+    // handle tail not processed by the vectorized loop
+    const unsigned int remainder = num_points % 16;
+    if (remainder) {
+        const unsigned int remainder0 = remainder > 8 ? 8 : remainder;
+        const __mmask16 mask0 = _mm512_complex_tail_mask_ps(remainder0);
+        const __mmask16 mask1 = _mm512_complex_tail_mask_ps(remainder - remainder0);
+        const __m512 in0 = _mm512_maskz_loadu_ps(mask0, (float*)src0);
+        const __m512 in1 = _mm512_maskz_loadu_ps(mask1, (float*)(src0 + 8));
+        vector_32fc_index_max_avx512f(in0,
+                                      in1,
+                                      _mm512_tail_mask_ps(remainder),
+                                      &max_values,
+                                      &max_indices,
+                                      &current_indices,
+                                      indices_increment);
+    }
+
+    *target = _mm512_index_max_reduce_ps(max_values, max_indices);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
 #endif /*INCLUDED_volk_32fc_index_max_32u_a_H*/
 
 #ifndef INCLUDED_volk_32fc_index_max_32u_u_H
@@ -509,4 +560,55 @@ volk_32fc_index_max_32u_neon(uint32_t* target, lv_32fc_t* src0, uint32_t num_poi
 
 #endif /*LV_HAVE_NEON*/
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_index_max_32u_u_avx512f(uint32_t* target,
+                                                     lv_32fc_t* src0,
+                                                     uint32_t num_points)
+{
+    const __m512i indices_increment = _mm512_set1_epi32(16);
+    // indices of the complex numbers loaded from memory in the current iteration
+    __m512i current_indices =
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    __m512 max_values = _mm512_setzero_ps();
+    __m512i max_indices = _mm512_setzero_si512();
+
+    for (unsigned i = 0; i < num_points / 16u; ++i) {
+        const __m512 in0 = _mm512_loadu_ps((float*)src0);
+        const __m512 in1 = _mm512_loadu_ps((float*)(src0 + 8));
+        vector_32fc_index_max_avx512f(in0,
+                                      in1,
+                                      0xffff,
+                                      &max_values,
+                                      &max_indices,
+                                      &current_indices,
+                                      indices_increment);
+        src0 += 16;
+    }
+
+    // handle tail not processed by the vectorized loop
+    const unsigned int remainder = num_points % 16;
+    if (remainder) {
+        const unsigned int remainder0 = remainder > 8 ? 8 : remainder;
+        const __mmask16 mask0 = _mm512_complex_tail_mask_ps(remainder0);
+        const __mmask16 mask1 = _mm512_complex_tail_mask_ps(remainder - remainder0);
+        const __m512 in0 = _mm512_maskz_loadu_ps(mask0, (float*)src0);
+        const __m512 in1 = _mm512_maskz_loadu_ps(mask1, (float*)(src0 + 8));
+        vector_32fc_index_max_avx512f(in0,
+                                      in1,
+                                      _mm512_tail_mask_ps(remainder),
+                                      &max_values,
+                                      &max_indices,
+                                      &current_indices,
+                                      indices_increment);
+    }
+
+    *target = _mm512_index_max_reduce_ps(max_values, max_indices);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
 #endif /*INCLUDED_volk_32fc_index_max_32u_u_H*/
@@ -57,6 +57,7 @@
 #ifndef INCLUDED_volk_32fc_index_min_32u_a_H
 #define INCLUDED_volk_32fc_index_min_32u_a_H
 
+#include <float.h>
 #include <inttypes.h>
 #include <stdio.h>
 #include <volk/volk_common.h>
@@ -321,6 +322,7 @@ static inline void volk_32fc_index_min_32u_generic(uint32_t* target,
 #ifndef INCLUDED_volk_32fc_index_min_32u_u_H
 #define INCLUDED_volk_32fc_index_min_32u_u_H
 
+#include <float.h>
 #include <inttypes.h>
 #include <stdio.h>
 #include <volk/volk_common.h>
@@ -191,6 +191,43 @@ static inline void volk_32fc_magnitude_32f_generic(float* magnitudeVector,
 #endif /* LV_HAVE_GENERIC */
 
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_magnitude_32f_u_avx512f(float* magnitudeVector,
+                                                     const lv_32fc_t* complexVector,
+                                                     unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int remainder = num_points % 16;
+
+    const float* complexVectorPtr = (const float*)complexVector;
+    float* magnitudeVectorPtr = magnitudeVector;
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 cplxValue1 = _mm512_loadu_ps(complexVectorPtr);
+        const __m512 cplxValue2 = _mm512_loadu_ps(complexVectorPtr + 16);
+        _mm512_storeu_ps(magnitudeVectorPtr, _mm512_magnitude_ps(cplxValue1, cplxValue2));
+
+        complexVectorPtr += 32;
+        magnitudeVectorPtr += 16;
+    }
+
+    if (remainder) {
+        const unsigned int remainder1 = remainder > 8 ? 8 : remainder;
+        const __mmask16 mask1 = _mm512_complex_tail_mask_ps(remainder1);
+        const __mmask16 mask2 = _mm512_complex_tail_mask_ps(remainder - remainder1);
+        const __m512 cplxValue1 = _mm512_maskz_loadu_ps(mask1, complexVectorPtr);
+        const __m512 cplxValue2 = _mm512_maskz_loadu_ps(mask2, complexVectorPtr + 16);
+        _mm512_mask_storeu_ps(magnitudeVectorPtr,
+                              _mm512_tail_mask_ps(remainder),
+                              _mm512_magnitude_ps(cplxValue1, cplxValue2));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
 #endif /* INCLUDED_volk_32fc_magnitude_32f_u_H */
 #ifndef INCLUDED_volk_32fc_magnitude_32f_a_H
 #define INCLUDED_volk_32fc_magnitude_32f_a_H
@@ -454,4 +491,41 @@ static inline void volk_32fc_magnitude_32f_u_orc(float* magnitudeVector,
 #endif /* LV_HAVE_ORC */
 
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_magnitude_32f_a_avx512f(float* magnitudeVector,
+                                                     const lv_32fc_t* complexVector,
+                                                     unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int remainder = num_points % 16;
+
+    const float* complexVectorPtr = (const float*)complexVector;
+    float* magnitudeVectorPtr = magnitudeVector;
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 cplxValue1 = _mm512_load_ps(complexVectorPtr);
+        const __m512 cplxValue2 = _mm512_load_ps(complexVectorPtr + 16);
+        _mm512_store_ps(magnitudeVectorPtr, _mm512_magnitude_ps(cplxValue1, cplxValue2));
+
+        complexVectorPtr += 32;
+        magnitudeVectorPtr += 16;
+    }
+
+    if (remainder) {
+        const unsigned int remainder1 = remainder > 8 ? 8 : remainder;
+        const __mmask16 mask1 = _mm512_complex_tail_mask_ps(remainder1);
+        const __mmask16 mask2 = _mm512_complex_tail_mask_ps(remainder - remainder1);
+        const __m512 cplxValue1 = _mm512_maskz_loadu_ps(mask1, complexVectorPtr);
+        const __m512 cplxValue2 = _mm512_maskz_loadu_ps(mask2, complexVectorPtr + 16);
+        _mm512_mask_storeu_ps(magnitudeVectorPtr,
+                              _mm512_tail_mask_ps(remainder),
+                              _mm512_magnitude_ps(cplxValue1, cplxValue2));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
 #endif /* INCLUDED_volk_32fc_magnitude_32f_a_H */
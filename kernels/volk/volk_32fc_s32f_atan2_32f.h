@@ -204,5 +204,38 @@ static inline void volk_32fc_s32f_atan2_32f_generic(float* outputVector,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_s32f_atan2_32f_neon(float* outputVector,
+                                                 const lv_32fc_t* inputVector,
+                                                 const float normalizeFactor,
+                                                 unsigned int num_points)
+{
+    float* outPtr = outputVector;
+    const float* inPtr = (float*)inputVector;
+    const float invNormalizeFactor = 1.0 / normalizeFactor;
+    const unsigned int quarterPoints = num_points / 4;
+    unsigned int number = 0;
+
+    float32x4x2_t inputVal;
+    float32x4_t result;
+    for (; number < quarterPoints; number++) {
+        inputVal = vld2q_f32(inPtr);
+        result = _vatan2q_f32(inputVal.val[1], inputVal.val[0]);
+        vst1q_f32(outPtr, vmulq_n_f32(result, invNormalizeFactor));
+        inPtr += 8;
+        outPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        const float real = *inPtr++;
+        const float imag = *inPtr++;
+        *outPtr++ = atan2f(imag, real) * invNormalizeFactor;
+    }
+}
+#endif /* LV_HAVE_NEON */
 
 #endif /* INCLUDED_volk_32fc_s32f_atan2_32f_a_H */
@@ -255,4 +255,39 @@ volk_32fc_s32f_deinterleave_real_16i_u_avx2(int16_t* iBuffer,
 
 #endif /* LV_HAVE_AVX2 */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void
+volk_32fc_s32f_deinterleave_real_16i_neon(int16_t* iBuffer,
+                                          const lv_32fc_t* complexVector,
+                                          const float scalar,
+                                          unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float* complexVectorPtr = (const float*)complexVector;
+    int16_t* iBufferPtr = iBuffer;
+
+    float32x4x2_t complexVal;
+    int32x4_t intVal;
+    for (; number < quarterPoints; number++) {
+        complexVal = vld2q_f32(complexVectorPtr);
+        complexVectorPtr += 8;
+
+        // truncate like the cast in the generic kernel
+        intVal = vcvtq_s32_f32(vmulq_n_f32(complexVal.val[0], scalar));
+        vst1_s16(iBufferPtr, vqmovn_s32(intVal));
+        iBufferPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *iBufferPtr++ = (int16_t)(*complexVectorPtr++ * scalar);
+        complexVectorPtr++;
+    }
+}
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_32fc_s32f_deinterleave_real_16i_u_H */
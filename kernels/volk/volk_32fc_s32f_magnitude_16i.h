@@ -306,4 +306,44 @@ static inline void volk_32fc_s32f_magnitude_16i_u_avx2(int16_t* magnitudeVector,
 }
 #endif /* LV_HAVE_AVX2 */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32fc_s32f_magnitude_16i_neonv8(int16_t* magnitudeVector,
+                                                       const lv_32fc_t* complexVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float* complexVectorPtr = (const float*)complexVector;
+    int16_t* magnitudeVectorPtr = magnitudeVector;
+
+    float32x4x2_t complexVal;
+    float32x4_t magVal;
+    for (; number < quarterPoints; number++) {
+        complexVal = vld2q_f32(complexVectorPtr);
+        complexVectorPtr += 8;
+
+        magVal = vmulq_f32(complexVal.val[0], complexVal.val[0]);
+        magVal = vaddq_f32(magVal, vmulq_f32(complexVal.val[1], complexVal.val[1]));
+        magVal = vmulq_n_f32(vsqrtq_f32(magVal), scalar);
+
+        // vrndiq takes into account the current rounding mode (as does rintf)
+        vst1_s16(magnitudeVectorPtr, vqmovn_s32(vcvtq_s32_f32(vrndiq_f32(magVal))));
+        magnitudeVectorPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        float real = *complexVectorPtr++;
+        float imag = *complexVectorPtr++;
+        real *= real;
+        imag *= imag;
+        *magnitudeVectorPtr++ = (int16_t)rintf(scalar * sqrtf(real + imag));
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
 #endif /* INCLUDED_volk_32fc_s32f_magnitude_16i_u_H */
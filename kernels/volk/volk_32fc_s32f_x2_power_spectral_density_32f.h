@@ -45,6 +45,7 @@
 #include <inttypes.h>
 #include <math.h>
 #include <stdio.h>
+#include <volk/volk.h> // the generic impl calls other kernels
 
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
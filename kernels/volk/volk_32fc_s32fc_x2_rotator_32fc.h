@@ -777,4 +777,81 @@ static inline void volk_32fc_s32fc_x2_rotator_32fc_u_avx_fma(lv_32fc_t* outVecto
 
 #endif /* LV_HAVE_AVX && LV_HAVE_FMA*/
 
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+#include <volk/volk_rvv_intrinsics.h>
+
+static inline void volk_32fc_s32fc_x2_rotator_32fc_rvv(lv_32fc_t* outVector,
+                                                       const lv_32fc_t* inVector,
+                                                       const lv_32fc_t phase_inc,
+                                                       lv_32fc_t* phase,
+                                                       unsigned int num_points)
+{
+    const float* inPtr = (const float*)inVector;
+    float* outPtr = (float*)outVector;
+    const size_t vlmax = __riscv_vsetvlmax_e32m2();
+    unsigned int remaining = num_points;
+    unsigned int since_normalize = 0;
+    vfloat32m2_t in_re, in_im, out_re, out_im;
+
+    // lane k starts at phase * phase_inc^k, the lanes with bit b set in k are
+    // advanced by phase_inc^(2^b), for each b
+    const vuint32m2_t lane = __riscv_vid_v_u32m2(vlmax);
+    vfloat32m2_t phase_re = __riscv_vfmv_v_f_f32m2(lv_creal(*phase), vlmax);
+    vfloat32m2_t phase_im = __riscv_vfmv_v_f_f32m2(lv_cimag(*phase), vlmax);
+    lv_32fc_t incr = phase_inc;
+    size_t bit;
+    for (bit = 1; bit < vlmax; bit <<= 1) {
+        const vbool16_t has_bit = __riscv_vmsne_vx_u32m2_b16(
+            __riscv_vand_vx_u32m2(lane, (uint32_t)bit, vlmax), 0, vlmax);
+        vfloat32m2_t re, im;
+        _rvv_complexmul_scalar_f32m2(
+            &re, &im, phase_re, phase_im, lv_creal(incr), lv_cimag(incr), vlmax);
+        phase_re = __riscv_vmerge_vvm_f32m2(phase_re, re, has_bit, vlmax);
+        phase_im = __riscv_vmerge_vvm_f32m2(phase_im, im, has_bit, vlmax);
+        incr *= incr;
+    }
+    // vlmax is a power of two, so incr is phase_inc^vlmax now
+
+    for (; remaining > vlmax; remaining -= vlmax) {
+        _rvv_load_complex_f32m2(&in_re, &in_im, inPtr, vlmax);
+        _rvv_complexmul_f32m2(&out_re, &out_im, in_re, in_im, phase_re, phase_im, vlmax);
+        _rvv_store_complex_f32m2(outPtr, out_re, out_im, vlmax);
+        _rvv_complexmul_scalar_f32m2(&phase_re,
+                                     &phase_im,
+                                     phase_re,
+                                     phase_im,
+                                     lv_creal(incr),
+                                     lv_cimag(incr),
+                                     vlmax);
+
+        since_normalize += vlmax;
+        if (since_normalize >= ROTATOR_RELOAD) {
+            // normalize phase so magnitude doesn't grow because of
+            // floating point rounding error
+            _rvv_normalize_f32m2(&phase_re, &phase_im, vlmax);
+            since_normalize = 0;
+        }
+        inPtr += 2 * vlmax;
+        outPtr += 2 * vlmax;
+    }
+
+    if (remaining) {
+        _rvv_load_complex_f32m2(&in_re, &in_im, inPtr, remaining);
+        _rvv_complexmul_f32m2(
+            &out_re, &out_im, in_re, in_im, phase_re, phase_im, remaining);
+        _rvv_store_complex_f32m2(outPtr, out_re, out_im, remaining);
+
+        // For continuous phase next time, the phase of the lane after the last one
+        const float last_re = __riscv_vfmv_f_s_f32m2_f32(
+            __riscv_vslidedown_vx_f32m2(phase_re, remaining - 1, vlmax));
+        const float last_im = __riscv_vfmv_f_s_f32m2_f32(
+            __riscv_vslidedown_vx_f32m2(phase_im, remaining - 1, vlmax));
+        (*phase) = lv_cmake(last_re, last_im) * phase_inc;
+        // Make sure, we normalize phase on every call!
+        (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    }
+}
+#endif /* LV_HAVE_RVV */
+
 #endif /* INCLUDED_volk_32fc_s32fc_rotator_32fc_a_H */
@@ -501,6 +501,55 @@ static inline void volk_32fc_x2_dot_prod_32fc_u_avx_fma(lv_32fc_t* result,
 
 #endif /*LV_HAVE_AVX && LV_HAVE_FMA*/
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_x2_dot_prod_32fc_u_avx512f(lv_32fc_t* result,
+                                                        const lv_32fc_t* input,
+                                                        const lv_32fc_t* taps,
+                                                        unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int remainder = num_points % 16;
+
+    const lv_32fc_t* a = input;
+    const lv_32fc_t* b = taps;
+
+    __m512 dotProdVal0 = _mm512_setzero_ps();
+    __m512 dotProdVal1 = _mm512_setzero_ps();
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 x0 = _mm512_loadu_ps((const float*)a);
+        const __m512 y0 = _mm512_loadu_ps((const float*)b);
+        const __m512 x1 = _mm512_loadu_ps((const float*)(a + 8));
+        const __m512 y1 = _mm512_loadu_ps((const float*)(b + 8));
+
+        dotProdVal0 = _mm512_add_ps(dotProdVal0, _mm512_complexmul_ps(x0, y0));
+        dotProdVal1 = _mm512_add_ps(dotProdVal1, _mm512_complexmul_ps(x1, y1));
+
+        a += 16;
+        b += 16;
+    }
+
+    if (remainder) {
+        const unsigned int remainder0 = remainder > 8 ? 8 : remainder;
+        const __mmask16 mask0 = _mm512_complex_tail_mask_ps(remainder0);
+        const __mmask16 mask1 = _mm512_complex_tail_mask_ps(remainder - remainder0);
+        const __m512 x0 = _mm512_maskz_loadu_ps(mask0, (const float*)a);
+        const __m512 y0 = _mm512_maskz_loadu_ps(mask0, (const float*)b);
+        const __m512 x1 = _mm512_maskz_loadu_ps(mask1, (const float*)(a + 8));
+        const __m512 y1 = _mm512_maskz_loadu_ps(mask1, (const float*)(b + 8));
+
+        dotProdVal0 = _mm512_add_ps(dotProdVal0, _mm512_complexmul_ps(x0, y0));
+        dotProdVal1 = _mm512_add_ps(dotProdVal1, _mm512_complexmul_ps(x1, y1));
+    }
+
+    *result = _mm512_complex_reduce_add_ps(_mm512_add_ps(dotProdVal0, dotProdVal1));
+}
+
+#endif /* LV_HAVE_AVX512F */
+
 #endif /*INCLUDED_volk_32fc_x2_dot_prod_32fc_u_H*/
 
 #ifndef INCLUDED_volk_32fc_x2_dot_prod_32fc_a_H
@@ -1323,4 +1372,120 @@ static inline void volk_32fc_x2_dot_prod_32fc_a_avx_fma(lv_32fc_t* result,
 #endif /*LV_HAVE_AVX && LV_HAVE_FMA*/
 
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_x2_dot_prod_32fc_a_avx512f(lv_32fc_t* result,
+                                                        const lv_32fc_t* input,
+                                                        const lv_32fc_t* taps,
+                                                        unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int remainder = num_points % 16;
+
+    const lv_32fc_t* a = input;
+    const lv_32fc_t* b = taps;
+
+    __m512 dotProdVal0 = _mm512_setzero_ps();
+    __m512 dotProdVal1 = _mm512_setzero_ps();
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 x0 = _mm512_load_ps((const float*)a);
+        const __m512 y0 = _mm512_load_ps((const float*)b);
+        const __m512 x1 = _mm512_load_ps((const float*)(a + 8));
+        const __m512 y1 = _mm512_load_ps((const float*)(b + 8));
+
+        dotProdVal0 = _mm512_add_ps(dotProdVal0, _mm512_complexmul_ps(x0, y0));
+        dotProdVal1 = _mm512_add_ps(dotProdVal1, _mm512_complexmul_ps(x1, y1));
+
+        a += 16;
+        b += 16;
+    }
+
+    if (remainder) {
+        const unsigned int remainder0 = remainder > 8 ? 8 : remainder;
+        const __mmask16 mask0 = _mm512_complex_tail_mask_ps(remainder0);
+        const __mmask16 mask1 = _mm512_complex_tail_mask_ps(remainder - remainder0);
+        const __m512 x0 = _mm512_maskz_loadu_ps(mask0, (const float*)a);
+        const __m512 y0 = _mm512_maskz_loadu_ps(mask0, (const float*)b);
+        const __m512 x1 = _mm512_maskz_loadu_ps(mask1, (const float*)(a + 8));
+        const __m512 y1 = _mm512_maskz_loadu_ps(mask1, (const float*)(b + 8));
+
+        dotProdVal0 = _mm512_add_ps(dotProdVal0, _mm512_complexmul_ps(x0, y0));
+        dotProdVal1 = _mm512_add_ps(dotProdVal1, _mm512_complexmul_ps(x1, y1));
+    }
+
+    *result = _mm512_complex_reduce_add_ps(_mm512_add_ps(dotProdVal0, dotProdVal1));
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_32fc_x2_dot_prod_32fc_sve(lv_32fc_t* result,
+                                                  const lv_32fc_t* input,
+                                                  const lv_32fc_t* taps,
+                                                  unsigned int num_points)
+{
+    const float* in = (const float*)input;
+    const float* tp = (const float*)taps;
+    const unsigned int n_floats = 2 * num_points;
+    svfloat32_t acc = svdup_f32(0.f);
+    unsigned int number;
+
+    for (number = 0; number < n_floats; number += svcntw()) {
+        const svbool_t pg = svwhilelt_b32(number, n_floats);
+        const svfloat32_t inVal = svld1(pg, in + number);
+        const svfloat32_t tapVal = svld1(pg, tp + number);
+        // complex multiply accumulate, merging so the lanes past the end keep their sums
+        acc = svcmla_m(pg, acc, inVal, tapVal, 0);
+        acc = svcmla_m(pg, acc, inVal, tapVal, 90);
+    }
+
+    // the even lanes sum the real parts, the odd lanes the imaginary parts
+    const svbool_t even = svtrn1_b32(svptrue_b32(), svpfalse_b());
+    const svbool_t odd = svnot_z(svptrue_b32(), even);
+    *result = lv_cmake(svaddv(even, acc), svaddv(odd, acc));
+}
+#endif /* LV_HAVE_SVE */
+
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+#include <volk/volk_rvv_intrinsics.h>
+
+static inline void volk_32fc_x2_dot_prod_32fc_rvv(lv_32fc_t* result,
+                                                  const lv_32fc_t* input,
+                                                  const lv_32fc_t* taps,
+                                                  unsigned int num_points)
+{
+    const float* in = (const float*)input;
+    const float* tp = (const float*)taps;
+    const size_t vlmax = __riscv_vsetvlmax_e32m2();
+    vfloat32m2_t acc_re = __riscv_vfmv_v_f_f32m2(0.f, vlmax);
+    vfloat32m2_t acc_im = __riscv_vfmv_v_f_f32m2(0.f, vlmax);
+    size_t n = num_points;
+    size_t vl;
+
+    for (; n > 0; n -= vl, in += 2 * vl, tp += 2 * vl) {
+        vl = __riscv_vsetvl_e32m2(n);
+        vfloat32m2_t in_re, in_im, tp_re, tp_im;
+        _rvv_load_complex_f32m2(&in_re, &in_im, in, vl);
+        _rvv_load_complex_f32m2(&tp_re, &tp_im, tp, vl);
+        // tail undisturbed, the lanes past vl keep their sums
+        acc_re = __riscv_vfmacc_vv_f32m2_tu(acc_re, in_re, tp_re, vl);
+        acc_re = __riscv_vfnmsac_vv_f32m2_tu(acc_re, in_im, tp_im, vl);
+        acc_im = __riscv_vfmacc_vv_f32m2_tu(acc_im, in_re, tp_im, vl);
+        acc_im = __riscv_vfmacc_vv_f32m2_tu(acc_im, in_im, tp_re, vl);
+    }
+
+    const vfloat32m1_t zero = __riscv_vfmv_s_f_f32m1(0.f, 1);
+    const vfloat32m1_t sum_re = __riscv_vfredusum_vs_f32m2_f32m1(acc_re, zero, vlmax);
+    const vfloat32m1_t sum_im = __riscv_vfredusum_vs_f32m2_f32m1(acc_im, zero, vlmax);
+    *result = lv_cmake(__riscv_vfmv_f_s_f32m1_f32(sum_re),
+                       __riscv_vfmv_f_s_f32m1_f32(sum_im));
+}
+#endif /* LV_HAVE_RVV */
+
 #endif /*INCLUDED_volk_32fc_x2_dot_prod_32fc_a_H*/
@@ -156,6 +156,43 @@ static inline void volk_32fc_x2_multiply_conjugate_32fc_generic(lv_32fc_t* cVect
 #endif /* LV_HAVE_GENERIC */
 
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_x2_multiply_conjugate_32fc_u_avx512f(lv_32fc_t* cVector,
+                                               const lv_32fc_t* aVector,
+                                               const lv_32fc_t* bVector,
+                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const unsigned int remainder = num_points % 8;
+
+    lv_32fc_t* c = cVector;
+    const lv_32fc_t* a = aVector;
+    const lv_32fc_t* b = bVector;
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        const __m512 x = _mm512_loadu_ps((const float*)a);
+        const __m512 y = _mm512_loadu_ps((const float*)b);
+        _mm512_storeu_ps((float*)c, _mm512_complexconjugatemul_ps(x, y));
+
+        a += 8;
+        b += 8;
+        c += 8;
+    }
+
+    if (remainder) {
+        const __mmask16 mask = _mm512_complex_tail_mask_ps(remainder);
+        const __m512 x = _mm512_maskz_loadu_ps(mask, (const float*)a);
+        const __m512 y = _mm512_maskz_loadu_ps(mask, (const float*)b);
+        _mm512_mask_storeu_ps((float*)c, mask, _mm512_complexconjugatemul_ps(x, y));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
 #endif /* INCLUDED_volk_32fc_x2_multiply_conjugate_32fc_u_H */
 #ifndef INCLUDED_volk_32fc_x2_multiply_conjugate_32fc_a_H
 #define INCLUDED_volk_32fc_x2_multiply_conjugate_32fc_a_H
@@ -308,4 +345,96 @@ volk_32fc_x2_multiply_conjugate_32fc_a_generic(lv_32fc_t* cVector,
 #endif /* LV_HAVE_GENERIC */
 
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_x2_multiply_conjugate_32fc_a_avx512f(lv_32fc_t* cVector,
+                                               const lv_32fc_t* aVector,
+                                               const lv_32fc_t* bVector,
+                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const unsigned int remainder = num_points % 8;
+
+    lv_32fc_t* c = cVector;
+    const lv_32fc_t* a = aVector;
+    const lv_32fc_t* b = bVector;
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        const __m512 x = _mm512_load_ps((const float*)a);
+        const __m512 y = _mm512_load_ps((const float*)b);
+        _mm512_store_ps((float*)c, _mm512_complexconjugatemul_ps(x, y));
+
+        a += 8;
+        b += 8;
+        c += 8;
+    }
+
+    if (remainder) {
+        const __mmask16 mask = _mm512_complex_tail_mask_ps(remainder);
+        const __m512 x = _mm512_maskz_loadu_ps(mask, (const float*)a);
+        const __m512 y = _mm512_maskz_loadu_ps(mask, (const float*)b);
+        _mm512_mask_storeu_ps((float*)c, mask, _mm512_complexconjugatemul_ps(x, y));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_32fc_x2_multiply_conjugate_32fc_sve(lv_32fc_t* cVector,
+                                                            const lv_32fc_t* aVector,
+                                                            const lv_32fc_t* bVector,
+                                                            unsigned int num_points)
+{
+    const float* a = (const float*)aVector;
+    const float* b = (const float*)bVector;
+    float* c = (float*)cVector;
+    const unsigned int n_floats = 2 * num_points;
+    const svfloat32_t zero = svdup_f32(0.f);
+    unsigned int number;
+
+    // vectors hold whole complex values, so the predicate never splits one
+    for (number = 0; number < n_floats; number += svcntw()) {
+        const svbool_t pg = svwhilelt_b32(number, n_floats);
+        const svfloat32_t aVal = svld1(pg, a + number);
+        const svfloat32_t bVal = svld1(pg, b + number);
+        // br*ar, br*ai, then bi*ai, -bi*ar
+        svfloat32_t cVal = svcmla_x(pg, zero, bVal, aVal, 0);
+        cVal = svcmla_x(pg, cVal, bVal, aVal, 270);
+        svst1(pg, c + number, cVal);
+    }
+}
+#endif /* LV_HAVE_SVE */
+
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+#include <volk/volk_rvv_intrinsics.h>
+
+static inline void volk_32fc_x2_multiply_conjugate_32fc_rvv(lv_32fc_t* cVector,
+                                                            const lv_32fc_t* aVector,
+                                                            const lv_32fc_t* bVector,
+                                                            unsigned int num_points)
+{
+    const float* a = (const float*)aVector;
+    const float* b = (const float*)bVector;
+    float* c = (float*)cVector;
+    size_t n = num_points;
+    size_t vl;
+
+    // LMUL 2, the real and imaginary parts of three operands are live
+    for (; n > 0; n -= vl, a += 2 * vl, b += 2 * vl, c += 2 * vl) {
+        vl = __riscv_vsetvl_e32m2(n);
+        vfloat32m2_t ar, ai, br, bi, cr, ci;
+        _rvv_load_complex_f32m2(&ar, &ai, a, vl);
+        _rvv_load_complex_f32m2(&br, &bi, b, vl);
+        _rvv_complexconjugatemul_f32m2(&cr, &ci, ar, ai, br, bi, vl);
+        _rvv_store_complex_f32m2(c, cr, ci, vl);
+    }
+}
+#endif /* LV_HAVE_RVV */
+
 #endif /* INCLUDED_volk_32fc_x2_multiply_conjugate_32fc_a_H */
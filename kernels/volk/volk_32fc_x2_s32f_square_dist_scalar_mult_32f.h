@@ -88,6 +88,57 @@ static inline void calculate_scaled_distances(float* target,
 }
 
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_x2_s32f_square_dist_scalar_mult_32f_a_avx512f(float* target,
+                                                        lv_32fc_t* src0,
+                                                        lv_32fc_t* points,
+                                                        float scalar,
+                                                        unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int remainder = num_points % 16;
+
+    // load complex value into all parts of the register.
+    const __m512 xmm_symbol =
+        _mm512_castpd_ps(_mm512_broadcastsd_pd(_mm_load_sd((const double*)src0)));
+
+    // Load scalar into all 16 parts of the register
+    const __m512 xmm_scalar = _mm512_set1_ps(scalar);
+
+    for (unsigned int i = 0; i < sixteenthPoints; ++i) {
+        const __m512 xmm_points0 = _mm512_load_ps((const float*)points);
+        const __m512 xmm_points1 = _mm512_load_ps((const float*)(points + 8));
+        points += 16;
+
+        const __m512 xmm_result = _mm512_scaled_norm_dist_ps(
+            xmm_symbol, xmm_symbol, xmm_points0, xmm_points1, xmm_scalar);
+
+        _mm512_store_ps(target, xmm_result);
+        target += 16;
+    }
+
+    if (remainder) {
+        const unsigned int remainder0 = remainder > 8 ? 8 : remainder;
+        const __mmask16 mask0 = _mm512_complex_tail_mask_ps(remainder0);
+        const __mmask16 mask1 = _mm512_complex_tail_mask_ps(remainder - remainder0);
+        const __m512 xmm_points0 = _mm512_maskz_loadu_ps(mask0, (const float*)points);
+        const __m512 xmm_points1 =
+            _mm512_maskz_loadu_ps(mask1, (const float*)(points + 8));
+
+        const __m512 xmm_result = _mm512_scaled_norm_dist_ps(
+            xmm_symbol, xmm_symbol, xmm_points0, xmm_points1, xmm_scalar);
+
+        _mm512_mask_storeu_ps(target, _mm512_tail_mask_ps(remainder), xmm_result);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 #include <volk/volk_avx2_intrinsics.h>
@@ -323,6 +374,57 @@ volk_32fc_x2_s32f_square_dist_scalar_mult_32f_generic(float* target,
 #include <volk/volk_complex.h>
 
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_x2_s32f_square_dist_scalar_mult_32f_u_avx512f(float* target,
+                                                        lv_32fc_t* src0,
+                                                        lv_32fc_t* points,
+                                                        float scalar,
+                                                        unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int remainder = num_points % 16;
+
+    // load complex value into all parts of the register.
+    const __m512 xmm_symbol =
+        _mm512_castpd_ps(_mm512_broadcastsd_pd(_mm_load_sd((const double*)src0)));
+
+    // Load scalar into all 16 parts of the register
+    const __m512 xmm_scalar = _mm512_set1_ps(scalar);
+
+    for (unsigned int i = 0; i < sixteenthPoints; ++i) {
+        const __m512 xmm_points0 = _mm512_loadu_ps((const float*)points);
+        const __m512 xmm_points1 = _mm512_loadu_ps((const float*)(points + 8));
+        points += 16;
+
+        const __m512 xmm_result = _mm512_scaled_norm_dist_ps(
+            xmm_symbol, xmm_symbol, xmm_points0, xmm_points1, xmm_scalar);
+
+        _mm512_storeu_ps(target, xmm_result);
+        target += 16;
+    }
+
+    if (remainder) {
+        const unsigned int remainder0 = remainder > 8 ? 8 : remainder;
+        const __mmask16 mask0 = _mm512_complex_tail_mask_ps(remainder0);
+        const __mmask16 mask1 = _mm512_complex_tail_mask_ps(remainder - remainder0);
+        const __m512 xmm_points0 = _mm512_maskz_loadu_ps(mask0, (const float*)points);
+        const __m512 xmm_points1 =
+            _mm512_maskz_loadu_ps(mask1, (const float*)(points + 8));
+
+        const __m512 xmm_result = _mm512_scaled_norm_dist_ps(
+            xmm_symbol, xmm_symbol, xmm_points0, xmm_points1, xmm_scalar);
+
+        _mm512_mask_storeu_ps(target, _mm512_tail_mask_ps(remainder), xmm_result);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 #include <volk/volk_avx2_intrinsics.h>
@@ -535,4 +637,36 @@ volk_32fc_x2_s32f_square_dist_scalar_mult_32f_u_sse(float* target,
 }
 #endif // LV_HAVE_SSE
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void
+volk_32fc_x2_s32f_square_dist_scalar_mult_32f_neon(float* target,
+                                                   lv_32fc_t* src0,
+                                                   lv_32fc_t* points,
+                                                   float scalar,
+                                                   unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+
+    float32x4x2_t symbol_vec, points_vec;
+    float32x4_t diff_real, diff_imag, dist_sq;
+    symbol_vec.val[0] = vdupq_n_f32(lv_creal(src0[0]));
+    symbol_vec.val[1] = vdupq_n_f32(lv_cimag(src0[0]));
+    for (number = 0; number < quarter_points; ++number) {
+        points_vec = vld2q_f32((float*)points);
+        diff_real = vsubq_f32(symbol_vec.val[0], points_vec.val[0]);
+        diff_imag = vsubq_f32(symbol_vec.val[1], points_vec.val[1]);
+        dist_sq = vmulq_f32(diff_real, diff_real);
+        dist_sq = vmlaq_f32(dist_sq, diff_imag, diff_imag);
+        vst1q_f32(target, vmulq_n_f32(dist_sq, scalar));
+        points += 4;
+        target += 4;
+    }
+
+    calculate_scaled_distances(target, src0[0], points, scalar, num_points % 4);
+}
+#endif /* LV_HAVE_NEON */
+
 #endif /*INCLUDED_volk_32fc_x2_s32f_square_dist_scalar_mult_32f_u_H*/
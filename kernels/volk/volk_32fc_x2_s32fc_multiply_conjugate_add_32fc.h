@@ -17,6 +17,10 @@
  *
  * c[i] = a[i] + conj(b[i]) * scalar
  *
+ * The _pf<n> implementations prefetch the input streams n bytes ahead, for machines
+ * whose hardware prefetchers do not keep up with this many streams. They are never
+ * picked by default, volk_profile writes the fastest distance into volk_config.
+ *
  * <b>Dispatcher Prototype</b>
  * \code
  * void volk_32fc_x2_s32fc_multiply_conjugate_add_32fc(lv_32fc_t* cVector, const
@@ -76,6 +80,7 @@
 #include <float.h>
 #include <inttypes.h>
 #include <stdio.h>
+#include <volk/volk_common.h>
 #include <volk/volk_complex.h>
 
 
@@ -156,6 +161,94 @@ volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_u_avx(lv_32fc_t* cVector,
         *c++ = (*a++) + lv_conj(*b++) * scalar;
     }
 }
+
+/*
+ * u_avx with the three streams read distance bytes ahead with software prefetches,
+ * one per cache line and stream, for the _pf impls below.
+ */
+static inline void multiply_conjugate_add_32fc_u_avx_prefetch(lv_32fc_t* cVector,
+                                                              const lv_32fc_t* aVector,
+                                                              const lv_32fc_t* bVector,
+                                                              const lv_32fc_t scalar,
+                                                              unsigned int num_points,
+                                                              unsigned int distance)
+{
+    // distance in complex values, a cache line holds 8 of them
+    const unsigned int ahead = distance / sizeof(lv_32fc_t);
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number;
+
+    const lv_32fc_t* a = aVector;
+    const lv_32fc_t* b = bVector;
+    lv_32fc_t* c = cVector;
+
+    const lv_32fc_t v_scalar[4] = { scalar, scalar, scalar, scalar };
+    const __m256 s = _mm256_loadu_ps((const float*)v_scalar);
+
+    for (number = 0; number < eighthPoints; number++) {
+        __VOLK_PREFETCH(a + ahead);
+        __VOLK_PREFETCH(b + ahead);
+        __VOLK_PREFETCH(c + ahead);
+
+        __m256 z0 = _mm256_complexconjugatemul_ps(s, _mm256_loadu_ps((const float*)b));
+        __m256 z1 =
+            _mm256_complexconjugatemul_ps(s, _mm256_loadu_ps((const float*)(b + 4)));
+        z0 = _mm256_add_ps(_mm256_loadu_ps((const float*)a), z0);
+        z1 = _mm256_add_ps(_mm256_loadu_ps((const float*)(a + 4)), z1);
+        _mm256_storeu_ps((float*)c, z0);
+        _mm256_storeu_ps((float*)(c + 4), z1);
+
+        a += 8;
+        b += 8;
+        c += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *c++ = (*a++) + lv_conj(*b++) * scalar;
+    }
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX
+
+static inline void
+volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_u_avx_pf256(lv_32fc_t* cVector,
+                                                           const lv_32fc_t* aVector,
+                                                           const lv_32fc_t* bVector,
+                                                           const lv_32fc_t scalar,
+                                                           unsigned int num_points)
+{
+    multiply_conjugate_add_32fc_u_avx_prefetch(
+        cVector, aVector, bVector, scalar, num_points, 256);
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX
+
+static inline void
+volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_u_avx_pf1024(lv_32fc_t* cVector,
+                                                            const lv_32fc_t* aVector,
+                                                            const lv_32fc_t* bVector,
+                                                            const lv_32fc_t scalar,
+                                                            unsigned int num_points)
+{
+    multiply_conjugate_add_32fc_u_avx_prefetch(
+        cVector, aVector, bVector, scalar, num_points, 1024);
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX
+
+static inline void
+volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_u_avx_pf4096(lv_32fc_t* cVector,
+                                                            const lv_32fc_t* aVector,
+                                                            const lv_32fc_t* bVector,
+                                                            const lv_32fc_t scalar,
+                                                            unsigned int num_points)
+{
+    multiply_conjugate_add_32fc_u_avx_prefetch(
+        cVector, aVector, bVector, scalar, num_points, 4096);
+}
 #endif /* LV_HAVE_AVX */
 
 
@@ -69,6 +69,48 @@
 #include <stdio.h>
 #include <volk/volk_complex.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_x2_square_dist_32f_a_avx512f(float* target,
+                                                          lv_32fc_t* src0,
+                                                          lv_32fc_t* points,
+                                                          unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int remainder = num_points % 16;
+
+    // load the complex value into all 8 complex lanes
+    const __m512 symbol =
+        _mm512_castpd_ps(_mm512_broadcastsd_pd(_mm_load_sd((const double*)src0)));
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 points0 = _mm512_load_ps((const float*)points);
+        const __m512 points1 = _mm512_load_ps((const float*)(points + 8));
+        const __m512 diff0 = _mm512_sub_ps(symbol, points0);
+        const __m512 diff1 = _mm512_sub_ps(symbol, points1);
+        _mm512_store_ps(target, _mm512_magnitudesquared_ps(diff0, diff1));
+        points += 16;
+        target += 16;
+    }
+
+    if (remainder) {
+        const unsigned int remainder0 = remainder > 8 ? 8 : remainder;
+        const __mmask16 mask0 = _mm512_complex_tail_mask_ps(remainder0);
+        const __mmask16 mask1 = _mm512_complex_tail_mask_ps(remainder - remainder0);
+        const __m512 points0 = _mm512_maskz_loadu_ps(mask0, (const float*)points);
+        const __m512 points1 = _mm512_maskz_loadu_ps(mask1, (const float*)(points + 8));
+        const __m512 diff0 = _mm512_sub_ps(symbol, points0);
+        const __m512 diff1 = _mm512_sub_ps(symbol, points1);
+        _mm512_mask_storeu_ps(target,
+                              _mm512_tail_mask_ps(remainder),
+                              _mm512_magnitudesquared_ps(diff0, diff1));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
@@ -181,41 +223,25 @@ static inline void volk_32fc_x2_square_dist_32f_a_sse3(float* target,
 
     xmm1 = _mm_setzero_ps();
     xmm1 = _mm_loadl_pi(xmm1, (__m64*)src0);
-    xmm2 = _mm_load_ps((float*)&points[0]);
     xmm1 = _mm_movelh_ps(xmm1, xmm1);
-    xmm3 = _mm_load_ps((float*)&points[2]);
 
-    for (; i < bound - 1; ++i) {
+    for (; i < bound; ++i) {
+        xmm2 = _mm_load_ps((float*)&points[0]);
+        xmm3 = _mm_load_ps((float*)&points[2]);
+
         xmm4 = _mm_sub_ps(xmm1, xmm2);
         xmm5 = _mm_sub_ps(xmm1, xmm3);
         points += 4;
         xmm6 = _mm_mul_ps(xmm4, xmm4);
         xmm7 = _mm_mul_ps(xmm5, xmm5);
 
-        xmm2 = _mm_load_ps((float*)&points[0]);
-
         xmm4 = _mm_hadd_ps(xmm6, xmm7);
 
-        xmm3 = _mm_load_ps((float*)&points[2]);
-
         _mm_store_ps(target, xmm4);
 
         target += 4;
     }
 
-    xmm4 = _mm_sub_ps(xmm1, xmm2);
-    xmm5 = _mm_sub_ps(xmm1, xmm3);
-
-    points += 4;
-    xmm6 = _mm_mul_ps(xmm4, xmm4);
-    xmm7 = _mm_mul_ps(xmm5, xmm5);
-
-    xmm4 = _mm_hadd_ps(xmm6, xmm7);
-
-    _mm_store_ps(target, xmm4);
-
-    target += 4;
-
     if (num_bytes >> 4 & 1) {
 
         xmm2 = _mm_load_ps((float*)&points[0]);
@@ -314,6 +340,48 @@ static inline void volk_32fc_x2_square_dist_32f_generic(float* target,
 #include <stdio.h>
 #include <volk/volk_complex.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_x2_square_dist_32f_u_avx512f(float* target,
+                                                          lv_32fc_t* src0,
+                                                          lv_32fc_t* points,
+                                                          unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int remainder = num_points % 16;
+
+    // load the complex value into all 8 complex lanes
+    const __m512 symbol =
+        _mm512_castpd_ps(_mm512_broadcastsd_pd(_mm_load_sd((const double*)src0)));
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 points0 = _mm512_loadu_ps((const float*)points);
+        const __m512 points1 = _mm512_loadu_ps((const float*)(points + 8));
+        const __m512 diff0 = _mm512_sub_ps(symbol, points0);
+        const __m512 diff1 = _mm512_sub_ps(symbol, points1);
+        _mm512_storeu_ps(target, _mm512_magnitudesquared_ps(diff0, diff1));
+        points += 16;
+        target += 16;
+    }
+
+    if (remainder) {
+        const unsigned int remainder0 = remainder > 8 ? 8 : remainder;
+        const __mmask16 mask0 = _mm512_complex_tail_mask_ps(remainder0);
+        const __mmask16 mask1 = _mm512_complex_tail_mask_ps(remainder - remainder0);
+        const __m512 points0 = _mm512_maskz_loadu_ps(mask0, (const float*)points);
+        const __m512 points1 = _mm512_maskz_loadu_ps(mask1, (const float*)(points + 8));
+        const __m512 diff0 = _mm512_sub_ps(symbol, points0);
+        const __m512 diff1 = _mm512_sub_ps(symbol, points1);
+        _mm512_mask_storeu_ps(target,
+                              _mm512_tail_mask_ps(remainder),
+                              _mm512_magnitudesquared_ps(diff0, diff1));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
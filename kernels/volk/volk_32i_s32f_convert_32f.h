@@ -189,6 +189,36 @@ static inline void volk_32i_s32f_convert_32f_generic(float* outputVector,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32i_s32f_convert_32f_neon(float* outputVector,
+                                                  const int32_t* inputVector,
+                                                  const float scalar,
+                                                  unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    float* outputVectorPtr = outputVector;
+    const int32_t* inputVectorPtr = inputVector;
+    const float iScalar = 1.0 / scalar;
+
+    float32x4_t outputVal;
+    for (; number < quarterPoints; number++) {
+        outputVal = vcvtq_f32_s32(vld1q_s32(inputVectorPtr));
+        vst1q_f32(outputVectorPtr, vmulq_n_f32(outputVal, iScalar));
+        inputVectorPtr += 4;
+        outputVectorPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *outputVectorPtr++ = ((float)(*inputVectorPtr++)) * iScalar;
+    }
+}
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_32i_s32f_convert_32f_u_H */
 
 
@@ -248,6 +248,33 @@ static inline void volk_32u_byteswap_generic(uint32_t* intsToSwap,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#if LV_HAVE_AVX512BW
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+static inline void
+volk_32u_byteswap_u_avx512bw(uint32_t* intsToSwap, unsigned int num_points)
+{
+    unsigned int number;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    uint32_t* inputPtr = intsToSwap;
+
+    // reverses the bytes of each 32 bit value, the same in each 128 bit lane
+    const __m512i myShuffle = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        const __m512i input = _mm512_loadu_si512((void*)inputPtr);
+        _mm512_storeu_si512((void*)inputPtr, _mm512_shuffle_epi8(input, myShuffle));
+        inputPtr += 16;
+    }
+
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __mmask16 mask = _mm512_tail_mask_ps(num_points - sixteenthPoints * 16);
+    const __m512i input = _mm512_maskz_loadu_epi32(mask, inputPtr);
+    _mm512_mask_storeu_epi32(inputPtr, mask, _mm512_shuffle_epi8(input, myShuffle));
+}
+#endif /* LV_HAVE_AVX512BW */
 
 #endif /* INCLUDED_volk_32u_byteswap_u_H */
 #ifndef INCLUDED_volk_32u_byteswap_a_H
@@ -363,5 +390,32 @@ static inline void volk_32u_byteswap_a_generic(uint32_t* intsToSwap,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#if LV_HAVE_AVX512BW
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+static inline void
+volk_32u_byteswap_a_avx512bw(uint32_t* intsToSwap, unsigned int num_points)
+{
+    unsigned int number;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    uint32_t* inputPtr = intsToSwap;
+
+    // reverses the bytes of each 32 bit value, the same in each 128 bit lane
+    const __m512i myShuffle = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        const __m512i input = _mm512_load_si512((void*)inputPtr);
+        _mm512_store_si512((void*)inputPtr, _mm512_shuffle_epi8(input, myShuffle));
+        inputPtr += 16;
+    }
+
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __mmask16 mask = _mm512_tail_mask_ps(num_points - sixteenthPoints * 16);
+    const __m512i input = _mm512_maskz_loadu_epi32(mask, inputPtr);
+    _mm512_mask_storeu_epi32(inputPtr, mask, _mm512_shuffle_epi8(input, myShuffle));
+}
+#endif /* LV_HAVE_AVX512BW */
 
 #endif /* INCLUDED_volk_32u_byteswap_a_H */
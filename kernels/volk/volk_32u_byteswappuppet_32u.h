@@ -91,4 +91,26 @@ static inline void volk_32u_byteswappuppet_32u_a_avx2(uint32_t* output,
 }
 #endif
 
+#if LV_HAVE_AVX512BW
+static inline void volk_32u_byteswappuppet_32u_u_avx512bw(uint32_t* output,
+                                                          uint32_t* intsToSwap,
+                                                          unsigned int num_points)
+{
+
+    volk_32u_byteswap_u_avx512bw((uint32_t*)intsToSwap, num_points);
+    memcpy((void*)output, (void*)intsToSwap, num_points * sizeof(uint32_t));
+}
+#endif
+
+#if LV_HAVE_AVX512BW
+static inline void volk_32u_byteswappuppet_32u_a_avx512bw(uint32_t* output,
+                                                          uint32_t* intsToSwap,
+                                                          unsigned int num_points)
+{
+
+    volk_32u_byteswap_a_avx512bw((uint32_t*)intsToSwap, num_points);
+    memcpy((void*)output, (void*)intsToSwap, num_points * sizeof(uint32_t));
+}
+#endif
+
 #endif
@@ -403,5 +403,157 @@ volk_32u_reverse_32u_arm(uint32_t* out, const uint32_t* in, unsigned int num_poi
 #endif /* LV_HAVE_NEON */
 #endif /* LV_HAVE_NEONV8 */
 
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void
+volk_32u_reverse_32u_u_ssse3(uint32_t* out, const uint32_t* in, unsigned int num_points)
+{
+    const uint32_t* in_ptr = in;
+    uint32_t* out_ptr = out;
+
+    // BitReverseTable256[0..15] are the reversed low nibbles, moved to the high nibble
+    const __m128i rev_lo = _mm_loadu_si128((const __m128i*)BitReverseTable256);
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    const __m128i rev_hi = _mm_and_si128(_mm_srli_epi16(rev_lo, 4), nibble);
+    const __m128i idx =
+        _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    const unsigned int quarterPoints = num_points / 4;
+    unsigned int number = 0;
+    for (; number < quarterPoints; ++number) {
+        const __m128i x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)in_ptr), idx);
+        const __m128i lo = _mm_and_si128(x, nibble);
+        const __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), nibble);
+        const __m128i z =
+            _mm_or_si128(_mm_shuffle_epi8(rev_lo, lo), _mm_shuffle_epi8(rev_hi, hi));
+        _mm_storeu_si128((__m128i*)out_ptr, z);
+        in_ptr += 4;
+        out_ptr += 4;
+    }
+    number = quarterPoints * 4;
+    for (; number < num_points; ++number) {
+        *out_ptr = (BitReverseTable256[*in_ptr & 0xff] << 24) |
+                   (BitReverseTable256[(*in_ptr >> 8) & 0xff] << 16) |
+                   (BitReverseTable256[(*in_ptr >> 16) & 0xff] << 8) |
+                   (BitReverseTable256[(*in_ptr >> 24) & 0xff]);
+        ++in_ptr;
+        ++out_ptr;
+    }
+}
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void
+volk_32u_reverse_32u_u_avx2(uint32_t* out, const uint32_t* in, unsigned int num_points)
+{
+    const uint32_t* in_ptr = in;
+    uint32_t* out_ptr = out;
+
+    // the nibble tables of u_ssse3, in both 128 bit lanes
+    const __m256i rev_lo = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i*)BitReverseTable256));
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    const __m256i rev_hi = _mm256_and_si256(_mm256_srli_epi16(rev_lo, 4), nibble);
+    const __m256i idx = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+    for (; number < eighthPoints; ++number) {
+        const __m256i x =
+            _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)in_ptr), idx);
+        const __m256i lo = _mm256_and_si256(x, nibble);
+        const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble);
+        const __m256i z = _mm256_or_si256(_mm256_shuffle_epi8(rev_lo, lo),
+                                          _mm256_shuffle_epi8(rev_hi, hi));
+        _mm256_storeu_si256((__m256i*)out_ptr, z);
+        in_ptr += 8;
+        out_ptr += 8;
+    }
+    number = eighthPoints * 8;
+    for (; number < num_points; ++number) {
+        *out_ptr = (BitReverseTable256[*in_ptr & 0xff] << 24) |
+                   (BitReverseTable256[(*in_ptr >> 8) & 0xff] << 16) |
+                   (BitReverseTable256[(*in_ptr >> 16) & 0xff] << 8) |
+                   (BitReverseTable256[(*in_ptr >> 24) & 0xff]);
+        ++in_ptr;
+        ++out_ptr;
+    }
+}
+#endif /* LV_HAVE_AVX2 */
+
+#if LV_HAVE_AVX2 && LV_HAVE_GFNI
+#include <immintrin.h>
+
+static inline void volk_32u_reverse_32u_u_avx2_gfni(uint32_t* out,
+                                                    const uint32_t* in,
+                                                    unsigned int num_points)
+{
+    const uint32_t* in_ptr = in;
+    uint32_t* out_ptr = out;
+
+    // the affine transform with this bit matrix reverses the bits of each byte
+    const __m256i bit_reverse = _mm256_set1_epi64x(0x8040201008040201LL);
+    const __m256i idx = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+    for (; number < eighthPoints; ++number) {
+        const __m256i x =
+            _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)in_ptr), idx);
+        _mm256_storeu_si256((__m256i*)out_ptr,
+                            _mm256_gf2p8affine_epi64_epi8(x, bit_reverse, 0));
+        in_ptr += 8;
+        out_ptr += 8;
+    }
+    number = eighthPoints * 8;
+    for (; number < num_points; ++number) {
+        *out_ptr = (BitReverseTable256[*in_ptr & 0xff] << 24) |
+                   (BitReverseTable256[(*in_ptr >> 8) & 0xff] << 16) |
+                   (BitReverseTable256[(*in_ptr >> 16) & 0xff] << 8) |
+                   (BitReverseTable256[(*in_ptr >> 24) & 0xff]);
+        ++in_ptr;
+        ++out_ptr;
+    }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_GFNI */
+
+#if LV_HAVE_AVX512BW && LV_HAVE_GFNI
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32u_reverse_32u_u_avx512bw_gfni(uint32_t* out,
+                                                        const uint32_t* in,
+                                                        unsigned int num_points)
+{
+    const uint32_t* in_ptr = in;
+    uint32_t* out_ptr = out;
+
+    // the affine transform with this bit matrix reverses the bits of each byte
+    const __m512i bit_reverse = _mm512_set1_epi64(0x8040201008040201LL);
+    const __m512i idx = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number = 0;
+    for (; number < sixteenthPoints; ++number) {
+        const __m512i x = _mm512_shuffle_epi8(_mm512_loadu_si512(in_ptr), idx);
+        _mm512_storeu_si512(out_ptr, _mm512_gf2p8affine_epi64_epi8(x, bit_reverse, 0));
+        in_ptr += 16;
+        out_ptr += 16;
+    }
+
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __mmask16 mask = _mm512_tail_mask_ps(num_points - sixteenthPoints * 16);
+    const __m512i x = _mm512_shuffle_epi8(_mm512_maskz_loadu_epi32(mask, in_ptr), idx);
+    _mm512_mask_storeu_epi32(
+        out_ptr, mask, _mm512_gf2p8affine_epi64_epi8(x, bit_reverse, 0));
+}
+#endif /* LV_HAVE_AVX512BW && LV_HAVE_GFNI */
+
 
 #endif /* INCLUDED_volk_32u_reverse_32u_u_H */
@@ -189,6 +189,36 @@ static inline void volk_64f_convert_32f_generic(float* outputVector,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_64f_convert_32f_neonv8(float* outputVector,
+                                               const double* inputVector,
+                                               unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    float* outputVectorPtr = outputVector;
+    const double* inputVectorPtr = inputVector;
+
+    float64x2_t inputVal1, inputVal2;
+    for (; number < quarterPoints; number++) {
+        inputVal1 = vld1q_f64(inputVectorPtr);
+        inputVal2 = vld1q_f64(inputVectorPtr + 2);
+        inputVectorPtr += 4;
+
+        vst1q_f32(outputVectorPtr,
+                  vcvt_high_f32_f64(vcvt_f32_f64(inputVal1), inputVal2));
+        outputVectorPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *outputVectorPtr++ = ((float)(*inputVectorPtr++));
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
 
 #endif /* INCLUDED_volk_64f_convert_32f_u_H */
 #ifndef INCLUDED_volk_64f_convert_32f_a_H
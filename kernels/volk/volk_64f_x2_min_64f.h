@@ -64,6 +64,7 @@
 
 #ifdef LV_HAVE_AVX512F
 #include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
 
 static inline void volk_64f_x2_min_64f_a_avx512f(double* cVector,
                                                  const double* aVector,
@@ -92,18 +93,19 @@ static inline void volk_64f_x2_min_64f_a_avx512f(double* cVector,
         cPtr += 8;
     }
 
-    number = eigthPoints * 8;
-    for (; number < num_points; number++) {
-        const double a = *aPtr++;
-        const double b = *bPtr++;
-        *cPtr++ = (a < b ? a : b);
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __mmask8 mask = _mm512_tail_mask_pd(num_points - eigthPoints * 8);
+    aVal = _mm512_maskz_load_pd(mask, aPtr);
+    bVal = _mm512_maskz_load_pd(mask, bPtr);
+    cVal = _mm512_min_pd(aVal, bVal);
+    _mm512_mask_store_pd(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX512F */
 
 
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_64f_x2_min_64f_a_avx(double* cVector,
                                              const double* aVector,
@@ -132,12 +134,12 @@ static inline void volk_64f_x2_min_64f_a_avx(double* cVector,
         cPtr += 4;
     }
 
-    number = quarterPoints * 4;
-    for (; number < num_points; number++) {
-        const double a = *aPtr++;
-        const double b = *bPtr++;
-        *cPtr++ = (a < b ? a : b);
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __m256i mask = _mm256_tail_mask_pd(num_points - quarterPoints * 4);
+    aVal = _mm256_maskload_pd(aPtr, mask);
+    bVal = _mm256_maskload_pd(bPtr, mask);
+    cVal = _mm256_min_pd(aVal, bVal);
+    _mm256_maskstore_pd(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX */
 
@@ -213,6 +215,7 @@ static inline void volk_64f_x2_min_64f_generic(double* cVector,
 
 #ifdef LV_HAVE_AVX512F
 #include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
 
 static inline void volk_64f_x2_min_64f_u_avx512f(double* cVector,
                                                  const double* aVector,
@@ -241,18 +244,19 @@ static inline void volk_64f_x2_min_64f_u_avx512f(double* cVector,
         cPtr += 8;
     }
 
-    number = eigthPoints * 8;
-    for (; number < num_points; number++) {
-        const double a = *aPtr++;
-        const double b = *bPtr++;
-        *cPtr++ = (a < b ? a : b);
-    }
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __mmask8 mask = _mm512_tail_mask_pd(num_points - eigthPoints * 8);
+    aVal = _mm512_maskz_loadu_pd(mask, aPtr);
+    bVal = _mm512_maskz_loadu_pd(mask, bPtr);
+    cVal = _mm512_min_pd(aVal, bVal);
+    _mm512_mask_storeu_pd(cPtr, mask, cVal);
 }
 #endif /* LV_HAVE_AVX512F */
 
 
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
 
 static inline void volk_64f_x2_min_64f_u_avx(double* cVector,
                                              const double* aVector,
@@ -281,6 +285,44 @@ static inline void volk_64f_x2_min_64f_u_avx(double* cVector,
         cPtr += 4;
     }
 
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __m256i mask = _mm256_tail_mask_pd(num_points - quarterPoints * 4);
+    aVal = _mm256_maskload_pd(aPtr, mask);
+    bVal = _mm256_maskload_pd(bPtr, mask);
+    cVal = _mm256_min_pd(aVal, bVal);
+    _mm256_maskstore_pd(cPtr, mask, cVal);
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_64f_x2_min_64f_neonv8(double* cVector,
+                                              const double* aVector,
+                                              const double* bVector,
+                                              unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    double* cPtr = cVector;
+    const double* aPtr = aVector;
+    const double* bPtr = bVector;
+
+    float64x2_t aVal1, aVal2, bVal1, bVal2;
+    for (; number < quarterPoints; number++) {
+        aVal1 = vld1q_f64(aPtr);
+        aVal2 = vld1q_f64(aPtr + 2);
+        bVal1 = vld1q_f64(bPtr);
+        bVal2 = vld1q_f64(bPtr + 2);
+        aPtr += 4;
+        bPtr += 4;
+
+        vst1q_f64(cPtr, vminq_f64(aVal1, bVal1));
+        vst1q_f64(cPtr + 2, vminq_f64(aVal2, bVal2));
+        cPtr += 4;
+    }
+
     number = quarterPoints * 4;
     for (; number < num_points; number++) {
         const double a = *aPtr++;
@@ -288,7 +330,6 @@ static inline void volk_64f_x2_min_64f_u_avx(double* cVector,
         *cPtr++ = (a < b ? a : b);
     }
 }
-#endif /* LV_HAVE_AVX */
-
+#endif /* LV_HAVE_NEONV8 */
 
 #endif /* INCLUDED_volk_64f_x2_min_64f_u_H */
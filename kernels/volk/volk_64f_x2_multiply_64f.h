@@ -244,4 +244,40 @@ static inline void volk_64f_x2_multiply_64f_a_avx(double* cVector,
 
 #endif /* LV_HAVE_AVX */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_64f_x2_multiply_64f_neonv8(double* cVector,
+                                                   const double* aVector,
+                                                   const double* bVector,
+                                                   unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    double* cPtr = cVector;
+    const double* aPtr = aVector;
+    const double* bPtr = bVector;
+
+    float64x2_t aVal1, aVal2, bVal1, bVal2;
+    for (; number < quarterPoints; number++) {
+        aVal1 = vld1q_f64(aPtr);
+        aVal2 = vld1q_f64(aPtr + 2);
+        bVal1 = vld1q_f64(bPtr);
+        bVal2 = vld1q_f64(bPtr + 2);
+        aPtr += 4;
+        bPtr += 4;
+
+        vst1q_f64(cPtr, vmulq_f64(aVal1, bVal1));
+        vst1q_f64(cPtr + 2, vmulq_f64(aVal2, bVal2));
+        cPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *cPtr++ = (*aPtr++) * (*bPtr++);
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
 #endif /* INCLUDED_volk_64f_x2_multiply_64f_u_H */
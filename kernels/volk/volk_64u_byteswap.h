@@ -320,6 +320,34 @@ static inline void volk_64u_byteswap_neon(uint64_t* intsToSwap, unsigned int num
 #endif /* LV_HAVE_NEON */
 #endif
 
+#if LV_HAVE_AVX512BW
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+static inline void
+volk_64u_byteswap_u_avx512bw(uint64_t* intsToSwap, unsigned int num_points)
+{
+    unsigned int number;
+    const unsigned int eighthPoints = num_points / 8;
+
+    uint64_t* inputPtr = intsToSwap;
+
+    // reverses the bytes of each 64 bit value, the same in each 128 bit lane
+    const __m512i myShuffle = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+
+    for (number = 0; number < eighthPoints; number++) {
+        const __m512i input = _mm512_loadu_si512((void*)inputPtr);
+        _mm512_storeu_si512((void*)inputPtr, _mm512_shuffle_epi8(input, myShuffle));
+        inputPtr += 8;
+    }
+
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __mmask8 mask = _mm512_tail_mask_pd(num_points - eighthPoints * 8);
+    const __m512i input = _mm512_maskz_loadu_epi64(mask, inputPtr);
+    _mm512_mask_storeu_epi64(inputPtr, mask, _mm512_shuffle_epi8(input, myShuffle));
+}
+#endif /* LV_HAVE_AVX512BW */
+
 #endif /* INCLUDED_volk_64u_byteswap_u_H */
 #ifndef INCLUDED_volk_64u_byteswap_a_H
 #define INCLUDED_volk_64u_byteswap_a_H
@@ -497,5 +525,32 @@ static inline void volk_64u_byteswap_a_generic(uint64_t* intsToSwap,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#if LV_HAVE_AVX512BW
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+static inline void
+volk_64u_byteswap_a_avx512bw(uint64_t* intsToSwap, unsigned int num_points)
+{
+    unsigned int number;
+    const unsigned int eighthPoints = num_points / 8;
+
+    uint64_t* inputPtr = intsToSwap;
+
+    // reverses the bytes of each 64 bit value, the same in each 128 bit lane
+    const __m512i myShuffle = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+
+    for (number = 0; number < eighthPoints; number++) {
+        const __m512i input = _mm512_load_si512((void*)inputPtr);
+        _mm512_store_si512((void*)inputPtr, _mm512_shuffle_epi8(input, myShuffle));
+        inputPtr += 8;
+    }
+
+    // masked tail, the lanes past num_points are neither loaded nor stored
+    const __mmask8 mask = _mm512_tail_mask_pd(num_points - eighthPoints * 8);
+    const __m512i input = _mm512_maskz_loadu_epi64(mask, inputPtr);
+    _mm512_mask_storeu_epi64(inputPtr, mask, _mm512_shuffle_epi8(input, myShuffle));
+}
+#endif /* LV_HAVE_AVX512BW */
 
 #endif /* INCLUDED_volk_64u_byteswap_a_H */
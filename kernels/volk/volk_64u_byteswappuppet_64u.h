@@ -114,4 +114,26 @@ static inline void volk_64u_byteswappuppet_64u_a_avx2(uint64_t* output,
 }
 #endif
 
+#if LV_HAVE_AVX512BW
+static inline void volk_64u_byteswappuppet_64u_u_avx512bw(uint64_t* output,
+                                                          uint64_t* intsToSwap,
+                                                          unsigned int num_points)
+{
+
+    volk_64u_byteswap_u_avx512bw((uint64_t*)intsToSwap, num_points);
+    memcpy((void*)output, (void*)intsToSwap, num_points * sizeof(uint64_t));
+}
+#endif
+
+#if LV_HAVE_AVX512BW
+static inline void volk_64u_byteswappuppet_64u_a_avx512bw(uint64_t* output,
+                                                          uint64_t* intsToSwap,
+                                                          unsigned int num_points)
+{
+
+    volk_64u_byteswap_a_avx512bw((uint64_t*)intsToSwap, num_points);
+    memcpy((void*)output, (void*)intsToSwap, num_points * sizeof(uint64_t));
+}
+#endif
+
 #endif
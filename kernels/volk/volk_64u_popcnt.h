@@ -16,6 +16,10 @@
  * binary string. This kernel takes in a single unsigned 64-bit value
  * and returns the count of 1's that the value contains.
  *
+ * The call costs more than the count of a single value. To count the bits of a
+ * buffer, or the bits in which two buffers differ, use volk_8u_popcnt_64u or
+ * volk_8u_x2_hamming_distance_64u instead of calling this kernel per value.
+ *
  * <b>Dispatcher Prototype</b>
  * \code
  * void volk_64u_popcnt(uint64_t* ret, const uint64_t value)
@@ -0,0 +1,145 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8i_histogram_32u
+ *
+ * \b Overview
+ *
+ * Counts the occurrences of every 8-bit value, e.g. to watch an ADC for
+ * clipping or DC offsets. Bin i counts the value i - 128, so histogram[0]
+ * counts -128 and histogram[255] counts 127.
+ *
+ * The counts are added to the histogram rather than overwriting it. Clear it
+ * once and call the kernel for each block of a stream; histograms of separate
+ * streams merge by adding them bin by bin.
+ *
+ * Incrementing the same bin from consecutive samples stalls on store-to-load
+ * forwarding. The generic_subhist implementation spreads consecutive samples
+ * over four sub-histograms, and the avx512cd implementation resolves bins hit
+ * more than once within a vector with the AVX-512 conflict detection.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8i_histogram_32u(uint32_t* histogram, const int8_t* inputVector,
+ *                            unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li histogram: The 256 bins to add the counts to.
+ * \li inputVector: The input samples.
+ * \li num_points: The number of samples.
+ *
+ * \b Outputs
+ * \li histogram: The updated histogram.
+ *
+ * \b Example
+ * Count how often an 8-bit ADC hits its limits.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   int8_t* in = (int8_t*)volk_malloc(sizeof(int8_t)*N, alignment);
+ *   uint32_t histogram[256] = { 0 };
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       float x = 150.f * sinf(0.01f * ii);
+ *       in[ii] = (int8_t)((x > 127.f) ? 127.f : ((x < -128.f) ? -128.f : x));
+ *   }
+ *
+ *   volk_8i_histogram_32u(histogram, in, N);
+ *
+ *   printf("clipped low: %u, clipped high: %u\n", histogram[0], histogram[255]);
+ *
+ *   volk_free(in);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8i_histogram_32u_u_H
+#define INCLUDED_volk_8i_histogram_32u_u_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8i_histogram_32u_generic(uint32_t* histogram,
+                                                 const int8_t* inputVector,
+                                                 unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        histogram[inputVector[number] + 128]++;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8i_histogram_32u_generic_subhist(uint32_t* histogram,
+                                                         const int8_t* inputVector,
+                                                         unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+    const int8_t* inputPtr = inputVector;
+
+    // consecutive samples never increment the same counter
+    uint32_t sub[4][256];
+    memset(sub, 0, sizeof(sub));
+
+    for (; number < quarterPoints; number++) {
+        sub[0][inputPtr[0] + 128]++;
+        sub[1][inputPtr[1] + 128]++;
+        sub[2][inputPtr[2] + 128]++;
+        sub[3][inputPtr[3] + 128]++;
+        inputPtr += 4;
+    }
+
+    for (unsigned int i = 0; i < 256; i++) {
+        histogram[i] += sub[0][i] + sub[1][i] + sub[2][i] + sub[3][i];
+    }
+
+    number = quarterPoints * 4;
+    volk_8i_histogram_32u_generic(histogram, inputPtr, num_points - number);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512CD
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_8i_histogram_32u_avx512cd(uint32_t* histogram,
+                                                  const int8_t* inputVector,
+                                                  unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const int8_t* inputPtr = inputVector;
+
+    const __m512i offset = _mm512_set1_epi32(128);
+    __m512i index;
+
+    for (; number < sixteenthPoints; number++) {
+        index = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)inputPtr));
+        index = _mm512_add_epi32(index, offset);
+        _mm512_histogram_increment_avx512cd(histogram, index);
+        inputPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    volk_8i_histogram_32u_generic(histogram, inputPtr, num_points - number);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512CD */
+
+#endif /* INCLUDED_volk_8i_histogram_32u_u_H */
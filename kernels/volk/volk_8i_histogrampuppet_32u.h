@@ -0,0 +1,71 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_8I_HISTOGRAMPUPPET_32U_H
+#define INCLUDED_VOLK_8I_HISTOGRAMPUPPET_32U_H
+
+#include <string.h>
+#include <volk/volk_8i_histogram_32u.h>
+
+// The histogram occupies the first 256 outputs and is filled in two calls, the
+// second one adding to the counts of the first. The remaining outputs are zero.
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8i_histogrampuppet_32u_generic(uint32_t* outputVector,
+                                                       const int8_t* inputVector,
+                                                       unsigned int num_points)
+{
+    memset(outputVector, 0, num_points * sizeof(uint32_t));
+    if (num_points < 256) {
+        return;
+    }
+    const unsigned int split = num_points / 2;
+    volk_8i_histogram_32u_generic(outputVector, inputVector, split);
+    volk_8i_histogram_32u_generic(outputVector, inputVector + split, num_points - split);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8i_histogrampuppet_32u_generic_subhist(uint32_t* outputVector,
+                                                               const int8_t* inputVector,
+                                                               unsigned int num_points)
+{
+    memset(outputVector, 0, num_points * sizeof(uint32_t));
+    if (num_points < 256) {
+        return;
+    }
+    const unsigned int split = num_points / 2;
+    volk_8i_histogram_32u_generic_subhist(outputVector, inputVector, split);
+    volk_8i_histogram_32u_generic_subhist(outputVector,
+                                          inputVector + split,
+                                          num_points - split);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512CD
+
+static inline void volk_8i_histogrampuppet_32u_avx512cd(uint32_t* outputVector,
+                                                        const int8_t* inputVector,
+                                                        unsigned int num_points)
+{
+    memset(outputVector, 0, num_points * sizeof(uint32_t));
+    if (num_points < 256) {
+        return;
+    }
+    const unsigned int split = num_points / 2;
+    volk_8i_histogram_32u_avx512cd(outputVector, inputVector, split);
+    volk_8i_histogram_32u_avx512cd(outputVector, inputVector + split, num_points - split);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512CD */
+
+#endif /* INCLUDED_VOLK_8I_HISTOGRAMPUPPET_32U_H */
@@ -44,6 +44,44 @@
 #include <inttypes.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_8ic_deinterleave_16i_x2_a_avx512bw(int16_t* iBuffer,
+                                                           int16_t* qBuffer,
+                                                           const lv_8sc_t* complexVector,
+                                                           unsigned int num_points)
+{
+    unsigned int number = 0;
+    const int8_t* complexVectorPtr = (const int8_t*)complexVector;
+    int16_t* iBufferPtr = iBuffer;
+    int16_t* qBufferPtr = qBuffer;
+    const __m512i highMask = _mm512_set1_epi16((short)0xff00);
+    __m512i complexVal;
+
+    const unsigned int thirtysecondPoints = num_points / 32;
+
+    for (number = 0; number < thirtysecondPoints; number++) {
+        // every 16 bit value holds I in its low and Q in its high byte, scaling by 256
+        // moves I up to the high byte and leaves Q where it is
+        complexVal = _mm512_load_si512((const __m512i*)complexVectorPtr);
+        _mm512_store_si512((__m512i*)iBufferPtr, _mm512_slli_epi16(complexVal, 8));
+        _mm512_store_si512((__m512i*)qBufferPtr, _mm512_and_si512(complexVal, highMask));
+
+        complexVectorPtr += 64;
+        iBufferPtr += 32;
+        qBufferPtr += 32;
+    }
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++) {
+        *iBufferPtr++ = (int16_t)(*complexVectorPtr++) * 256;
+        *qBufferPtr++ = (int16_t)(*complexVectorPtr++) * 256;
+    }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
@@ -311,6 +349,44 @@ static inline void volk_8ic_deinterleave_16i_x2_generic(int16_t* iBuffer,
 #include <inttypes.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_8ic_deinterleave_16i_x2_u_avx512bw(int16_t* iBuffer,
+                                                           int16_t* qBuffer,
+                                                           const lv_8sc_t* complexVector,
+                                                           unsigned int num_points)
+{
+    unsigned int number = 0;
+    const int8_t* complexVectorPtr = (const int8_t*)complexVector;
+    int16_t* iBufferPtr = iBuffer;
+    int16_t* qBufferPtr = qBuffer;
+    const __m512i highMask = _mm512_set1_epi16((short)0xff00);
+    __m512i complexVal;
+
+    const unsigned int thirtysecondPoints = num_points / 32;
+
+    for (number = 0; number < thirtysecondPoints; number++) {
+        // every 16 bit value holds I in its low and Q in its high byte, scaling by 256
+        // moves I up to the high byte and leaves Q where it is
+        complexVal = _mm512_loadu_si512((const __m512i*)complexVectorPtr);
+        _mm512_storeu_si512((__m512i*)iBufferPtr, _mm512_slli_epi16(complexVal, 8));
+        _mm512_storeu_si512((__m512i*)qBufferPtr, _mm512_and_si512(complexVal, highMask));
+
+        complexVectorPtr += 64;
+        iBufferPtr += 32;
+        qBufferPtr += 32;
+    }
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++) {
+        *iBufferPtr++ = (int16_t)(*complexVectorPtr++) * 256;
+        *qBufferPtr++ = (int16_t)(*complexVectorPtr++) * 256;
+    }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
@@ -392,4 +468,43 @@ static inline void volk_8ic_deinterleave_16i_x2_u_avx2(int16_t* iBuffer,
     }
 }
 #endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8ic_deinterleave_16i_x2_neon(int16_t* iBuffer,
+                                                     int16_t* qBuffer,
+                                                     const lv_8sc_t* complexVector,
+                                                     unsigned int num_points)
+{
+    const int8_t* complexVectorPtr = (const int8_t*)complexVector;
+    int16_t* iBufferPtr = iBuffer;
+    int16_t* qBufferPtr = qBuffer;
+
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    int8x16x2_t complexVal;
+    for (; number < sixteenthPoints; number++) {
+        complexVal = vld2q_s8(complexVectorPtr);
+
+        // widen and scale by 256
+        vst1q_s16(iBufferPtr, vshll_n_s8(vget_low_s8(complexVal.val[0]), 8));
+        vst1q_s16(iBufferPtr + 8, vshll_n_s8(vget_high_s8(complexVal.val[0]), 8));
+        vst1q_s16(qBufferPtr, vshll_n_s8(vget_low_s8(complexVal.val[1]), 8));
+        vst1q_s16(qBufferPtr + 8, vshll_n_s8(vget_high_s8(complexVal.val[1]), 8));
+
+        complexVectorPtr += 32;
+        iBufferPtr += 16;
+        qBufferPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *iBufferPtr++ = (int16_t)(*complexVectorPtr++) * 256;
+        *qBufferPtr++ = (int16_t)(*complexVectorPtr++) * 256;
+    }
+}
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_8ic_deinterleave_16i_x2_u_H */
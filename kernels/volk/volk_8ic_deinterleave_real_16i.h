@@ -300,4 +300,34 @@ static inline void volk_8ic_deinterleave_real_16i_u_avx2(int16_t* iBuffer,
     }
 }
 #endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8ic_deinterleave_real_16i_neon(int16_t* iBuffer,
+                                                       const lv_8sc_t* complexVector,
+                                                       unsigned int num_points)
+{
+    const int8_t* complexVectorPtr = (const int8_t*)complexVector;
+    int16_t* iBufferPtr = iBuffer;
+    unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number;
+
+    int8x16x2_t complexInput;
+    for (number = 0; number < sixteenthPoints; number++) {
+        complexInput = vld2q_s8(complexVectorPtr);
+        vst1q_s16(iBufferPtr, vshlq_n_s16(vmovl_s8(vget_low_s8(complexInput.val[0])), 7));
+        vst1q_s16(iBufferPtr + 8,
+                  vshlq_n_s16(vmovl_s8(vget_high_s8(complexInput.val[0])), 7));
+        complexVectorPtr += 32;
+        iBufferPtr += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *iBufferPtr++ = ((int16_t)(*complexVectorPtr++)) * 128;
+        complexVectorPtr++;
+    }
+}
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_8ic_deinterleave_real_16i_u_H */
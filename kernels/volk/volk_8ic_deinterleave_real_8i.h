@@ -43,6 +43,38 @@
 #include <inttypes.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_8ic_deinterleave_real_8i_a_avx512bw(int8_t* iBuffer,
+                                                            const lv_8sc_t* complexVector,
+                                                            unsigned int num_points)
+{
+    unsigned int number = 0;
+    const int8_t* complexVectorPtr = (int8_t*)complexVector;
+    int8_t* iBufferPtr = iBuffer;
+    __m512i complexVal;
+
+    const unsigned int thirtysecondPoints = num_points / 32;
+
+    for (number = 0; number < thirtysecondPoints; number++) {
+        // the real part is the low byte of every 16 bit value, narrow it out
+        complexVal = _mm512_load_si512((const __m512i*)complexVectorPtr);
+        _mm256_store_si256((__m256i*)iBufferPtr, _mm512_cvtepi16_epi8(complexVal));
+
+        complexVectorPtr += 64;
+        iBufferPtr += 32;
+    }
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++) {
+        *iBufferPtr++ = *complexVectorPtr++;
+        complexVectorPtr++;
+    }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
@@ -300,6 +332,38 @@ static inline void volk_8ic_deinterleave_real_8i_neon(int8_t* iBuffer,
 #include <inttypes.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_8ic_deinterleave_real_8i_u_avx512bw(int8_t* iBuffer,
+                                                            const lv_8sc_t* complexVector,
+                                                            unsigned int num_points)
+{
+    unsigned int number = 0;
+    const int8_t* complexVectorPtr = (int8_t*)complexVector;
+    int8_t* iBufferPtr = iBuffer;
+    __m512i complexVal;
+
+    const unsigned int thirtysecondPoints = num_points / 32;
+
+    for (number = 0; number < thirtysecondPoints; number++) {
+        // the real part is the low byte of every 16 bit value, narrow it out
+        complexVal = _mm512_loadu_si512((const __m512i*)complexVectorPtr);
+        _mm256_storeu_si256((__m256i*)iBufferPtr, _mm512_cvtepi16_epi8(complexVal));
+
+        complexVectorPtr += 64;
+        iBufferPtr += 32;
+    }
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++) {
+        *iBufferPtr++ = *complexVectorPtr++;
+        complexVectorPtr++;
+    }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
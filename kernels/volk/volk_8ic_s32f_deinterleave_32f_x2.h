@@ -441,4 +441,48 @@ static inline void volk_8ic_s32f_deinterleave_32f_x2_u_avx2(float* iBuffer,
 }
 #endif /* LV_HAVE_AVX2 */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8ic_s32f_deinterleave_32f_x2_neon(float* iBuffer,
+                                                          float* qBuffer,
+                                                          const lv_8sc_t* complexVector,
+                                                          const float scalar,
+                                                          unsigned int num_points)
+{
+    const int8_t* complexVectorPtr = (const int8_t*)complexVector;
+    float* iBufferPtr = iBuffer;
+    float* qBufferPtr = qBuffer;
+    unsigned int eighthPoints = num_points / 8;
+    unsigned int number;
+    const float invScalar = 1.0 / scalar;
+
+    int8x8x2_t complexInput;
+    int16x8_t iValue, qValue;
+    for (number = 0; number < eighthPoints; number++) {
+        complexInput = vld2_s8(complexVectorPtr);
+        iValue = vmovl_s8(complexInput.val[0]);
+        qValue = vmovl_s8(complexInput.val[1]);
+
+        vst1q_f32(iBufferPtr,
+                  vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(iValue))), invScalar));
+        vst1q_f32(iBufferPtr + 4,
+                  vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(iValue))), invScalar));
+        vst1q_f32(qBufferPtr,
+                  vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(qValue))), invScalar));
+        vst1q_f32(qBufferPtr + 4,
+                  vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(qValue))), invScalar));
+
+        complexVectorPtr += 16;
+        iBufferPtr += 8;
+        qBufferPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *iBufferPtr++ = (float)(*complexVectorPtr++) * invScalar;
+        *qBufferPtr++ = (float)(*complexVectorPtr++) * invScalar;
+    }
+}
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_8ic_s32f_deinterleave_32f_x2_u_H */
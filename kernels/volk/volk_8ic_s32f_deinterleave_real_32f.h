@@ -349,5 +349,41 @@ volk_8ic_s32f_deinterleave_real_32f_u_avx2(float* iBuffer,
 }
 #endif /* LV_HAVE_AVX2 */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void
+volk_8ic_s32f_deinterleave_real_32f_neon(float* iBuffer,
+                                         const lv_8sc_t* complexVector,
+                                         const float scalar,
+                                         unsigned int num_points)
+{
+    const int8_t* complexVectorPtr = (const int8_t*)complexVector;
+    float* iBufferPtr = iBuffer;
+    unsigned int eighthPoints = num_points / 8;
+    unsigned int number;
+    const float invScalar = 1.0 / scalar;
+
+    int8x8x2_t complexInput;
+    int16x8_t iValue;
+    for (number = 0; number < eighthPoints; number++) {
+        complexInput = vld2_s8(complexVectorPtr);
+        iValue = vmovl_s8(complexInput.val[0]);
+
+        vst1q_f32(iBufferPtr,
+                  vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(iValue))), invScalar));
+        vst1q_f32(iBufferPtr + 4,
+                  vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(iValue))), invScalar));
+
+        complexVectorPtr += 16;
+        iBufferPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *iBufferPtr++ = ((float)(*complexVectorPtr++)) * invScalar;
+        complexVectorPtr++;
+    }
+}
+#endif /* LV_HAVE_NEON */
 
 #endif /* INCLUDED_volk_8ic_s32f_deinterleave_real_32f_u_H */
@@ -191,6 +191,66 @@ static inline void volk_8ic_x2_multiply_conjugate_16ic_generic(lv_16sc_t* cVecto
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_8ic_x2_multiply_conjugate_16ic_a_avx512bw(lv_16sc_t* cVector,
+                                                                  const lv_8sc_t* aVector,
+                                                                  const lv_8sc_t* bVector,
+                                                                  unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    __m512i x, y, realz, imagz;
+    lv_16sc_t* c = cVector;
+    const lv_8sc_t* a = aVector;
+    const lv_8sc_t* b = bVector;
+    const __m512i zero = _mm512_setzero_si512();
+
+    for (; number < sixteenthPoints; number++) {
+        // Convert 8 bit values into 16 bit values
+        x = _mm512_cvtepi8_epi16(_mm256_load_si256((const __m256i*)a));
+        y = _mm512_cvtepi8_epi16(_mm256_load_si256((const __m256i*)b));
+
+        // Calculate the ar*cr - ai*(-ci) portions
+        realz = _mm512_madd_epi16(x, y);
+
+        // Swap cr and ci and negate ci, the rotate swaps the halves of the 32 bit values
+        y = _mm512_rol_epi32(y, 16);
+        y = _mm512_mask_sub_epi16(y, 0x55555555, zero, y);
+
+        // Calculate the ar*(-ci) + cr*(ai)
+        imagz = _mm512_madd_epi16(x, y);
+
+        _mm512_store_si512((__m512i*)c,
+                           _mm512_packs_epi32(_mm512_unpacklo_epi32(realz, imagz),
+                                              _mm512_unpackhi_epi32(realz, imagz)));
+
+        a += 16;
+        b += 16;
+        c += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    int16_t* c16Ptr = (int16_t*)&cVector[number];
+    int8_t* a8Ptr = (int8_t*)&aVector[number];
+    int8_t* b8Ptr = (int8_t*)&bVector[number];
+    for (; number < num_points; number++) {
+        float aReal = (float)*a8Ptr++;
+        float aImag = (float)*a8Ptr++;
+        lv_32fc_t aVal = lv_cmake(aReal, aImag);
+        float bReal = (float)*b8Ptr++;
+        float bImag = (float)*b8Ptr++;
+        lv_32fc_t bVal = lv_cmake(bReal, -bImag);
+        lv_32fc_t temp = aVal * bVal;
+
+        *c16Ptr++ = (int16_t)lv_creal(temp);
+        *c16Ptr++ = (int16_t)lv_cimag(temp);
+    }
+}
+#endif /* LV_HAVE_AVX512BW */
+
 #endif /* INCLUDED_volk_8ic_x2_multiply_conjugate_16ic_a_H */
 
 #ifndef INCLUDED_volk_8ic_x2_multiply_conjugate_16ic_u_H
@@ -273,4 +333,110 @@ static inline void volk_8ic_x2_multiply_conjugate_16ic_u_avx2(lv_16sc_t* cVector
 }
 #endif /* LV_HAVE_AVX2 */
 
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_8ic_x2_multiply_conjugate_16ic_u_avx512bw(lv_16sc_t* cVector,
+                                                                  const lv_8sc_t* aVector,
+                                                                  const lv_8sc_t* bVector,
+                                                                  unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    __m512i x, y, realz, imagz;
+    lv_16sc_t* c = cVector;
+    const lv_8sc_t* a = aVector;
+    const lv_8sc_t* b = bVector;
+    const __m512i zero = _mm512_setzero_si512();
+
+    for (; number < sixteenthPoints; number++) {
+        // Convert 8 bit values into 16 bit values
+        x = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i*)a));
+        y = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i*)b));
+
+        // Calculate the ar*cr - ai*(-ci) portions
+        realz = _mm512_madd_epi16(x, y);
+
+        // Swap cr and ci and negate ci, the rotate swaps the halves of the 32 bit values
+        y = _mm512_rol_epi32(y, 16);
+        y = _mm512_mask_sub_epi16(y, 0x55555555, zero, y);
+
+        // Calculate the ar*(-ci) + cr*(ai)
+        imagz = _mm512_madd_epi16(x, y);
+
+        _mm512_storeu_si512((__m512i*)c,
+                           _mm512_packs_epi32(_mm512_unpacklo_epi32(realz, imagz),
+                                              _mm512_unpackhi_epi32(realz, imagz)));
+
+        a += 16;
+        b += 16;
+        c += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    int16_t* c16Ptr = (int16_t*)&cVector[number];
+    int8_t* a8Ptr = (int8_t*)&aVector[number];
+    int8_t* b8Ptr = (int8_t*)&bVector[number];
+    for (; number < num_points; number++) {
+        float aReal = (float)*a8Ptr++;
+        float aImag = (float)*a8Ptr++;
+        lv_32fc_t aVal = lv_cmake(aReal, aImag);
+        float bReal = (float)*b8Ptr++;
+        float bImag = (float)*b8Ptr++;
+        lv_32fc_t bVal = lv_cmake(bReal, -bImag);
+        lv_32fc_t temp = aVal * bVal;
+
+        *c16Ptr++ = (int16_t)lv_creal(temp);
+        *c16Ptr++ = (int16_t)lv_cimag(temp);
+    }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8ic_x2_multiply_conjugate_16ic_neon(lv_16sc_t* cVector,
+                                                            const lv_8sc_t* aVector,
+                                                            const lv_8sc_t* bVector,
+                                                            unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    int16_t* c16Ptr = (int16_t*)cVector;
+    const int8_t* a8Ptr = (const int8_t*)aVector;
+    const int8_t* b8Ptr = (const int8_t*)bVector;
+
+    int8x8x2_t aVal, bVal;
+    int16x8x2_t cVal;
+    for (; number < eighthPoints; number++) {
+        aVal = vld2_s8(a8Ptr);
+        bVal = vld2_s8(b8Ptr);
+
+        // ar*br + ai*bi | ai*br - ar*bi, wrapping in 16 bits like the generic
+        cVal.val[0] =
+            vmlal_s8(vmull_s8(aVal.val[0], bVal.val[0]), aVal.val[1], bVal.val[1]);
+        cVal.val[1] =
+            vmlsl_s8(vmull_s8(aVal.val[1], bVal.val[0]), aVal.val[0], bVal.val[1]);
+
+        vst2q_s16(c16Ptr, cVal);
+        a8Ptr += 16;
+        b8Ptr += 16;
+        c16Ptr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        const int16_t aReal = *a8Ptr++;
+        const int16_t aImag = *a8Ptr++;
+        const int16_t bReal = *b8Ptr++;
+        const int16_t bImag = *b8Ptr++;
+        *c16Ptr++ = (int16_t)(aReal * bReal + aImag * bImag);
+        *c16Ptr++ = (int16_t)(aImag * bReal - aReal * bImag);
+    }
+}
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_8ic_x2_multiply_conjugate_16ic_u_H */
@@ -340,5 +340,72 @@ volk_8ic_x2_s32f_multiply_conjugate_32fc_u_avx2(lv_32fc_t* cVector,
 }
 #endif /* LV_HAVE_AVX2*/
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void
+volk_8ic_x2_s32f_multiply_conjugate_32fc_neon(lv_32fc_t* cVector,
+                                              const lv_8sc_t* aVector,
+                                              const lv_8sc_t* bVector,
+                                              const float scalar,
+                                              unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    float* cPtr = (float*)cVector;
+    const int8_t* a8Ptr = (const int8_t*)aVector;
+    const int8_t* b8Ptr = (const int8_t*)bVector;
+    const float invScalar = 1.0 / scalar;
+
+    int8x8x2_t aValue, bValue;
+    int16x8_t realProd, realProd2, imagProd, imagProd2;
+    float32x4x2_t cVal;
+    for (; number < eighthPoints; number++) {
+        aValue = vld2_s8(a8Ptr);
+        bValue = vld2_s8(b8Ptr);
+
+        // the 8 bit products fit into 16 bits, their sums need 32 bits
+        realProd = vmull_s8(aValue.val[0], bValue.val[0]);
+        realProd2 = vmull_s8(aValue.val[1], bValue.val[1]);
+        imagProd = vmull_s8(aValue.val[1], bValue.val[0]);
+        imagProd2 = vmull_s8(aValue.val[0], bValue.val[1]);
+
+        cVal.val[0] = vcvtq_f32_s32(
+            vaddl_s16(vget_low_s16(realProd), vget_low_s16(realProd2)));
+        cVal.val[1] = vcvtq_f32_s32(
+            vsubl_s16(vget_low_s16(imagProd), vget_low_s16(imagProd2)));
+        cVal.val[0] = vmulq_n_f32(cVal.val[0], invScalar);
+        cVal.val[1] = vmulq_n_f32(cVal.val[1], invScalar);
+        vst2q_f32(cPtr, cVal);
+
+        cVal.val[0] = vcvtq_f32_s32(
+            vaddl_s16(vget_high_s16(realProd), vget_high_s16(realProd2)));
+        cVal.val[1] = vcvtq_f32_s32(
+            vsubl_s16(vget_high_s16(imagProd), vget_high_s16(imagProd2)));
+        cVal.val[0] = vmulq_n_f32(cVal.val[0], invScalar);
+        cVal.val[1] = vmulq_n_f32(cVal.val[1], invScalar);
+        vst2q_f32(cPtr + 8, cVal);
+
+        a8Ptr += 16;
+        b8Ptr += 16;
+        cPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        float aReal = (float)*a8Ptr++;
+        float aImag = (float)*a8Ptr++;
+        lv_32fc_t aVal = lv_cmake(aReal, aImag);
+        float bReal = (float)*b8Ptr++;
+        float bImag = (float)*b8Ptr++;
+        lv_32fc_t bVal = lv_cmake(bReal, -bImag);
+        lv_32fc_t temp = aVal * bVal;
+
+        *cPtr++ = (lv_creal(temp) * invScalar);
+        *cPtr++ = (lv_cimag(temp) * invScalar);
+    }
+}
+#endif /* LV_HAVE_NEON */
 
 #endif /* INCLUDED_volk_8ic_x2_s32f_multiply_conjugate_32fc_u_H */
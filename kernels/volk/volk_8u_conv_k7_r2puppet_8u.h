@@ -106,7 +106,8 @@ static inline void volk_8u_conv_k7_r2puppet_8u_spiral(unsigned char* syms,
     static int once = 1;
     int d_numstates = (1 << 6);
     int rate = 2;
-    static unsigned char* D;
+    static unsigned char* D = NULL;
+    static unsigned int D_framebits = 0;
     static unsigned char* Y;
     static unsigned char* X;
     static unsigned int excess = 6;
@@ -122,8 +123,6 @@ static inline void volk_8u_conv_k7_r2puppet_8u_spiral(unsigned char* syms,
         Y = X + d_numstates;
         Branchtab =
             (unsigned char*)volk_malloc(d_numstates / 2 * rate, volk_get_alignment());
-        D = (unsigned char*)volk_malloc((d_numstates / 8) * (framebits + 6),
-                                        volk_get_alignment());
         int state, i;
         int cnt, ti;
 
@@ -149,6 +148,19 @@ static inline void volk_8u_conv_k7_r2puppet_8u_spiral(unsigned char* syms,
         once = 0;
     }
 
+    // the decoder needs at least the tail of excess bits
+    if (framebits < 2 * excess) {
+        return;
+    }
+
+    // the decisions grow with the frame, callers may change the frame length
+    if (framebits > D_framebits) {
+        volk_free(D);
+        D = (unsigned char*)volk_malloc((d_numstates / 8) * (framebits + 6),
+                                        volk_get_alignment());
+        D_framebits = framebits;
+    }
+
     // unbias the old_metrics
     memset(X, 31, d_numstates);
 
@@ -188,7 +200,8 @@ static inline void volk_8u_conv_k7_r2puppet_8u_neonspiral(unsigned char* syms,
     static int once = 1;
     int d_numstates = (1 << 6);
     int rate = 2;
-    static unsigned char* D;
+    static unsigned char* D = NULL;
+    static unsigned int D_framebits = 0;
     static unsigned char* Y;
     static unsigned char* X;
     static unsigned int excess = 6;
@@ -204,8 +217,6 @@ static inline void volk_8u_conv_k7_r2puppet_8u_neonspiral(unsigned char* syms,
         Y = X + d_numstates;
         Branchtab =
             (unsigned char*)volk_malloc(d_numstates / 2 * rate, volk_get_alignment());
-        D = (unsigned char*)volk_malloc((d_numstates / 8) * (framebits + 6),
-                                        volk_get_alignment());
         int state, i;
         int cnt, ti;
 
@@ -231,6 +242,19 @@ static inline void volk_8u_conv_k7_r2puppet_8u_neonspiral(unsigned char* syms,
         once = 0;
     }
 
+    // the decoder needs at least the tail of excess bits
+    if (framebits < 2 * excess) {
+        return;
+    }
+
+    // the decisions grow with the frame, callers may change the frame length
+    if (framebits > D_framebits) {
+        volk_free(D);
+        D = (unsigned char*)volk_malloc((d_numstates / 8) * (framebits + 6),
+                                        volk_get_alignment());
+        D_framebits = framebits;
+    }
+
     // unbias the old_metrics
     memset(X, 31, d_numstates);
 
@@ -354,7 +378,8 @@ static inline void volk_8u_conv_k7_r2puppet_8u_generic(unsigned char* syms,
     int rate = 2;
     static unsigned char* Y;
     static unsigned char* X;
-    static unsigned char* D;
+    static unsigned char* D = NULL;
+    static unsigned int D_framebits = 0;
     static unsigned int excess = 6;
     static unsigned char* Branchtab;
     static unsigned char Partab[256];
@@ -368,8 +393,6 @@ static inline void volk_8u_conv_k7_r2puppet_8u_generic(unsigned char* syms,
         Y = X + d_numstates;
         Branchtab =
             (unsigned char*)volk_malloc(d_numstates / 2 * rate, volk_get_alignment());
-        D = (unsigned char*)volk_malloc((d_numstates / 8) * (framebits + 6),
-                                        volk_get_alignment());
 
         int state, i;
         int cnt, ti;
@@ -396,6 +419,19 @@ static inline void volk_8u_conv_k7_r2puppet_8u_generic(unsigned char* syms,
         once = 0;
     }
 
+    // the decoder needs at least the tail of excess bits
+    if (framebits < 2 * excess) {
+        return;
+    }
+
+    // the decisions grow with the frame, callers may change the frame length
+    if (framebits > D_framebits) {
+        volk_free(D);
+        D = (unsigned char*)volk_malloc((d_numstates / 8) * (framebits + 6),
+                                        volk_get_alignment());
+        D_framebits = framebits;
+    }
+
     // unbias the old_metrics
     memset(X, 31, d_numstates);
 
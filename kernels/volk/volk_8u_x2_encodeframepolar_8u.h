@@ -77,6 +77,12 @@ static inline void volk_8u_x2_encodeframepolar_8u_u_ssse3(unsigned char* frame,
                                                           unsigned char* temp,
                                                           unsigned int frame_size)
 {
+    // the last stages below process 16-bit chunks
+    if (frame_size < 16) {
+        volk_8u_x2_encodeframepolar_8u_generic(frame, temp, frame_size);
+        return;
+    }
+
     const unsigned int po2 = log2_of_power_of_2(frame_size);
 
     unsigned int stage = po2;
@@ -256,6 +262,12 @@ static inline void volk_8u_x2_encodeframepolar_8u_u_avx2(unsigned char* frame,
                                                          unsigned char* temp,
                                                          unsigned int frame_size)
 {
+    // the last stages below process 32-bit chunks
+    if (frame_size < 32) {
+        volk_8u_x2_encodeframepolar_8u_generic(frame, temp, frame_size);
+        return;
+    }
+
     const unsigned int po2 = log2_of_power_of_2(frame_size);
 
     unsigned int stage = po2;
@@ -612,6 +624,12 @@ static inline void volk_8u_x2_encodeframepolar_8u_a_ssse3(unsigned char* frame,
                                                           unsigned char* temp,
                                                           unsigned int frame_size)
 {
+    // the last stages below process 16-bit chunks
+    if (frame_size < 16) {
+        volk_8u_x2_encodeframepolar_8u_generic(frame, temp, frame_size);
+        return;
+    }
+
     const unsigned int po2 = log2_of_power_of_2(frame_size);
 
     unsigned int stage = po2;
@@ -790,6 +808,12 @@ static inline void volk_8u_x2_encodeframepolar_8u_a_avx2(unsigned char* frame,
                                                          unsigned char* temp,
                                                          unsigned int frame_size)
 {
+    // the last stages below process 32-bit chunks
+    if (frame_size < 32) {
+        volk_8u_x2_encodeframepolar_8u_generic(frame, temp, frame_size);
+        return;
+    }
+
     const unsigned int po2 = log2_of_power_of_2(frame_size);
 
     unsigned int stage = po2;
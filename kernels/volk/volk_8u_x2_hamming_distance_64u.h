@@ -0,0 +1,316 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_x2_hamming_distance_64u
+ *
+ * \b Overview
+ *
+ * Counts the bits in which two buffers of packed bits differ, e.g. to compare
+ * received bits with a known sequence when measuring the bit error rate or when
+ * searching for a sync word.
+ *
+ * The avx2 implementations count 16 vectors at a time with a Harley-Seal
+ * carry-save adder tree, the avx512vpopcntdq implementations use the vpopcntq
+ * instruction and the neon implementation uses vcnt.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_x2_hamming_distance_64u(uint64_t* result, const uint8_t* aVector,
+ *                                      const uint8_t* bVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aVector: The first buffer of packed bits.
+ * \li bVector: The second buffer of packed bits.
+ * \li num_points: The number of bytes in both buffers.
+ *
+ * \b Outputs
+ * \li result: The number of differing bits.
+ *
+ * \b Example
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* received = (uint8_t*)volk_malloc(sizeof(uint8_t)*N, alignment);
+ *   uint8_t* expected = (uint8_t*)volk_malloc(sizeof(uint8_t)*N, alignment);
+ *   uint64_t errors;
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       expected[ii] = (uint8_t)(ii * 37);
+ *       received[ii] = expected[ii] ^ ((ii % 100 == 0) ? 0x01 : 0x00);
+ *   }
+ *
+ *   volk_8u_x2_hamming_distance_64u(&errors, received, expected, N);
+ *   printf("bit errors: %llu\n", (unsigned long long)errors);
+ *
+ *   volk_free(received);
+ *   volk_free(expected);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_x2_hamming_distance_64u_u_H
+#define INCLUDED_volk_8u_x2_hamming_distance_64u_u_H
+
+#include <inttypes.h>
+#include <string.h>
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_x2_hamming_distance_64u_generic(uint64_t* result,
+                                                           const uint8_t* aVector,
+                                                           const uint8_t* bVector,
+                                                           unsigned int num_points)
+{
+    uint64_t count = 0;
+    unsigned int number = 0;
+    for (; number + 8 <= num_points; number += 8) {
+        uint64_t a, b;
+        memcpy(&a, aVector + number, sizeof(a));
+        memcpy(&b, bVector + number, sizeof(b));
+        count += volk_popcnt64(a ^ b);
+    }
+    for (; number < num_points; number++) {
+        count += volk_popcnt64(aVector[number] ^ bVector[number]);
+    }
+    *result = count;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_8u_x2_hamming_distance_64u_u_avx2(uint64_t* result,
+                                                          const uint8_t* aVector,
+                                                          const uint8_t* bVector,
+                                                          unsigned int num_points)
+{
+    const unsigned int blocks = num_points / 512;
+    const unsigned int remainingVectors = (num_points % 512) / 32;
+    __m256i in[16];
+    __m256i ones = _mm256_setzero_si256();
+    __m256i twos = _mm256_setzero_si256();
+    __m256i fours = _mm256_setzero_si256();
+    __m256i eights = _mm256_setzero_si256();
+    __m256i sixteens = _mm256_setzero_si256();
+
+    for (unsigned int block = 0; block < blocks; block++) {
+        for (unsigned int i = 0; i < 16; i++) {
+            in[i] = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)aVector + i),
+                                     _mm256_loadu_si256((const __m256i*)bVector + i));
+        }
+        sixteens = _mm256_add_epi64(
+            sixteens,
+            _mm256_popcnt_epi64_avx2(
+                _mm256_harley_seal_avx2(in, &ones, &twos, &fours, &eights)));
+        aVector += 512;
+        bVector += 512;
+    }
+    __m256i total = _mm256_harley_seal_total_avx2(sixteens, ones, twos, fours, eights);
+
+    for (unsigned int i = 0; i < remainingVectors; i++) {
+        const __m256i in0 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)aVector),
+                                             _mm256_loadu_si256((const __m256i*)bVector));
+        total = _mm256_add_epi64(total, _mm256_popcnt_epi64_avx2(in0));
+        aVector += 32;
+        bVector += 32;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) uint64_t partial[4];
+    _mm256_store_si256((__m256i*)partial, total);
+
+    uint64_t tail;
+    volk_8u_x2_hamming_distance_64u_generic(&tail, aVector, bVector, num_points % 32);
+    *result = partial[0] + partial[1] + partial[2] + partial[3] + tail;
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512VPOPCNTDQ
+#include <immintrin.h>
+
+static inline void
+volk_8u_x2_hamming_distance_64u_u_avx512vpopcntdq(uint64_t* result,
+                                                  const uint8_t* aVector,
+                                                  const uint8_t* bVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixtyfourthPoints = num_points / 64;
+    __m512i accumulator0 = _mm512_setzero_si512();
+    __m512i accumulator1 = _mm512_setzero_si512();
+
+    unsigned int number = 0;
+    for (; number + 2 <= sixtyfourthPoints; number += 2) {
+        const __m512i in0 = _mm512_xor_si512(_mm512_loadu_si512((const void*)aVector),
+                                             _mm512_loadu_si512((const void*)bVector));
+        const __m512i in1 =
+            _mm512_xor_si512(_mm512_loadu_si512((const void*)(aVector + 64)),
+                             _mm512_loadu_si512((const void*)(bVector + 64)));
+        accumulator0 = _mm512_add_epi64(accumulator0, _mm512_popcnt_epi64(in0));
+        accumulator1 = _mm512_add_epi64(accumulator1, _mm512_popcnt_epi64(in1));
+        aVector += 128;
+        bVector += 128;
+    }
+    for (; number < sixtyfourthPoints; number++) {
+        const __m512i in0 = _mm512_xor_si512(_mm512_loadu_si512((const void*)aVector),
+                                             _mm512_loadu_si512((const void*)bVector));
+        accumulator0 = _mm512_add_epi64(accumulator0, _mm512_popcnt_epi64(in0));
+        aVector += 64;
+        bVector += 64;
+    }
+
+    uint64_t tail;
+    volk_8u_x2_hamming_distance_64u_generic(&tail, aVector, bVector, num_points % 64);
+    const __m512i accumulator = _mm512_add_epi64(accumulator0, accumulator1);
+    *result = (uint64_t)_mm512_reduce_add_epi64(accumulator) + tail;
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512VPOPCNTDQ */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_x2_hamming_distance_64u_neon(uint64_t* result,
+                                                        const uint8_t* aVector,
+                                                        const uint8_t* bVector,
+                                                        unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    uint64x2_t accumulator = vdupq_n_u64(0);
+
+    unsigned int number = 0;
+    while (number < sixteenthPoints) {
+        // the 16 bit lanes take up to 16 bits per vector, fold them before they overflow
+        const unsigned int blockEnd =
+            (sixteenthPoints - number > 4095) ? number + 4095 : sixteenthPoints;
+        uint16x8_t blockAccumulator = vdupq_n_u16(0);
+        for (; number < blockEnd; number++) {
+            const uint8x16_t in0 = veorq_u8(vld1q_u8(aVector), vld1q_u8(bVector));
+            blockAccumulator = vpadalq_u8(blockAccumulator, vcntq_u8(in0));
+            aVector += 16;
+            bVector += 16;
+        }
+        accumulator = vpadalq_u32(accumulator, vpaddlq_u16(blockAccumulator));
+    }
+
+    uint64_t tail;
+    volk_8u_x2_hamming_distance_64u_generic(&tail, aVector, bVector, num_points % 16);
+    *result = vgetq_lane_u64(accumulator, 0) + vgetq_lane_u64(accumulator, 1) + tail;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_x2_hamming_distance_64u_u_H */
+
+
+#ifndef INCLUDED_volk_8u_x2_hamming_distance_64u_a_H
+#define INCLUDED_volk_8u_x2_hamming_distance_64u_a_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_8u_x2_hamming_distance_64u_a_avx2(uint64_t* result,
+                                                          const uint8_t* aVector,
+                                                          const uint8_t* bVector,
+                                                          unsigned int num_points)
+{
+    const unsigned int blocks = num_points / 512;
+    const unsigned int remainingVectors = (num_points % 512) / 32;
+    __m256i in[16];
+    __m256i ones = _mm256_setzero_si256();
+    __m256i twos = _mm256_setzero_si256();
+    __m256i fours = _mm256_setzero_si256();
+    __m256i eights = _mm256_setzero_si256();
+    __m256i sixteens = _mm256_setzero_si256();
+
+    for (unsigned int block = 0; block < blocks; block++) {
+        for (unsigned int i = 0; i < 16; i++) {
+            in[i] = _mm256_xor_si256(_mm256_load_si256((const __m256i*)aVector + i),
+                                     _mm256_load_si256((const __m256i*)bVector + i));
+        }
+        sixteens = _mm256_add_epi64(
+            sixteens,
+            _mm256_popcnt_epi64_avx2(
+                _mm256_harley_seal_avx2(in, &ones, &twos, &fours, &eights)));
+        aVector += 512;
+        bVector += 512;
+    }
+    __m256i total = _mm256_harley_seal_total_avx2(sixteens, ones, twos, fours, eights);
+
+    for (unsigned int i = 0; i < remainingVectors; i++) {
+        const __m256i in0 = _mm256_xor_si256(_mm256_load_si256((const __m256i*)aVector),
+                                             _mm256_load_si256((const __m256i*)bVector));
+        total = _mm256_add_epi64(total, _mm256_popcnt_epi64_avx2(in0));
+        aVector += 32;
+        bVector += 32;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) uint64_t partial[4];
+    _mm256_store_si256((__m256i*)partial, total);
+
+    uint64_t tail;
+    volk_8u_x2_hamming_distance_64u_generic(&tail, aVector, bVector, num_points % 32);
+    *result = partial[0] + partial[1] + partial[2] + partial[3] + tail;
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512VPOPCNTDQ
+#include <immintrin.h>
+
+static inline void
+volk_8u_x2_hamming_distance_64u_a_avx512vpopcntdq(uint64_t* result,
+                                                  const uint8_t* aVector,
+                                                  const uint8_t* bVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixtyfourthPoints = num_points / 64;
+    __m512i accumulator0 = _mm512_setzero_si512();
+    __m512i accumulator1 = _mm512_setzero_si512();
+
+    unsigned int number = 0;
+    for (; number + 2 <= sixtyfourthPoints; number += 2) {
+        const __m512i in0 = _mm512_xor_si512(_mm512_load_si512((const void*)aVector),
+                                             _mm512_load_si512((const void*)bVector));
+        const __m512i in1 =
+            _mm512_xor_si512(_mm512_load_si512((const void*)(aVector + 64)),
+                             _mm512_load_si512((const void*)(bVector + 64)));
+        accumulator0 = _mm512_add_epi64(accumulator0, _mm512_popcnt_epi64(in0));
+        accumulator1 = _mm512_add_epi64(accumulator1, _mm512_popcnt_epi64(in1));
+        aVector += 128;
+        bVector += 128;
+    }
+    for (; number < sixtyfourthPoints; number++) {
+        const __m512i in0 = _mm512_xor_si512(_mm512_load_si512((const void*)aVector),
+                                             _mm512_load_si512((const void*)bVector));
+        accumulator0 = _mm512_add_epi64(accumulator0, _mm512_popcnt_epi64(in0));
+        aVector += 64;
+        bVector += 64;
+    }
+
+    uint64_t tail;
+    volk_8u_x2_hamming_distance_64u_generic(&tail, aVector, bVector, num_points % 64);
+    const __m512i accumulator = _mm512_add_epi64(accumulator0, accumulator1);
+    *result = (uint64_t)_mm512_reduce_add_epi64(accumulator) + tail;
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512VPOPCNTDQ */
+
+#endif /* INCLUDED_volk_8u_x2_hamming_distance_64u_a_H */
@@ -0,0 +1,327 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*
+ * Differential fuzzer for the VOLK kernels. Every input picks a kernel from the QA
+ * list, a length, an element offset for all buffers and a value domain, and fills
+ * the input buffers from the remaining bytes. All impls of the kernel run on the
+ * same data and are compared against generic with the tolerances of the QA. Outside
+ * of the QA domain, they also have to agree on NaN and infinite outputs.
+ *
+ * Input layout:
+ *   bytes 0-1: kernel index into the QA list (little endian, modulo its size)
+ *   bytes 2-3: vlen (little endian, modulo max_len + 1)
+ *   byte 4:    buffer offset in items (modulo 16), aligned impls only run at 0
+ *   byte 5:    value domain, see volk_fuzz_domain_t
+ *   rest:      input data, continued by random data seeded from it if too short
+ *
+ * Built with ENABLE_LIBFUZZER, this is a libFuzzer target that aborts on the first
+ * mismatch. Otherwise volk_fuzz replays the files given on the command line or runs
+ * random inputs and stores the failing ones as volk_fuzz-crash-<run>.
+ *
+ * Options (both builds):
+ *   -volk_kernel=<regex>  only fuzz the kernels matching the regex
+ *   -volk_max_len=<n>     largest vlen (default 1024)
+ *   -volk_domain=<n>      only use one value domain
+ * Options (standalone build):
+ *   -runs=<n>             number of random inputs (default 10000)
+ *   -seed=<n>             seed for the random inputs
+ *   -volk_sweep=<n>       instead of random inputs, run every kernel at every vlen
+ *                         from 0 to n, at offsets 0 and 1, so that each SIMD width
+ *                         sees all tail lengths
+ */
+
+#include "kernel_tests.h" // for init_test_list
+#include "qa_utils.h"     // for volk_test_case_t, run_volk_diff_test
+
+#include <stdint.h>  // for uint8_t, uint16_t
+#include <algorithm> // for max
+#include <cmath>     // for ldexp
+#include <cstdlib>   // for abort, strtoul
+#include <fstream>   // for ifstream, ofstream
+#include <iostream>  // for cout, cerr
+#include <iterator>  // for istreambuf_iterator
+#include <limits>    // for numeric_limits
+#include <random>    // for mt19937
+#include <regex>     // for regex, regex_search
+#include <string>    // for string
+#include <vector>    // for vector
+
+enum volk_fuzz_domain_t {
+    VOLK_FUZZ_QA = 0,      // the distributions of the QA
+    VOLK_FUZZ_RAW = 1,     // the input bytes as they are, including NaN and Inf
+    VOLK_FUZZ_WIDE = 2,    // floats of any exponent, from denormals to near overflow
+    VOLK_FUZZ_SPECIAL = 3, // QA values mixed with zeros, denormals, Inf, NaN and limits
+    VOLK_FUZZ_NUM_DOMAINS = 4
+};
+
+static std::vector<volk_test_case_t> fuzz_cases;
+static unsigned int fuzz_max_len = 1024;
+static int fuzz_domain = -1;
+
+// Hands out the input data bytes. Once they are used up, it continues with random
+// bytes seeded from the data, as repeating the data would create ties that kernels
+// like index_max legitimately break differently.
+class volk_fuzz_bytes
+{
+public:
+    volk_fuzz_bytes(const uint8_t* data, size_t size) : _data(data), _size(size), _pos(0)
+    {
+        uint32_t hash = 2166136261u; // FNV-1a
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ data[i]) * 16777619u;
+        }
+        _rnd_engine.seed(hash);
+    }
+    uint8_t next()
+    {
+        if (_pos < _size) {
+            return _data[_pos++];
+        }
+        return (uint8_t)(_rnd_engine() >> 24);
+    }
+    void fill(void* buf, size_t n)
+    {
+        for (size_t i = 0; i < n; i++) {
+            ((uint8_t*)buf)[i] = next();
+        }
+    }
+    uint32_t next24() { return next() | (uint32_t(next()) << 8) | (uint32_t(next()) << 16); }
+
+private:
+    const uint8_t* _data;
+    size_t _size;
+    size_t _pos;
+    std::mt19937 _rnd_engine;
+};
+
+template <class t>
+static t fuzz_special(volk_fuzz_bytes& bytes)
+{
+    const t specials[] = { t(0),
+                           -t(0),
+                           std::numeric_limits<t>::denorm_min(),
+                           -std::numeric_limits<t>::min() / 4,
+                           std::numeric_limits<t>::min(),
+                           std::numeric_limits<t>::max(),
+                           -std::numeric_limits<t>::max(),
+                           std::numeric_limits<t>::infinity(),
+                           -std::numeric_limits<t>::infinity(),
+                           std::numeric_limits<t>::quiet_NaN(),
+                           t(1),
+                           t(-1) };
+    return specials[bytes.next() % (sizeof(specials) / sizeof(specials[0]))];
+}
+
+template <class t>
+static void fuzz_floats(t* buf, unsigned int n, int domain, volk_fuzz_bytes& bytes)
+{
+    const int min_exp = std::numeric_limits<t>::min_exponent -
+                        std::numeric_limits<t>::digits; // reaches the denormals
+    const int max_exp = std::numeric_limits<t>::max_exponent;
+    for (unsigned int i = 0; i < n; i++) {
+        const t uniform = t(bytes.next24()) / t(8388607.5) - t(1);
+        switch (domain) {
+        case VOLK_FUZZ_RAW:
+            bytes.fill(&buf[i], sizeof(t));
+            break;
+        case VOLK_FUZZ_WIDE:
+            buf[i] = std::ldexp(uniform, min_exp + bytes.next24() % (max_exp - min_exp));
+            break;
+        case VOLK_FUZZ_SPECIAL:
+            buf[i] = (bytes.next() % 4 == 0) ? fuzz_special<t>(bytes) : uniform;
+            break;
+        default:
+            buf[i] = uniform;
+        }
+    }
+}
+
+static void fuzz_load_data(void* buf,
+                           volk_type_t type,
+                           unsigned int n,
+                           int domain,
+                           volk_fuzz_bytes& bytes)
+{
+    if (type.is_complex) {
+        n *= 2;
+    }
+    if (type.is_float) {
+        if (type.size == 8) {
+            fuzz_floats((double*)buf, n, domain, bytes);
+        } else {
+            fuzz_floats((float*)buf, n, domain, bytes);
+        }
+    } else if (type.size == 2 && domain == VOLK_FUZZ_QA) {
+        // the QA keeps 16 bit integers small to avoid overflows in the kernels
+        for (unsigned int i = 0; i < n; i++) {
+            ((int16_t*)buf)[i] = (int16_t)((int16_t)bytes.next24() % 8);
+        }
+    } else {
+        bytes.fill(buf, (size_t)n * type.size);
+    }
+}
+
+// Runs one fuzzer input, returns true if an impl disagrees with generic
+static bool volk_fuzz_one(const uint8_t* data, size_t size)
+{
+    const size_t header_size = 6;
+    if (size < header_size || fuzz_cases.empty()) {
+        return false;
+    }
+    const unsigned int kernel = (data[0] | (data[1] << 8)) % fuzz_cases.size();
+    const unsigned int vlen = (data[2] | (data[3] << 8)) % (fuzz_max_len + 1);
+    const unsigned int offset = data[4] % 16;
+    const int domain = (fuzz_domain >= 0) ? fuzz_domain : data[5] % VOLK_FUZZ_NUM_DOMAINS;
+
+    volk_fuzz_bytes bytes(data + header_size, size - header_size);
+    volk_test_case_t test_case = fuzz_cases[kernel];
+    return run_volk_diff_test(test_case.desc(),
+                              test_case.kernel_ptr(),
+                              test_case.name(),
+                              test_case.test_parameters(),
+                              vlen,
+                              offset,
+                              [&](void* buf, volk_type_t type, unsigned int n) {
+                                  fuzz_load_data(buf, type, n, domain, bytes);
+                              },
+                              domain != VOLK_FUZZ_QA);
+}
+
+static void volk_fuzz_init(int argc, char** argv)
+{
+    std::string kernel_regex;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg(argv[i]);
+        if (arg.compare(0, 13, "-volk_kernel=") == 0) {
+            kernel_regex = arg.substr(13);
+        } else if (arg.compare(0, 14, "-volk_max_len=") == 0) {
+            fuzz_max_len = std::strtoul(arg.c_str() + 14, NULL, 10);
+        } else if (arg.compare(0, 13, "-volk_domain=") == 0) {
+            fuzz_domain = std::strtoul(arg.c_str() + 13, NULL, 10) % VOLK_FUZZ_NUM_DOMAINS;
+        }
+    }
+
+    volk_test_params_t test_params(1e-6f, 327.0, 0, 1, false, kernel_regex);
+    std::vector<volk_test_case_t> test_cases = init_test_list(test_params);
+    const std::regex kernel_filter(kernel_regex);
+    for (unsigned int i = 0; i < test_cases.size(); i++) {
+        if (std::regex_search(test_cases[i].name(), kernel_filter)) {
+            fuzz_cases.push_back(test_cases[i]);
+        }
+    }
+    std::cerr << "volk_fuzz: " << fuzz_cases.size() << " kernels, max_len "
+              << fuzz_max_len << std::endl;
+}
+
+#ifdef VOLK_LIBFUZZER
+
+extern "C" int LLVMFuzzerInitialize(int* argc, char*** argv)
+{
+    volk_fuzz_init(*argc, *argv);
+    return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    if (volk_fuzz_one(data, size)) {
+        abort();
+    }
+    return 0;
+}
+
+#else
+
+int main(int argc, char* argv[])
+{
+    volk_fuzz_init(argc, argv);
+
+    unsigned long runs = 10000;
+    unsigned long seed = std::random_device()();
+    unsigned int sweep = 0;
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg(argv[i]);
+        if (arg.compare(0, 6, "-runs=") == 0) {
+            runs = std::strtoul(arg.c_str() + 6, NULL, 10);
+        } else if (arg.compare(0, 6, "-seed=") == 0) {
+            seed = std::strtoul(arg.c_str() + 6, NULL, 10);
+        } else if (arg.compare(0, 12, "-volk_sweep=") == 0) {
+            sweep = std::strtoul(arg.c_str() + 12, NULL, 10);
+        } else if (arg[0] != '-') {
+            files.push_back(arg);
+        }
+    }
+
+    unsigned int fails = 0;
+    if (!files.empty()) {
+        for (unsigned int i = 0; i < files.size(); i++) {
+            std::ifstream file(files[i].c_str(), std::ios::binary);
+            std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)),
+                                      std::istreambuf_iterator<char>());
+            if (volk_fuzz_one(data.data(), data.size())) {
+                std::cerr << "Failure on " << files[i] << std::endl;
+                fails++;
+            }
+        }
+        return fails ? 1 : 0;
+    }
+
+    std::mt19937 rnd_engine(seed);
+    std::uniform_int_distribution<unsigned int> byte_dist(0, 255);
+
+    if (sweep) {
+        // the header of each input picks the kernel, vlen and offset, the data
+        // bytes are continued by the random data seeded from them
+        fuzz_max_len = std::max(fuzz_max_len, sweep);
+        std::cerr << "volk_fuzz: sweeping vlen 0 to " << sweep << std::endl;
+        for (unsigned int kernel = 0; kernel < fuzz_cases.size(); kernel++) {
+            for (unsigned int vlen = 0; vlen <= sweep; vlen++) {
+                for (unsigned int offset = 0; offset < 2; offset++) {
+                    const uint8_t data[] = { (uint8_t)kernel,
+                                             (uint8_t)(kernel >> 8),
+                                             (uint8_t)vlen,
+                                             (uint8_t)(vlen >> 8),
+                                             (uint8_t)offset,
+                                             (uint8_t)byte_dist(rnd_engine),
+                                             (uint8_t)byte_dist(rnd_engine) };
+                    if (volk_fuzz_one(data, sizeof(data))) {
+                        std::cerr << "Failure on " << fuzz_cases[kernel].name()
+                                  << " with vlen " << vlen << " at offset " << offset
+                                  << std::endl;
+                        fails++;
+                    }
+                }
+            }
+        }
+        std::cerr << "volk_fuzz: " << fails << " failures in the sweep" << std::endl;
+        return fails ? 1 : 0;
+    }
+
+    std::cerr << "volk_fuzz: " << runs << " runs with seed " << seed << std::endl;
+    std::uniform_int_distribution<size_t> size_dist(6, 6 + 4096);
+    for (unsigned long run = 0; run < runs; run++) {
+        std::vector<uint8_t> data(size_dist(rnd_engine));
+        for (size_t i = 0; i < data.size(); i++) {
+            data[i] = byte_dist(rnd_engine);
+        }
+        if (volk_fuzz_one(data.data(), data.size())) {
+            const std::string crash_name = "volk_fuzz-crash-" + std::to_string(run);
+            std::ofstream crash(crash_name.c_str(), std::ios::binary);
+            crash.write((const char*)data.data(), data.size());
+            std::cerr << "Failure, input written to " << crash_name << std::endl;
+            fails++;
+        }
+    }
+    std::cerr << "volk_fuzz: " << fails << " failures in " << runs << " runs"
+              << std::endl;
+    return fails ? 1 : 0;
+}
+
+#endif /* VOLK_LIBFUZZER */
@@ -54,6 +54,9 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_PUPP(volk_32fc_s32fc_rotatorpuppet_32fc,
                       volk_32fc_s32fc_x2_rotator_32fc,
                       test_params_rotator))
+    QA(VOLK_INIT_PUPP(volk_32f_x2_s32fc_rotatorpuppet_32f_x2,
+                      volk_32f_x2_s32fc_x2_rotator_32f_x2,
+                      test_params_rotator.make_absolute(1e-3)))
     QA(VOLK_INIT_PUPP(
         volk_8u_conv_k7_r2puppet_8u, volk_8u_x4_conv_k7_r2_8u, test_params.make_tol(0)))
     QA(VOLK_INIT_PUPP(
@@ -71,6 +74,7 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_TEST(volk_16i_s32f_convert_32f, test_params))
     QA(VOLK_INIT_TEST(volk_16i_convert_8i, test_params))
     QA(VOLK_INIT_TEST(volk_16i_32fc_dot_prod_32fc, test_params_inacc))
+    QA(VOLK_INIT_TEST(volk_16i_x2_dot_prod_32i, test_params))
     QA(VOLK_INIT_TEST(volk_32f_accumulator_s32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32f_x2_add_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32f_index_max_16u, test_params))
@@ -137,6 +141,12 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_TEST(volk_32f_stddev_and_mean_32f_x2, test_params.make_tol(1e-3)))
     QA(VOLK_INIT_TEST(volk_32f_x2_subtract_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32f_x3_sum_of_poly_32f, test_params_inacc))
+    QA(VOLK_INIT_TEST(volk_32f_x2_complex_magnitude_32f, test_params))
+    QA(VOLK_INIT_TEST(volk_32f_x4_complex_multiply_32f_x2,
+                      test_params.make_absolute(1e-5)))
+    QA(VOLK_INIT_TEST(volk_32f_x4_complex_multiply_conjugate_32f_x2,
+                      test_params.make_absolute(1e-5)))
+    QA(VOLK_INIT_TEST(volk_32f_x4_complex_dot_prod_32f_x2, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32i_x2_and_32i, test_params))
     QA(VOLK_INIT_TEST(volk_32i_s32f_convert_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32i_x2_or_32i, test_params))
@@ -155,6 +165,8 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_TEST(volk_8ic_x2_s32f_multiply_conjugate_32fc, test_params))
     QA(VOLK_INIT_TEST(volk_8i_convert_16i, test_params))
     QA(VOLK_INIT_TEST(volk_8i_s32f_convert_32f, test_params))
+    QA(VOLK_INIT_TEST(volk_8u_popcnt_64u, test_params))
+    QA(VOLK_INIT_TEST(volk_8u_x2_hamming_distance_64u, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_s32fc_multiply_32fc, test_params))
     QA(VOLK_INIT_TEST(volk_32f_s32f_multiply_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32f_s32f_add_32f, test_params))
@@ -173,6 +185,26 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_PUPP(volk_32fc_s32f_power_spectral_densitypuppet_32f,
                       volk_32fc_s32f_x2_power_spectral_density_32f,
                       test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_lut_interppuppet_32f, volk_32f_lut_interp_32f, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_lut_interppuppet_32fc, volk_32f_lut_interp_32fc, test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_farrow_resamplepuppet_32f,
+                      volk_32f_farrow_resample_32f,
+                      test_params.make_absolute(1e-5)))
+    QA(VOLK_INIT_PUPP(volk_32fc_farrow_resamplepuppet_32fc,
+                      volk_32fc_farrow_resample_32fc,
+                      test_params.make_tol(1e-3)))
+    QA(VOLK_INIT_PUPP(volk_32fc_goertzelpuppet_32fc,
+                      volk_32fc_goertzel_32fc,
+                      test_params.make_tol(1e-3)))
+    QA(VOLK_INIT_PUPP(volk_32f_agcpuppet_32f, volk_32f_agc_32f, test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_agcpuppet_32fc, volk_32fc_agc_32fc, test_params))
+    QA(VOLK_INIT_PUPP(volk_8i_histogrampuppet_32u, volk_8i_histogram_32u, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_16i_histogrampuppet_32u, volk_16i_histogram_32u, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_histogrampuppet_32u, volk_32f_histogram_32u, test_params))
     // no one uses these, so don't test them
     // VOLK_PROFILE(volk_16i_x5_add_quad_16i_x4, 1e-4, 2046, 10000, &results,
     // benchmark_mode, kernel_regex); VOLK_PROFILE(volk_16i_branch_4_state_8, 1e-4, 2046,
@@ -93,6 +93,24 @@ void load_random_data(void* data, volk_type_t type, unsigned int n)
     }
 }
 
+// scales random floats in (-1, 1) into the denormal range
+static void make_denormal(void* data, volk_type_t type, unsigned int n)
+{
+    if (!type.is_float) {
+        return;
+    }
+    if (type.is_complex) {
+        n *= 2;
+    }
+    for (unsigned int i = 0; i < n; i++) {
+        if (type.size == 8) {
+            ((double*)data)[i] *= std::numeric_limits<double>::min();
+        } else {
+            ((float*)data)[i] *= std::numeric_limits<float>::min();
+        }
+    }
+}
+
 static std::vector<std::string> get_arch_list(volk_func_desc_t desc)
 {
     std::vector<std::string> archlist;
@@ -289,6 +307,23 @@ inline void run_cast_test4(volk_fn_4arg func,
         func(buffs[0], buffs[1], buffs[2], buffs[3], vlen, arch.c_str());
 }
 
+inline void run_cast_test6(volk_fn_6arg func,
+                           std::vector<void*>& buffs,
+                           unsigned int vlen,
+                           unsigned int iter,
+                           std::string arch)
+{
+    while (iter--)
+        func(buffs[0],
+             buffs[1],
+             buffs[2],
+             buffs[3],
+             buffs[4],
+             buffs[5],
+             vlen,
+             arch.c_str());
+}
+
 inline void run_cast_test1_s32f(volk_fn_1arg_s32f func,
                                 std::vector<void*>& buffs,
                                 float scalar,
@@ -322,6 +357,17 @@ inline void run_cast_test3_s32f(volk_fn_3arg_s32f func,
         func(buffs[0], buffs[1], buffs[2], scalar, vlen, arch.c_str());
 }
 
+inline void run_cast_test4_s32f(volk_fn_4arg_s32f func,
+                                std::vector<void*>& buffs,
+                                float scalar,
+                                unsigned int vlen,
+                                unsigned int iter,
+                                std::string arch)
+{
+    while (iter--)
+        func(buffs[0], buffs[1], buffs[2], buffs[3], scalar, vlen, arch.c_str());
+}
+
 inline void run_cast_test1_s32fc(volk_fn_1arg_s32fc func,
                                  std::vector<void*>& buffs,
                                  lv_32fc_t scalar,
@@ -355,6 +401,17 @@ inline void run_cast_test3_s32fc(volk_fn_3arg_s32fc func,
         func(buffs[0], buffs[1], buffs[2], scalar, vlen, arch.c_str());
 }
 
+inline void run_cast_test4_s32fc(volk_fn_4arg_s32fc func,
+                                 std::vector<void*>& buffs,
+                                 lv_32fc_t scalar,
+                                 unsigned int vlen,
+                                 unsigned int iter,
+                                 std::string arch)
+{
+    while (iter--)
+        func(buffs[0], buffs[1], buffs[2], buffs[3], scalar, vlen, arch.c_str());
+}
+
 template <class t>
 bool fcompare(t* in1, t* in2, unsigned int vlen, float tol, bool absolute_mode)
 {
@@ -497,6 +554,223 @@ private:
     std::vector<void*> _mems;
 };
 
+static void run_volk_arch(void (*manual_func)(),
+                          const std::vector<volk_type_t>& both_sigs,
+                          const std::vector<volk_type_t>& inputsc,
+                          std::vector<void*>& buffs,
+                          lv_32fc_t scalar,
+                          unsigned int vlen,
+                          unsigned int iter,
+                          std::string arch)
+{
+    switch (both_sigs.size()) {
+    case 1:
+        if (inputsc.size() == 0) {
+            run_cast_test1((volk_fn_1arg)(manual_func), buffs, vlen, iter, arch);
+        } else if (inputsc.size() == 1 && inputsc[0].is_float) {
+            if (inputsc[0].is_complex) {
+                run_cast_test1_s32fc((volk_fn_1arg_s32fc)(manual_func),
+                                     buffs,
+                                     scalar,
+                                     vlen,
+                                     iter,
+                                     arch);
+            } else {
+                run_cast_test1_s32f((volk_fn_1arg_s32f)(manual_func),
+                                    buffs,
+                                    scalar.real(),
+                                    vlen,
+                                    iter,
+                                    arch);
+            }
+        } else
+            throw "unsupported 1 arg function >1 scalars";
+        break;
+    case 2:
+        if (inputsc.size() == 0) {
+            run_cast_test2((volk_fn_2arg)(manual_func), buffs, vlen, iter, arch);
+        } else if (inputsc.size() == 1 && inputsc[0].is_float) {
+            if (inputsc[0].is_complex) {
+                run_cast_test2_s32fc((volk_fn_2arg_s32fc)(manual_func),
+                                     buffs,
+                                     scalar,
+                                     vlen,
+                                     iter,
+                                     arch);
+            } else {
+                run_cast_test2_s32f((volk_fn_2arg_s32f)(manual_func),
+                                    buffs,
+                                    scalar.real(),
+                                    vlen,
+                                    iter,
+                                    arch);
+            }
+        } else
+            throw "unsupported 2 arg function >1 scalars";
+        break;
+    case 3:
+        if (inputsc.size() == 0) {
+            run_cast_test3((volk_fn_3arg)(manual_func), buffs, vlen, iter, arch);
+        } else if (inputsc.size() == 1 && inputsc[0].is_float) {
+            if (inputsc[0].is_complex) {
+                run_cast_test3_s32fc((volk_fn_3arg_s32fc)(manual_func),
+                                     buffs,
+                                     scalar,
+                                     vlen,
+                                     iter,
+                                     arch);
+            } else {
+                run_cast_test3_s32f((volk_fn_3arg_s32f)(manual_func),
+                                    buffs,
+                                    scalar.real(),
+                                    vlen,
+                                    iter,
+                                    arch);
+            }
+        } else
+            throw "unsupported 3 arg function >1 scalars";
+        break;
+    case 4:
+        if (inputsc.size() == 0) {
+            run_cast_test4((volk_fn_4arg)(manual_func), buffs, vlen, iter, arch);
+        } else if (inputsc.size() == 1 && inputsc[0].is_float) {
+            if (inputsc[0].is_complex) {
+                run_cast_test4_s32fc((volk_fn_4arg_s32fc)(manual_func),
+                                     buffs,
+                                     scalar,
+                                     vlen,
+                                     iter,
+                                     arch);
+            } else {
+                run_cast_test4_s32f((volk_fn_4arg_s32f)(manual_func),
+                                    buffs,
+                                    scalar.real(),
+                                    vlen,
+                                    iter,
+                                    arch);
+            }
+        } else
+            throw "unsupported 4 arg function >1 scalars";
+        break;
+    case 6:
+        run_cast_test6((volk_fn_6arg)(manual_func), buffs, vlen, iter, arch);
+        break;
+    default:
+        throw "no function handler for this signature";
+        break;
+    }
+}
+
+static bool compare_volk_buffers(const volk_type_t& sig,
+                                 void* ref,
+                                 void* test,
+                                 unsigned int vlen,
+                                 float tol_f,
+                                 unsigned int tol_i,
+                                 bool absolute_mode)
+{
+    bool fail = false;
+    if (sig.is_float) {
+        if (sig.size == 8) {
+            if (sig.is_complex) {
+                fail = ccompare((double*)ref, (double*)test, vlen, tol_f, absolute_mode);
+            } else {
+                fail = fcompare((double*)ref, (double*)test, vlen, tol_f, absolute_mode);
+            }
+        } else {
+            if (sig.is_complex) {
+                fail = ccompare((float*)ref, (float*)test, vlen, tol_f, absolute_mode);
+            } else {
+                fail = fcompare((float*)ref, (float*)test, vlen, tol_f, absolute_mode);
+            }
+        }
+    } else {
+        // i could replace this whole switch statement with a memcmp if i
+        // wasn't interested in printing the outputs where they differ
+        switch (sig.size) {
+        case 8:
+            if (sig.is_signed) {
+                fail = icompare((int64_t*)ref,
+                                (int64_t*)test,
+                                vlen * (sig.is_complex ? 2 : 1),
+                                tol_i,
+                                absolute_mode);
+            } else {
+                fail = icompare((uint64_t*)ref,
+                                (uint64_t*)test,
+                                vlen * (sig.is_complex ? 2 : 1),
+                                tol_i,
+                                absolute_mode);
+            }
+            break;
+        case 4:
+            if (sig.is_complex) {
+                if (sig.is_signed) {
+                    fail = icompare((int16_t*)ref,
+                                    (int16_t*)test,
+                                    vlen * (sig.is_complex ? 2 : 1),
+                                    tol_i,
+                                    absolute_mode);
+                } else {
+                    fail = icompare((uint16_t*)ref,
+                                    (uint16_t*)test,
+                                    vlen * (sig.is_complex ? 2 : 1),
+                                    tol_i,
+                                    absolute_mode);
+                }
+            } else {
+                if (sig.is_signed) {
+                    fail = icompare((int32_t*)ref,
+                                    (int32_t*)test,
+                                    vlen * (sig.is_complex ? 2 : 1),
+                                    tol_i,
+                                    absolute_mode);
+                } else {
+                    fail = icompare((uint32_t*)ref,
+                                    (uint32_t*)test,
+                                    vlen * (sig.is_complex ? 2 : 1),
+                                    tol_i,
+                                    absolute_mode);
+                }
+            }
+            break;
+        case 2:
+            if (sig.is_signed) {
+                fail = icompare((int16_t*)ref,
+                                (int16_t*)test,
+                                vlen * (sig.is_complex ? 2 : 1),
+                                tol_i,
+                                absolute_mode);
+            } else {
+                fail = icompare((uint16_t*)ref,
+                                (uint16_t*)test,
+                                vlen * (sig.is_complex ? 2 : 1),
+                                tol_i,
+                                absolute_mode);
+            }
+            break;
+        case 1:
+            if (sig.is_signed) {
+                fail = icompare((int8_t*)ref,
+                                (int8_t*)test,
+                                vlen * (sig.is_complex ? 2 : 1),
+                                tol_i,
+                                absolute_mode);
+            } else {
+                fail = icompare((uint8_t*)ref,
+                                (uint8_t*)test,
+                                vlen * (sig.is_complex ? 2 : 1),
+                                tol_i,
+                                absolute_mode);
+            }
+            break;
+        default:
+            fail = 1;
+        }
+    }
+    return fail;
+}
+
 bool run_volk_tests(volk_func_desc_t desc,
                     void (*manual_func)(),
                     std::string name,
@@ -514,7 +788,9 @@ bool run_volk_tests(volk_func_desc_t desc,
                           results,
                           puppet_master_name,
                           test_params.absolute_mode(),
-                          test_params.benchmark_mode());
+                          test_params.benchmark_mode(),
+                          test_params.denormal_inputs(),
+                          test_params.flush_denormals());
 }
 
 bool run_volk_tests(volk_func_desc_t desc,
@@ -527,7 +803,9 @@ bool run_volk_tests(volk_func_desc_t desc,
                     std::vector<volk_test_results_t>* results,
                     std::string puppet_master_name,
                     bool absolute_mode,
-                    bool benchmark_mode)
+                    bool benchmark_mode,
+                    bool denormal_inputs,
+                    bool flush_denormals)
 {
     // Initialize this entry in results vector
     results->push_back(volk_test_results_t());
@@ -587,6 +865,9 @@ bool run_volk_tests(volk_func_desc_t desc,
     }
     for (size_t i = 0; i < inbuffs.size(); i++) {
         load_random_data(inbuffs[i], inputsig[i], vlen);
+        if (denormal_inputs) {
+            make_denormal(inbuffs[i], inputsig[i], vlen);
+        }
     }
 
     // ok let's make a vector of vector of void buffers, which holds the input/output
@@ -617,87 +898,15 @@ bool run_volk_tests(volk_func_desc_t desc,
     vlen = vlen - vlen_twiddle;
     std::chrono::time_point<std::chrono::system_clock> start, end;
     std::vector<double> profile_times;
+    volk_fp_mode_t previous_fp_mode = { 0 };
+    if (flush_denormals) {
+        previous_fp_mode = volk_fp_mode_push();
+    }
     for (size_t i = 0; i < arch_list.size(); i++) {
         start = std::chrono::system_clock::now();
 
-        switch (both_sigs.size()) {
-        case 1:
-            if (inputsc.size() == 0) {
-                run_cast_test1(
-                    (volk_fn_1arg)(manual_func), test_data[i], vlen, iter, arch_list[i]);
-            } else if (inputsc.size() == 1 && inputsc[0].is_float) {
-                if (inputsc[0].is_complex) {
-                    run_cast_test1_s32fc((volk_fn_1arg_s32fc)(manual_func),
-                                         test_data[i],
-                                         scalar,
-                                         vlen,
-                                         iter,
-                                         arch_list[i]);
-                } else {
-                    run_cast_test1_s32f((volk_fn_1arg_s32f)(manual_func),
-                                        test_data[i],
-                                        scalar.real(),
-                                        vlen,
-                                        iter,
-                                        arch_list[i]);
-                }
-            } else
-                throw "unsupported 1 arg function >1 scalars";
-            break;
-        case 2:
-            if (inputsc.size() == 0) {
-                run_cast_test2(
-                    (volk_fn_2arg)(manual_func), test_data[i], vlen, iter, arch_list[i]);
-            } else if (inputsc.size() == 1 && inputsc[0].is_float) {
-                if (inputsc[0].is_complex) {
-                    run_cast_test2_s32fc((volk_fn_2arg_s32fc)(manual_func),
-                                         test_data[i],
-                                         scalar,
-                                         vlen,
-                                         iter,
-                                         arch_list[i]);
-                } else {
-                    run_cast_test2_s32f((volk_fn_2arg_s32f)(manual_func),
-                                        test_data[i],
-                                        scalar.real(),
-                                        vlen,
-                                        iter,
-                                        arch_list[i]);
-                }
-            } else
-                throw "unsupported 2 arg function >1 scalars";
-            break;
-        case 3:
-            if (inputsc.size() == 0) {
-                run_cast_test3(
-                    (volk_fn_3arg)(manual_func), test_data[i], vlen, iter, arch_list[i]);
-            } else if (inputsc.size() == 1 && inputsc[0].is_float) {
-                if (inputsc[0].is_complex) {
-                    run_cast_test3_s32fc((volk_fn_3arg_s32fc)(manual_func),
-                                         test_data[i],
-                                         scalar,
-                                         vlen,
-                                         iter,
-                                         arch_list[i]);
-                } else {
-                    run_cast_test3_s32f((volk_fn_3arg_s32f)(manual_func),
-                                        test_data[i],
-                                        scalar.real(),
-                                        vlen,
-                                        iter,
-                                        arch_list[i]);
-                }
-            } else
-                throw "unsupported 3 arg function >1 scalars";
-            break;
-        case 4:
-            run_cast_test4(
-                (volk_fn_4arg)(manual_func), test_data[i], vlen, iter, arch_list[i]);
-            break;
-        default:
-            throw "no function handler for this signature";
-            break;
-        }
+        run_volk_arch(
+            manual_func, both_sigs, inputsc, test_data[i], scalar, vlen, iter, arch_list[i]);
 
         end = std::chrono::system_clock::now();
         std::chrono::duration<double> elapsed_seconds = end - start;
@@ -712,6 +921,9 @@ bool run_volk_tests(volk_func_desc_t desc,
 
         profile_times.push_back(arch_time);
     }
+    if (flush_denormals) {
+        volk_fp_mode_pop(previous_fp_mode);
+    }
 
     // and now compare each output to the generic output
     // first we have to know which output is the generic one, they aren't in order...
@@ -731,120 +943,13 @@ bool run_volk_tests(volk_func_desc_t desc,
         fail = false;
         if (i != generic_offset) {
             for (size_t j = 0; j < both_sigs.size(); j++) {
-                if (both_sigs[j].is_float) {
-                    if (both_sigs[j].size == 8) {
-                        if (both_sigs[j].is_complex) {
-                            fail = ccompare((double*)test_data[generic_offset][j],
-                                            (double*)test_data[i][j],
-                                            vlen,
-                                            tol_f,
-                                            absolute_mode);
-                        } else {
-                            fail = fcompare((double*)test_data[generic_offset][j],
-                                            (double*)test_data[i][j],
-                                            vlen,
-                                            tol_f,
-                                            absolute_mode);
-                        }
-                    } else {
-                        if (both_sigs[j].is_complex) {
-                            fail = ccompare((float*)test_data[generic_offset][j],
-                                            (float*)test_data[i][j],
-                                            vlen,
-                                            tol_f,
-                                            absolute_mode);
-                        } else {
-                            fail = fcompare((float*)test_data[generic_offset][j],
-                                            (float*)test_data[i][j],
+                fail = compare_volk_buffers(both_sigs[j],
+                                            test_data[generic_offset][j],
+                                            test_data[i][j],
                                             vlen,
                                             tol_f,
-                                            absolute_mode);
-                        }
-                    }
-                } else {
-                    // i could replace this whole switch statement with a memcmp if i
-                    // wasn't interested in printing the outputs where they differ
-                    switch (both_sigs[j].size) {
-                    case 8:
-                        if (both_sigs[j].is_signed) {
-                            fail = icompare((int64_t*)test_data[generic_offset][j],
-                                            (int64_t*)test_data[i][j],
-                                            vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                            tol_i,
-                                            absolute_mode);
-                        } else {
-                            fail = icompare((uint64_t*)test_data[generic_offset][j],
-                                            (uint64_t*)test_data[i][j],
-                                            vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                            tol_i,
-                                            absolute_mode);
-                        }
-                        break;
-                    case 4:
-                        if (both_sigs[j].is_complex) {
-                            if (both_sigs[j].is_signed) {
-                                fail = icompare((int16_t*)test_data[generic_offset][j],
-                                                (int16_t*)test_data[i][j],
-                                                vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                                tol_i,
-                                                absolute_mode);
-                            } else {
-                                fail = icompare((uint16_t*)test_data[generic_offset][j],
-                                                (uint16_t*)test_data[i][j],
-                                                vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                                tol_i,
-                                                absolute_mode);
-                            }
-                        } else {
-                            if (both_sigs[j].is_signed) {
-                                fail = icompare((int32_t*)test_data[generic_offset][j],
-                                                (int32_t*)test_data[i][j],
-                                                vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                                tol_i,
-                                                absolute_mode);
-                            } else {
-                                fail = icompare((uint32_t*)test_data[generic_offset][j],
-                                                (uint32_t*)test_data[i][j],
-                                                vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                                tol_i,
-                                                absolute_mode);
-                            }
-                        }
-                        break;
-                    case 2:
-                        if (both_sigs[j].is_signed) {
-                            fail = icompare((int16_t*)test_data[generic_offset][j],
-                                            (int16_t*)test_data[i][j],
-                                            vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                            tol_i,
-                                            absolute_mode);
-                        } else {
-                            fail = icompare((uint16_t*)test_data[generic_offset][j],
-                                            (uint16_t*)test_data[i][j],
-                                            vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                            tol_i,
-                                            absolute_mode);
-                        }
-                        break;
-                    case 1:
-                        if (both_sigs[j].is_signed) {
-                            fail = icompare((int8_t*)test_data[generic_offset][j],
-                                            (int8_t*)test_data[i][j],
-                                            vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                            tol_i,
-                                            absolute_mode);
-                        } else {
-                            fail = icompare((uint8_t*)test_data[generic_offset][j],
-                                            (uint8_t*)test_data[i][j],
-                                            vlen * (both_sigs[j].is_complex ? 2 : 1),
                                             tol_i,
                                             absolute_mode);
-                        }
-                        break;
-                    default:
-                        fail = 1;
-                    }
-                }
                 if (fail) {
                     volk_test_time_t* result = &results->back().results[arch_list[i]];
                     result->pass = false;
@@ -885,3 +990,172 @@ bool run_volk_tests(volk_func_desc_t desc,
 
     return fail_global;
 }
+
+// NaNs in the same place and equal infinities are set to zero in both buffers, so
+// that the tolerance checks only see finite values. Any other non-finite value that
+// the two impls do not agree on is a failure.
+template <class t>
+static bool match_special_values(t* ref, t* test, unsigned int n)
+{
+    bool fail = false;
+    int print_max_errs = 10;
+    for (unsigned int i = 0; i < n; i++) {
+        if (std::isfinite(ref[i]) && std::isfinite(test[i])) {
+            continue;
+        }
+        if ((std::isnan(ref[i]) && std::isnan(test[i])) || ref[i] == test[i]) {
+            ref[i] = 0;
+            test[i] = 0;
+        } else {
+            fail = true;
+            if (print_max_errs-- > 0) {
+                std::cout << "offset " << i << " in1: " << ref[i] << " in2: " << test[i]
+                          << std::endl;
+            }
+        }
+    }
+    return fail;
+}
+
+bool run_volk_diff_test(volk_func_desc_t desc,
+                        void (*manual_func)(),
+                        std::string name,
+                        volk_test_params_t test_params,
+                        unsigned int vlen,
+                        unsigned int offset,
+                        volk_load_data_t load_data,
+                        bool check_special_values)
+{
+    // as in run_volk_tests, the buffers extend past vlen to catch bad writes
+    const unsigned int vlen_twiddle = 5;
+    const unsigned int buff_len = offset + vlen + vlen_twiddle;
+
+    const float tol_f = test_params.tol();
+    const unsigned int tol_i = static_cast<const unsigned int>(test_params.tol());
+
+    std::vector<std::string> arch_list = get_arch_list(desc);
+    size_t generic_offset = arch_list.size();
+    for (size_t i = 0; i < arch_list.size(); i++) {
+        if (arch_list[i] == "generic") {
+            generic_offset = i;
+        }
+    }
+    if (arch_list.size() < 2 || generic_offset == arch_list.size()) {
+        return false;
+    }
+
+    std::vector<volk_type_t> inputsig, outputsig;
+    try {
+        get_signatures_from_name(inputsig, outputsig, name);
+    } catch (std::exception& error) {
+        std::cerr << "Error: unable to get function signature from kernel name"
+                  << std::endl;
+        std::cerr << "  - " << name << std::endl;
+        return false;
+    }
+    std::vector<volk_type_t> inputsc;
+    for (size_t i = 0; i < inputsig.size(); i++) {
+        if (inputsig[i].is_scalar) {
+            inputsc.push_back(inputsig[i]);
+            inputsig.erase(inputsig.begin() + i);
+            i -= 1;
+        }
+    }
+
+    std::vector<volk_type_t> both_sigs;
+    both_sigs.insert(both_sigs.end(), outputsig.begin(), outputsig.end());
+    both_sigs.insert(both_sigs.end(), inputsig.begin(), inputsig.end());
+
+    // the aligned impls can only be run if the offset keeps every buffer aligned
+    bool offset_aligned = true;
+    std::vector<size_t> item_sizes;
+    for (size_t j = 0; j < both_sigs.size(); j++) {
+        item_sizes.push_back(both_sigs[j].size * (both_sigs[j].is_complex ? 2 : 1));
+        if ((offset * item_sizes[j]) % volk_get_alignment() != 0) {
+            offset_aligned = false;
+        }
+    }
+
+    volk_qa_aligned_mem_pool mem_pool;
+    std::vector<void*> inbuffs;
+    for (size_t j = 0; j < inputsig.size(); j++) {
+        const size_t item_size = item_sizes[outputsig.size() + j];
+        char* inbuff = (char*)mem_pool.get_new(buff_len * item_size);
+        load_data(inbuff + offset * item_size, inputsig[j], vlen + vlen_twiddle);
+        inbuffs.push_back(inbuff);
+    }
+
+    std::vector<std::vector<void*>> test_data;
+    std::vector<bool> arch_run;
+    for (size_t i = 0; i < arch_list.size(); i++) {
+        std::vector<void*> arch_buffs;
+        for (size_t j = 0; j < both_sigs.size(); j++) {
+            arch_buffs.push_back(mem_pool.get_new(buff_len * item_sizes[j]));
+        }
+        for (size_t j = 0; j < inputsig.size(); j++) {
+            memcpy(arch_buffs[outputsig.size() + j],
+                   inbuffs[j],
+                   buff_len * item_sizes[outputsig.size() + j]);
+        }
+        test_data.push_back(arch_buffs);
+        arch_run.push_back(offset_aligned || desc.impl_alignment[i] == 0);
+    }
+
+    for (size_t i = 0; i < arch_list.size(); i++) {
+        if (!arch_run[i]) {
+            continue;
+        }
+        std::vector<void*> arch_ptrs;
+        for (size_t j = 0; j < both_sigs.size(); j++) {
+            arch_ptrs.push_back((char*)test_data[i][j] + offset * item_sizes[j]);
+        }
+        run_volk_arch(manual_func,
+                      both_sigs,
+                      inputsc,
+                      arch_ptrs,
+                      test_params.scalar(),
+                      vlen,
+                      1,
+                      arch_list[i]);
+    }
+
+    // compare whole buffers, including the space before the offset
+    bool fail_global = false;
+    for (size_t i = 0; i < arch_list.size(); i++) {
+        if (i == generic_offset || !arch_run[i]) {
+            continue;
+        }
+        for (size_t j = 0; j < both_sigs.size(); j++) {
+            const size_t bytes = buff_len * item_sizes[j];
+            std::vector<char> ref((char*)test_data[generic_offset][j],
+                                  (char*)test_data[generic_offset][j] + bytes);
+            std::vector<char> test((char*)test_data[i][j], (char*)test_data[i][j] + bytes);
+            const unsigned int n = buff_len * (both_sigs[j].is_complex ? 2 : 1);
+            bool fail = false;
+            if (check_special_values && both_sigs[j].is_float) {
+                if (both_sigs[j].size == 8) {
+                    fail = match_special_values(
+                        (double*)ref.data(), (double*)test.data(), n);
+                } else {
+                    fail =
+                        match_special_values((float*)ref.data(), (float*)test.data(), n);
+                }
+            }
+            fail |= compare_volk_buffers(both_sigs[j],
+                                         ref.data(),
+                                         test.data(),
+                                         buff_len,
+                                         tol_f,
+                                         tol_i,
+                                         test_params.absolute_mode());
+            if (fail) {
+                fail_global = true;
+                std::cout << name << ": fail on arch " << arch_list[i]
+                          << " (vlen " << vlen << ", offset " << offset << ")"
+                          << std::endl;
+            }
+        }
+    }
+
+    return fail_global;
+}
@@ -13,6 +13,7 @@
 #include <stdbool.h>   // for bool, false
 #include <volk/volk.h> // for volk_func_desc_t
 #include <cstdlib>     // for NULL
+#include <functional>  // for function
 #include <map>         // for map
 #include <string>      // for string, basic_string
 #include <vector>      // for vector
@@ -61,6 +62,8 @@ private:
     unsigned int _iter;
     bool _benchmark_mode;
     bool _absolute_mode;
+    bool _denormal_inputs;
+    bool _flush_denormals;
     std::string _kernel_regex;
 
 public:
@@ -77,6 +80,8 @@ public:
           _iter(iter),
           _benchmark_mode(benchmark_mode),
           _absolute_mode(false),
+          _denormal_inputs(false),
+          _flush_denormals(false),
           _kernel_regex(kernel_regex){};
     // setters
     void set_tol(float tol) { _tol = tol; };
@@ -85,6 +90,10 @@ public:
     void set_iter(unsigned int iter) { _iter = iter; };
     void set_benchmark(bool benchmark) { _benchmark_mode = benchmark; };
     void set_regex(std::string regex) { _kernel_regex = regex; };
+    // fill the float inputs with denormals, e.g. to see what they cost
+    void set_denormal_inputs(bool denormal) { _denormal_inputs = denormal; };
+    // run the impls with volk_fp_mode_push() applied
+    void set_flush_denormals(bool flush) { _flush_denormals = flush; };
     // getters
     float tol() { return _tol; };
     lv_32fc_t scalar() { return _scalar; };
@@ -92,6 +101,8 @@ public:
     unsigned int iter() { return _iter; };
     bool benchmark_mode() { return _benchmark_mode; };
     bool absolute_mode() { return _absolute_mode; };
+    bool denormal_inputs() { return _denormal_inputs; };
+    bool flush_denormals() { return _flush_denormals; };
     std::string kernel_regex() { return _kernel_regex; };
     volk_test_params_t make_absolute(float tol)
     {
@@ -171,7 +182,25 @@ bool run_volk_tests(volk_func_desc_t,
                     std::vector<volk_test_results_t>* results = NULL,
                     std::string puppet_master_name = "NULL",
                     bool absolute_mode = false,
-                    bool benchmark_mode = false);
+                    bool benchmark_mode = false,
+                    bool denormal_inputs = false,
+                    bool flush_denormals = false);
+
+// Fills n items of the given type; used by run_volk_diff_test for the input buffers
+typedef std::function<void(void*, volk_type_t, unsigned int)> volk_load_data_t;
+
+// Runs every impl that can take buffers at the given element offset on the same
+// caller provided input and compares it against generic. With check_special_values,
+// impls also have to agree on where the outputs are NaN or infinite, which the QA
+// comparisons do not check. Returns true on failure.
+bool run_volk_diff_test(volk_func_desc_t,
+                        void (*)(),
+                        std::string,
+                        volk_test_params_t,
+                        unsigned int vlen,
+                        unsigned int offset,
+                        volk_load_data_t load_data,
+                        bool check_special_values = true);
 
 #define VOLK_PROFILE(func, test_params, results) \
     run_volk_tests(func##_get_func_desc(),       \
@@ -193,10 +222,14 @@ typedef void (*volk_fn_1arg)(void*,
 typedef void (*volk_fn_2arg)(void*, void*, unsigned int, const char*);
 typedef void (*volk_fn_3arg)(void*, void*, void*, unsigned int, const char*);
 typedef void (*volk_fn_4arg)(void*, void*, void*, void*, unsigned int, const char*);
+typedef void (*volk_fn_6arg)(
+    void*, void*, void*, void*, void*, void*, unsigned int, const char*);
 typedef void (*volk_fn_1arg_s32f)(
     void*, float, unsigned int, const char*); // one input vector, one scalar float input
 typedef void (*volk_fn_2arg_s32f)(void*, void*, float, unsigned int, const char*);
 typedef void (*volk_fn_3arg_s32f)(void*, void*, void*, float, unsigned int, const char*);
+typedef void (*volk_fn_4arg_s32f)(
+    void*, void*, void*, void*, float, unsigned int, const char*);
 typedef void (*volk_fn_1arg_s32fc)(
     void*,
     lv_32fc_t,
@@ -205,5 +238,7 @@ typedef void (*volk_fn_1arg_s32fc)(
 typedef void (*volk_fn_2arg_s32fc)(void*, void*, lv_32fc_t, unsigned int, const char*);
 typedef void (*volk_fn_3arg_s32fc)(
     void*, void*, void*, lv_32fc_t, unsigned int, const char*);
+typedef void (*volk_fn_4arg_s32fc)(
+    void*, void*, void*, void*, lv_32fc_t, unsigned int, const char*);
 
 #endif // VOLK_QA_UTILS_H
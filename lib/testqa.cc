@@ -20,7 +20,9 @@
 #include "volk/volk_complex.h" // for lv_32fc_t
 #include <volk/volk.h>
 
-void print_qa_xml(std::vector<volk_test_results_t> results, unsigned int nfails);
+void print_qa_xml(std::vector<volk_test_results_t> results,
+                  unsigned int nfails,
+                  std::string filename = ".unittest/kernels.xml");
 
 int main(int argc, char* argv[])
 {
@@ -39,24 +41,38 @@ int main(int argc, char* argv[])
     std::vector<volk_test_results_t> results;
 
     if (argc > 1) {
-        for (unsigned int ii = 0; ii < test_cases.size(); ++ii) {
-            if (std::string(argv[1]) == test_cases[ii].name()) {
+        // Run the kernels given on the command line. Every kernel writes its own XML
+        // report, so that separate processes (e.g. one ctest entry per kernel run
+        // with ctest -j) do not overwrite each other's results.
+        for (int arg = 1; arg < argc; ++arg) {
+            const std::string kernel_name(argv[arg]);
+            bool found = false;
+            for (unsigned int ii = 0; ii < test_cases.size(); ++ii) {
+                if (kernel_name != test_cases[ii].name()) {
+                    continue;
+                }
+                found = true;
                 volk_test_case_t test_case = test_cases[ii];
-                if (run_volk_tests(test_case.desc(),
-                                   test_case.kernel_ptr(),
-                                   test_case.name(),
-                                   test_case.test_parameters(),
-                                   &results,
-                                   test_case.puppet_master_name())) {
-                    return 1;
-                } else {
-                    return 0;
+                std::vector<volk_test_results_t> kernel_results;
+                const bool qa_result = run_volk_tests(test_case.desc(),
+                                                      test_case.kernel_ptr(),
+                                                      test_case.name(),
+                                                      test_case.test_parameters(),
+                                                      &kernel_results,
+                                                      test_case.puppet_master_name());
+                print_qa_xml(kernel_results,
+                             qa_result ? 1 : 0,
+                             ".unittest/" + test_case.name() + ".xml");
+                if (qa_result) {
+                    std::cerr << "Failure on " << test_case.name() << std::endl;
+                    qa_ret_val = 1;
                 }
             }
+            if (!found) {
+                std::cerr << "Did not run a test for kernel: " << kernel_name << " !"
+                          << std::endl;
+            }
         }
-        std::cerr << "Did not run a test for kernel: " << std::string(argv[1]) << " !"
-                  << std::endl;
-        return 0;
 
     } else {
         std::vector<std::string> qa_failures;
@@ -106,10 +122,12 @@ int main(int argc, char* argv[])
  * This function prints qa results as XML output similar to output
  * from Junit. For reference output see http://llg.cubic.org/docs/junit/
  */
-void print_qa_xml(std::vector<volk_test_results_t> results, unsigned int nfails)
+void print_qa_xml(std::vector<volk_test_results_t> results,
+                  unsigned int nfails,
+                  std::string filename)
 {
     std::ofstream qa_file;
-    qa_file.open(".unittest/kernels.xml");
+    qa_file.open(filename.c_str());
 
     qa_file << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << std::endl;
     qa_file << "<testsuites name=\"kernels\" "
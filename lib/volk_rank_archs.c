@@ -32,12 +32,25 @@ int volk_get_index(const char* impl_names[], // list of implementations by name
     return volk_get_index(impl_names, n_impls, "generic"); // but we'll fake it for now
 }
 
-int volk_rank_archs(const char* kern_name,    // name of the kernel to rank
-                    const char* impl_names[], // list of implementations by name
-                    const int* impl_deps,     // requirement mask per implementation
-                    const bool* alignment,    // alignment status of each implementation
-                    size_t n_impls,           // number of implementations available
-                    const bool align          // if false, filter aligned implementations
+/*
+ * Impls ending in _nt write their output with non-temporal stores, impls ending in
+ * _pf<n> prefetch their inputs n bytes ahead. Both only pay off for some vector
+ * lengths and machines, so they are never the default and are only used when
+ * volk_profile put them into the config.
+ */
+static bool volk_is_tuned_impl(const char* impl_name)
+{
+    const size_t len = strlen(impl_name);
+    return (len > 3 && !strcmp(impl_name + len - 3, "_nt")) ||
+           strstr(impl_name, "_pf") != NULL;
+}
+
+int volk_rank_archs(const char* kern_name,     // name of the kernel to rank
+                    const char* impl_names[],  // list of implementations by name
+                    const uint64_t* impl_deps, // requirement mask per implementation
+                    const bool* alignment,     // alignment status of each implementation
+                    size_t n_impls,            // number of implementations available
+                    const bool align           // if false, filter aligned implementations
 )
 {
     size_t i;
@@ -71,22 +84,24 @@ int volk_rank_archs(const char* kern_name,    // name of the kernel to rank
     // return the best index with the largest deps
     size_t best_index_a = 0;
     size_t best_index_u = 0;
-    int best_value_a = -1;
-    int best_value_u = -1;
+    bool found_a = false;
+    bool found_u = false;
     for (i = 0; i < n_impls; i++) {
-        const signed val = impl_deps[i];
-        if (alignment[i] && val > best_value_a) {
+        const uint64_t val = impl_deps[i];
+        if (volk_is_tuned_impl(impl_names[i]))
+            continue;
+        if (alignment[i] && (!found_a || val > impl_deps[best_index_a])) {
             best_index_a = i;
-            best_value_a = val;
+            found_a = true;
         }
-        if (!alignment[i] && val > best_value_u) {
+        if (!alignment[i] && (!found_u || val > impl_deps[best_index_u])) {
             best_index_u = i;
-            best_value_u = val;
+            found_u = true;
         }
     }
 
     // when align and we found a best aligned, use it
-    if (align && best_value_a != -1)
+    if (align && found_a)
         return best_index_a;
 
     // otherwise return the best unaligned
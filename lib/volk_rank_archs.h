@@ -11,6 +11,7 @@
 #define INCLUDED_VOLK_RANK_ARCHS_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #ifdef __cplusplus
@@ -22,12 +23,12 @@ int volk_get_index(const char* impl_names[], // list of implementations by name
                    const char* impl_name     // the implementation name to find
 );
 
-int volk_rank_archs(const char* kern_name,    // name of the kernel to rank
-                    const char* impl_names[], // list of implementations by name
-                    const int* impl_deps,     // requirement mask per implementation
-                    const bool* alignment,    // alignment status of each implementation
-                    size_t n_impls,           // number of implementations available
-                    const bool align          // if false, filter aligned implementations
+int volk_rank_archs(const char* kern_name,     // name of the kernel to rank
+                    const char* impl_names[],  // list of implementations by name
+                    const uint64_t* impl_deps, // requirement mask per implementation
+                    const bool* alignment,     // alignment status of each implementation
+                    size_t n_impls,            // number of implementations available
+                    const bool align           // if false, filter aligned implementations
 );
 
 #ifdef __cplusplus
@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright 2022 Free Software Foundation, Inc.
+#
+# This file is part of VOLK
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+"""
+VOLK kernels for Python.
+
+Every kernel takes the arguments of its C dispatcher, e.g.
+
+    volk.volk_32f_x2_add_32f(c, a, b, n)
+
+Vectors are objects with the buffer protocol, usually NumPy arrays. They are
+passed to the kernel in place, so they have to be C-contiguous, outputs have to be
+writable and the item type has to match the C type: float32 for float,
+complex64 for lv_32fc_t, int16 pairs for lv_16sc_t and so on. As in C, the caller
+makes sure that the vectors are long enough for the given number of points.
+The GIL is released while the kernel runs.
+
+Arrays from volk.empty come from volk_malloc, so the kernels take their aligned
+implementations for them.
+"""
+
+from ._volk import *
+from ._volk import Buffer, empty as _empty
+
+_complex_formats = {'F': 'Zf', 'D': 'Zd'}
+
+
+def empty(n, dtype='float32'):
+    """
+    Returns an uninitialized vector of n items in memory from volk_malloc.
+
+    With NumPy, dtype is anything numpy.dtype accepts and the result is a NumPy
+    array. Without it, dtype is a struct module format ('f', 'Zf', 'h', ...) and the
+    result is a memoryview.
+    """
+    try:
+        import numpy
+    except ImportError:
+        return memoryview(_empty(n, dtype))
+    dtype = numpy.dtype(dtype)
+    buf = _empty(n, _complex_formats.get(dtype.char, dtype.char))
+    return numpy.frombuffer(buf, dtype=dtype)
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright 2022 Free Software Foundation, Inc.
+#
+# This file is part of VOLK
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+import array
+import unittest
+
+import volk
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
+
+class test_volk_python(unittest.TestCase):
+    def test_buffer(self):
+        buf = volk._empty(100, 'Zf')
+        self.assertIsInstance(buf, volk.Buffer)
+        self.assertEqual(len(buf), 100)
+        view = memoryview(buf)
+        self.assertEqual((view.format, view.itemsize, view.nbytes), ('Zf', 8, 800))
+        self.assertFalse(view.readonly)
+        self.assertTrue(volk.is_aligned(buf))
+        self.assertGreater(volk.get_alignment(), 0)
+
+    def test_add(self):
+        n = 17
+        a = array.array('f', range(n))
+        b = array.array('f', [2.0] * n)
+        c = array.array('f', [0.0] * n)
+        volk.volk_32f_x2_add_32f(c, a, b, n)
+        self.assertEqual(list(c), [x + 2.0 for x in range(n)])
+
+    def test_type_checks(self):
+        a = array.array('f', [0.0] * 4)
+        self.assertRaises(TypeError, volk.volk_32f_x2_add_32f,
+                          a, a, array.array('d', [0.0] * 4), 4)
+        self.assertRaises(BufferError, volk.volk_32f_x2_add_32f,
+                          bytes(16), a, a, 4)
+        self.assertRaises(OverflowError, volk.volk_32f_x2_add_32f, a, a, a, -1)
+
+    @unittest.skipIf(numpy is None, "needs numpy")
+    def test_numpy(self):
+        n = 1000
+        a = volk.empty(n, numpy.complex64)
+        self.assertTrue(volk.is_aligned(a))
+        a[:] = numpy.exp(1j * numpy.arange(n)).astype(numpy.complex64)
+        mag = volk.empty(n, numpy.float32)
+        volk.volk_32fc_magnitude_32f(mag, a, n)
+        numpy.testing.assert_allclose(mag, numpy.ones(n), rtol=1e-5)
+
+        out = numpy.zeros(n, numpy.complex64)
+        volk.volk_32fc_s32fc_multiply_32fc(out, a, 2j, n)
+        numpy.testing.assert_allclose(out, a * 2j, rtol=1e-5)
+
+        self.assertRaises(ValueError, volk.volk_32fc_magnitude_32f,
+                          mag, a[::2], n // 2)
+
+
+if __name__ == '__main__':
+    unittest.main()
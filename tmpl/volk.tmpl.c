@@ -20,6 +20,24 @@
 static size_t __alignment = 0;
 static intptr_t __alignment_mask = 0;
 
+//a machine runs here if the cpu has all of its archs,
+//a tuned machine also needs one of the microarchitectures it is tuned for
+static bool machine_runs_here(const struct volk_machine *machine)
+{
+  const char *uarch = volk_get_cpu_microarch();
+  const size_t len = strlen(uarch);
+  const char *match;
+
+  if(machine->caps & (~volk_get_lvarch())) return false;
+  if(machine->uarchs[0] == '\0') return true;
+  if(len == 0) return false;
+  for(match = strstr(machine->uarchs, uarch); match != NULL; match = strstr(match + 1, uarch)) {
+    if((match == machine->uarchs || match[-1] == ' ') && (match[len] == ' ' || match[len] == '\0'))
+      return true;
+  }
+  return false;
+}
+
 struct volk_machine *get_machine(void)
 {
   extern struct volk_machine *volk_machines[];
@@ -29,12 +47,14 @@ struct volk_machine *get_machine(void)
   if(machine != NULL)
     return machine;
   else {
-    unsigned int max_score = 0;
+    uint64_t max_score = 0;
     unsigned int i;
     struct volk_machine *max_machine = NULL;
     for(i=0; i<n_volk_machines; i++) {
-      if(!(volk_machines[i]->caps & (~volk_get_lvarch()))) {
-        if(volk_machines[i]->caps > max_score) {
+      if(machine_runs_here(volk_machines[i])) {
+        //a tuned machine wins over the machine with the same archs
+        if(volk_machines[i]->caps > max_score ||
+           (volk_machines[i]->caps == max_score && volk_machines[i]->uarchs[0] != '\0')) {
           max_score = volk_machines[i]->caps;
           max_machine = volk_machines[i];
         }
@@ -55,7 +75,7 @@ void volk_list_machines(void)
 
   unsigned int i;
   for(i=0; i<n_volk_machines; i++) {
-    if(!(volk_machines[i]->caps & (~volk_get_lvarch()))) {
+    if(machine_runs_here(volk_machines[i])) {
         printf("%s;", volk_machines[i]->name);
     }
   }
@@ -64,27 +84,7 @@ void volk_list_machines(void)
 
 const char* volk_get_machine(void)
 {
-  extern struct volk_machine *volk_machines[];
-  extern unsigned int n_volk_machines;
-  static struct volk_machine *machine = NULL;
-
-  if(machine != NULL)
-    return machine->name;
-  else {
-    unsigned int max_score = 0;
-    unsigned int i;
-    struct volk_machine *max_machine = NULL;
-    for(i=0; i<n_volk_machines; i++) {
-      if(!(volk_machines[i]->caps & (~volk_get_lvarch()))) {
-        if(volk_machines[i]->caps > max_score) {
-          max_score = volk_machines[i]->caps;
-          max_machine = volk_machines[i];
-        }
-      }
-    }
-    machine = max_machine;
-    return machine->name;
-  }
+  return get_machine()->name;
 }
 
 size_t volk_get_alignment(void)
@@ -93,6 +93,18 @@ size_t volk_get_alignment(void)
     return __alignment;
 }
 
+volk_fp_mode_t volk_fp_mode_push(void)
+{
+    volk_fp_mode_t previous;
+    previous.state = get_machine()->fp_mode_push();
+    return previous;
+}
+
+void volk_fp_mode_pop(volk_fp_mode_t previous)
+{
+    get_machine()->fp_mode_pop(previous.state);
+}
+
 bool volk_is_aligned(const void *ptr)
 {
     return ((intptr_t)(ptr) & __alignment_mask) == 0;
@@ -131,15 +143,15 @@ static inline void __${kern.name}_d(${kern.arglist_full})
 
 static inline void __init_${kern.name}(void)
 {
-    const char *name = get_machine()->${kern.name}_name;
-    const char **impl_names = get_machine()->${kern.name}_impl_names;
-    const int *impl_deps = get_machine()->${kern.name}_impl_deps;
-    const bool *alignment = get_machine()->${kern.name}_impl_alignment;
-    const size_t n_impls = get_machine()->${kern.name}_n_impls;
+    const char *name = get_machine()->${kern.name}->name;
+    const char **impl_names = get_machine()->${kern.name}->impl_names;
+    const uint64_t *impl_deps = get_machine()->${kern.name}->impl_deps;
+    const bool *alignment = get_machine()->${kern.name}->impl_alignment;
+    const size_t n_impls = get_machine()->${kern.name}->n_impls;
     const size_t index_a = volk_rank_archs(name, impl_names, impl_deps, alignment, n_impls, true/*aligned*/);
     const size_t index_u = volk_rank_archs(name, impl_names, impl_deps, alignment, n_impls, false/*unaligned*/);
-    ${kern.name}_a = get_machine()->${kern.name}_impls[index_a];
-    ${kern.name}_u = get_machine()->${kern.name}_impls[index_u];
+    ${kern.name}_a = get_machine()->${kern.name}->impls[index_a];
+    ${kern.name}_u = get_machine()->${kern.name}->impls[index_u];
 
     assert(${kern.name}_a);
     assert(${kern.name}_u);
@@ -172,20 +184,20 @@ ${kern.pname} ${kern.name}   = &__${kern.name};
 void ${kern.name}_manual(${kern.arglist_full}, const char* impl_name)
 {
     const int index = volk_get_index(
-        get_machine()->${kern.name}_impl_names,
-        get_machine()->${kern.name}_n_impls,
+        get_machine()->${kern.name}->impl_names,
+        get_machine()->${kern.name}->n_impls,
         impl_name
     );
-    get_machine()->${kern.name}_impls[index](
+    get_machine()->${kern.name}->impls[index](
         ${kern.arglist_names}
     );
 }
 
-volk_func_desc_t ${kern.name}_get_func_desc(void) {
-    const char **impl_names = get_machine()->${kern.name}_impl_names;
-    const int *impl_deps = get_machine()->${kern.name}_impl_deps;
-    const bool *alignment = get_machine()->${kern.name}_impl_alignment;
-    const size_t n_impls = get_machine()->${kern.name}_n_impls;
+static volk_func_desc_t __${kern.name}_get_func_desc(void) {
+    const char **impl_names = get_machine()->${kern.name}->impl_names;
+    const uint64_t *impl_deps = get_machine()->${kern.name}->impl_deps;
+    const bool *alignment = get_machine()->${kern.name}->impl_alignment;
+    const size_t n_impls = get_machine()->${kern.name}->n_impls;
     volk_func_desc_t desc = {
         impl_names,
         impl_deps,
@@ -195,4 +207,61 @@ volk_func_desc_t ${kern.name}_get_func_desc(void) {
     return desc;
 }
 
+volk_func_desc_t ${kern.name}_get_func_desc(void) {
+    return __${kern.name}_get_func_desc();
+}
+
+%endfor
+
+static const struct {
+    volk_kernel_info_t info;
+    volk_func_desc_t (*get_func_desc)(void);
+} volk_kernel_registry[] = {
+%for kern in kernels:
+    { { "${kern.name}",
+        "${', '.join([arg_type.strip() for arg_type, arg_name in kern.args])}",
+        "${kern.arglist_names}",
+        ${len(kern.args)},
+        ${kern.bytes_per_point},
+        ${kern.flops_per_point} },
+      &__${kern.name}_get_func_desc },
+%endfor
+};
+
+size_t volk_kernel_count(void)
+{
+    return sizeof(volk_kernel_registry) / sizeof(volk_kernel_registry[0]);
+}
+
+volk_kernel_info_t volk_kernel_info(size_t index)
+{
+    if (index >= volk_kernel_count()) {
+        const volk_kernel_info_t none = { NULL };
+        return none;
+    }
+    volk_kernel_info_t info = volk_kernel_registry[index].info;
+    info.impls = volk_kernel_registry[index].get_func_desc();
+    return info;
+}
+
+static const char *volk_arch_names[] = {
+%for arch in archs:
+    "${arch.name}",
 %endfor
+};
+
+size_t volk_arch_count(void)
+{
+    return sizeof(volk_arch_names) / sizeof(volk_arch_names[0]);
+}
+
+const char* volk_arch_name(size_t index)
+{
+    if (index >= volk_arch_count()) return NULL;
+    return volk_arch_names[index];
+}
+
+uint64_t volk_get_machine_caps(void)
+{
+    return get_machine()->caps;
+}
@@ -19,17 +19,36 @@
 
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 __VOLK_DECL_BEGIN
 
 typedef struct volk_func_desc
 {
     const char **impl_names;
-    const int *impl_deps;
+    const uint64_t *impl_deps;
     const bool *impl_alignment;
     size_t n_impls;
 } volk_func_desc_t;
 
+//! Description of a kernel for tools that work on all kernels, see volk_kernel_info()
+typedef struct volk_kernel_info
+{
+    const char *name;        //!< kernel name, e.g. "volk_32f_x2_add_32f"
+    const char *arg_types;   //!< comma separated C types of the arguments
+    const char *arg_names;   //!< comma separated names of the arguments
+    size_t n_args;           //!< number of arguments
+    size_t bytes_per_point;  //!< bytes of all vector arguments per point
+    size_t flops_per_point;  //!< estimated floating point operations per point, 0 if unknown
+    volk_func_desc_t impls;  //!< implementations on this machine, deps are (1 << LV_<ARCH>) bits
+} volk_kernel_info_t;
+
+//! Floating point mode of a thread, as saved by volk_fp_mode_push()
+typedef struct volk_fp_mode
+{
+    unsigned int state;
+} volk_fp_mode_t;
+
 //! Prints a list of machines available
 VOLK_API void volk_list_machines(void);
 
@@ -39,6 +58,41 @@ VOLK_API const char* volk_get_machine(void);
 //! Get the machine alignment in bytes
 VOLK_API size_t volk_get_alignment(void);
 
+//! Returns the number of kernels in this build
+VOLK_API size_t volk_kernel_count(void);
+
+/*!
+ * Describes a kernel, e.g. to benchmark all kernels with their _manual functions.
+ * The kernels are sorted by name.
+ *
+ * \param index the kernel index, less than volk_kernel_count()
+ * \return the description, with a NULL name if the index is out of range
+ */
+VOLK_API volk_kernel_info_t volk_kernel_info(size_t index);
+
+//! Returns the number of archs known to this build, the LV_<ARCH> indices
+VOLK_API size_t volk_arch_count(void);
+
+//! Returns the name of the arch with the LV_<ARCH> index, NULL if out of range
+VOLK_API const char* volk_arch_name(size_t index);
+
+//! Returns the archs compiled into the current machine as (1 << LV_<ARCH>) bits
+VOLK_API uint64_t volk_get_machine_caps(void);
+
+/*!
+ * Applies the floating point environment that the archs of the current machine
+ * declare to the calling thread: on x86, denormal results are flushed to zero (sse)
+ * and denormal inputs are treated as zero (sse3). Kernels that see denormals, e.g.
+ * in decaying IIR filter or AGC signals, can otherwise be many times slower.
+ * Calls can be nested, every call has to be matched by volk_fp_mode_pop().
+ *
+ * \return the previous mode of the calling thread
+ */
+VOLK_API volk_fp_mode_t volk_fp_mode_push(void);
+
+//! Restores the floating point mode of the calling thread returned by volk_fp_mode_push()
+VOLK_API void volk_fp_mode_pop(volk_fp_mode_t previous);
+
 /*!
  * The VOLK_OR_PTR macro is a convenience macro
  * for checking the alignment of a set of pointers.
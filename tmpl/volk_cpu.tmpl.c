@@ -33,6 +33,10 @@ using namespace cpu_features;
 #endif
 #endif
 
+#if defined(__riscv) && defined(__linux__)
+#include <sys/auxv.h>
+#endif
+
 
 struct VOLK_CPU volk_cpu;
 
@@ -42,6 +46,15 @@ static int i_can_has_${arch.name} (void) {
         %if "neon" in arch.name:
 #if defined(CPU_FEATURES_ARCH_ARM)
     if (GetArmInfo().features.${check} == 0){ return 0; }
+#endif
+        %elif "sve" in arch.name:
+#if defined(CPU_FEATURES_ARCH_AARCH64)
+    if (GetAarch64Info().features.${check} == 0){ return 0; }
+#endif
+        %elif arch.name == "rvv":
+#if defined(__riscv) && defined(__linux__)
+    // the single letter extensions are the bits of AT_HWCAP, 'V' for the vectors
+    if ((getauxval(AT_HWCAP) & (1UL << ('V' - 'A'))) == 0){ return 0; }
 #endif
         %else:
 #if defined(CPU_FEATURES_ARCH_X86)
@@ -86,11 +99,25 @@ void volk_cpu_init() {
     set_float_rounding();
 }
 
-unsigned int volk_get_lvarch() {
-    unsigned int retval = 0;
+uint64_t volk_get_lvarch() {
+    uint64_t retval = 0;
     volk_cpu_init();
     %for arch in archs:
-    retval += volk_cpu.has_${arch.name}() << LV_${arch.name.upper()};
+    retval += (uint64_t)volk_cpu.has_${arch.name}() << LV_${arch.name.upper()};
     %endfor
     return retval;
 }
+
+//the microarchitecture name of cpu_features (e.g. INTEL_ICL, AMD_ZEN3), empty if unknown
+const char* volk_get_cpu_microarch() {
+#if defined(CPU_FEATURES_ARCH_X86)
+    static const char* microarch = NULL;
+    if (microarch == NULL) {
+        X86Info info = GetX86Info();
+        microarch = GetX86MicroarchitectureName(GetX86Microarchitecture(&info));
+    }
+    return microarch;
+#else
+    return "";
+#endif
+}
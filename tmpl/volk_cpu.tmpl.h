@@ -11,6 +11,7 @@
 #define INCLUDED_VOLK_CPU_H
 
 #include <volk/volk_common.h>
+#include <stdint.h>
 
 __VOLK_DECL_BEGIN
 
@@ -23,7 +24,8 @@ struct VOLK_CPU {
 extern struct VOLK_CPU volk_cpu;
 
 void volk_cpu_init ();
-unsigned int volk_get_lvarch ();
+uint64_t volk_get_lvarch ();
+const char* volk_get_cpu_microarch ();
 
 __VOLK_DECL_END
 
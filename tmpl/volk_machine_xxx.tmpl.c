@@ -8,11 +8,6 @@
  */
 
 <% this_machine = machine_dict[args[0]] %>
-<% arch_names = this_machine.arch_names %>
-
-%for arch in this_machine.archs:
-#define LV_HAVE_${arch.name.upper()} 1
-%endfor
 
 #include <volk/volk_common.h>
 #include "volk_machines.h"
@@ -22,28 +17,48 @@
 #include "config.h"
 #endif
 
+//the implementations of every kernel are compiled separately, see volk_machine_xxx_kernel.tmpl.c
 %for kern in kernels:
-#include <volk/${kern.name}.h>
+extern struct ${kern.name}_impls volk_machine_${this_machine.name}_${kern.name};
+%endfor
+
+<% env_archs = [arch for arch in this_machine.archs if arch.environment] %>
+%for arch in env_archs:
+#include <${arch.include}>
 %endfor
 
+//the environments of the archs only set MXCSR bits, FTZ for sse and DAZ for sse3
+static unsigned int fp_mode_push(void)
+{
+%if env_archs:
+    const unsigned int previous = _mm_getcsr();
+    %for arch in env_archs:
+    ${arch.environment}
+    %endfor
+    return previous;
+%else:
+    return 0;
+%endif
+}
+
+static void fp_mode_pop(unsigned int previous)
+{
+%if env_archs:
+    _mm_setcsr(previous);
+%else:
+    (void)previous;
+%endif
+}
+
 struct volk_machine volk_machine_${this_machine.name} = {
-<% make_arch_have_list = (' | '.join(['(1 << LV_%s)'%a.name.upper() for a in this_machine.archs])) %>    ${make_arch_have_list},
+<% make_arch_have_list = (' | '.join(['(UINT64_C(1) << LV_%s)'%a.name.upper() for a in this_machine.archs])) %>    ${make_arch_have_list},
 <% this_machine_name = "\""+this_machine.name+"\"" %>    ${this_machine_name},
     ${this_machine.alignment},
+    "${' '.join(this_machine.uarchs)}",
+    &fp_mode_push,
+    &fp_mode_pop,
 ##//list all kernels
     %for kern in kernels:
-<% impls = kern.get_impls(arch_names) %>
-##//kernel name
-<% kern_name = "\""+kern.name+"\"" %>    ${kern_name},
-##//list of kernel implementations by name
-<% make_impl_name_list = "{"+', '.join(['"%s"'%i.name for i in impls])+"}" %>    ${make_impl_name_list},
-##//list of arch dependencies per implementation
-<% make_impl_deps_list = "{"+', '.join([' | '.join(['(1 << LV_%s)'%d.upper() for d in i.deps]) for i in impls])+"}" %>    ${make_impl_deps_list},
-##//alignment required? for each implementation
-<% make_impl_align_list = "{"+', '.join(['true' if i.is_aligned else 'false' for i in impls])+"}" %>    ${make_impl_align_list},
-##//pointer to each implementation
-<% make_impl_fcn_list = "{"+', '.join(['%s_%s'%(kern.name, i.name) for i in impls])+"}" %>    ${make_impl_fcn_list},
-##//number of implementations listed here
-<% len_impls = len(impls) %>    ${len_impls},
+    &volk_machine_${this_machine.name}_${kern.name},
     %endfor
 };
@@ -14,21 +14,32 @@
 #include <volk/volk_typedefs.h>
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 __VOLK_DECL_BEGIN
 
+//the implementations of a kernel in one machine
+%for kern in kernels:
+struct ${kern.name}_impls {
+    const char *name;
+    const char *impl_names[<%len_archs=len(archs)%>${len_archs}];
+    const uint64_t impl_deps[${len_archs}];
+    const bool impl_alignment[${len_archs}];
+    const ${kern.pname} impls[${len_archs}];
+    const size_t n_impls;
+};
+
+%endfor
 struct volk_machine {
-    const unsigned int caps; //capabilities (i.e., archs compiled into this machine, in the volk_get_lvarch format)
+    const uint64_t caps; //capabilities (i.e., archs compiled into this machine, in the volk_get_lvarch format)
     const char *name;
     const size_t alignment; //the maximum byte alignment required for functions in this library
+    const char *uarchs; //space separated microarchitectures a tuned machine is selected on, empty for any
+    unsigned int (*fp_mode_push)(void); //applies the floating point environment of the archs, returns the previous one
+    void (*fp_mode_pop)(unsigned int); //restores a floating point environment returned by fp_mode_push
     %for kern in kernels:
-    const char *${kern.name}_name;
-    const char *${kern.name}_impl_names[<%len_archs=len(archs)%>${len_archs}];
-    const int ${kern.name}_impl_deps[${len_archs}];
-    const bool ${kern.name}_impl_alignment[${len_archs}];
-    const ${kern.pname} ${kern.name}_impls[${len_archs}];
-    const size_t ${kern.name}_n_impls;
+    struct ${kern.name}_impls *${kern.name};
     %endfor
 };
 
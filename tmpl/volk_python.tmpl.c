@@ -0,0 +1,436 @@
+/* -*- c -*- */
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*
+ * CPython extension module volk._volk. Every kernel is exposed with the arguments
+ * of its C dispatcher. Vectors are passed as objects with the buffer protocol,
+ * e.g. NumPy arrays, and are used in place without copies.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <limits.h>
+#include <string.h>
+#include <volk/constants.h>
+#include <volk/volk.h>
+
+<%
+    # pointer argument types: (item kind, item size)
+    pointer_types = {
+        'float': ('VOLK_PY_FLOAT', 4),
+        'double': ('VOLK_PY_FLOAT', 8),
+        'lv_32fc_t': ('VOLK_PY_COMPLEX', 8),
+        'lv_16sc_t': ('VOLK_PY_SIGNED', 2),
+        'lv_8sc_t': ('VOLK_PY_SIGNED', 1),
+        'int8_t': ('VOLK_PY_SIGNED', 1),
+        'unsigned char': ('VOLK_PY_UNSIGNED', 1),
+        'short': ('VOLK_PY_SIGNED', 2),
+        'int16_t': ('VOLK_PY_SIGNED', 2),
+        'uint16_t': ('VOLK_PY_UNSIGNED', 2),
+        'int': ('VOLK_PY_SIGNED', 4),
+        'int32_t': ('VOLK_PY_SIGNED', 4),
+        'uint32_t': ('VOLK_PY_UNSIGNED', 4),
+        'uint64_t': ('VOLK_PY_UNSIGNED', 8),
+    }
+    # scalar argument types: (C variable type, PyArg format)
+    scalar_types = {
+        'float': ('float', 'f'),
+        'double': ('double', 'd'),
+        'int': ('int', 'i'),
+        'unsigned int': ('unsigned int', 'O&'),
+        'uint32_t': ('unsigned int', 'O&'),
+        'uint64_t': ('unsigned long long', 'O&'),
+        'lv_32fc_t': ('Py_complex', 'D'),
+    }
+
+    def parse_arg(arg_type):
+        arg_type = arg_type.strip()
+        is_const = arg_type.startswith('const ')
+        base = arg_type.replace('const ', '', 1) if is_const else arg_type
+        if base.endswith('*'):
+            base = base[:-1].strip()
+            if base not in pointer_types:
+                return None
+            return ('pointer', base, not is_const)
+        if base not in scalar_types:
+            return None
+        return ('scalar', base, False)
+
+    # new code should not pick up the deprecated kernels, see volk.tmpl.h
+    deprecated_kernels = ('volk_16i_x5_add_quad_16i_x4', 'volk_16i_branch_4_state_8',
+                          'volk_16i_max_star_16i', 'volk_16i_max_star_horizontal_16i',
+                          'volk_16i_permute_and_scalar_add', 'volk_16i_x4_quad_max_star_16i')
+
+    def python_kernels():
+        result = list()
+        for kern in kernels:
+            if kern.name in deprecated_kernels:
+                continue
+            parsed = [parse_arg(arg_type) for arg_type, arg_name in kern.args]
+            if None not in parsed:
+                result.append((kern, parsed))
+        return result
+%>
+
+enum volk_py_kind { VOLK_PY_FLOAT, VOLK_PY_COMPLEX, VOLK_PY_SIGNED, VOLK_PY_UNSIGNED };
+
+static const char* volk_py_kind_names[] = { "float", "complex", "signed", "unsigned" };
+
+// Classifies a struct module format string as exported by the buffer protocol
+static int volk_py_format_kind(const char* format)
+{
+    if (format == NULL) {
+        return VOLK_PY_UNSIGNED; // plain bytes
+    }
+    if (format[0] == '@' || format[0] == '=' || format[0] == '<' ||
+        format[0] == '>' || format[0] == '!') {
+        // only the native byte order can be passed to the kernels
+        const int little_endian = (*(const uint16_t*)"\1\0" == 1);
+        if ((format[0] == '<' && !little_endian) ||
+            ((format[0] == '>' || format[0] == '!') && little_endian)) {
+            return -1;
+        }
+        format++;
+    }
+    if (format[0] == 'Z' && (format[1] == 'f' || format[1] == 'd') && !format[2]) {
+        return VOLK_PY_COMPLEX;
+    }
+    if (format[0] && format[1]) {
+        return -1;
+    }
+    switch (format[0]) {
+    case 'f':
+    case 'd':
+        return VOLK_PY_FLOAT;
+    case 'b':
+    case 'h':
+    case 'i':
+    case 'l':
+    case 'q':
+    case 'n':
+        return VOLK_PY_SIGNED;
+    case 'c':
+    case 'B':
+    case 'H':
+    case 'I':
+    case 'L':
+    case 'Q':
+    case 'N':
+        return VOLK_PY_UNSIGNED;
+    default:
+        return -1;
+    }
+}
+
+// Gets a contiguous view of obj and checks that its items match the kernel argument
+static int volk_py_get_buffer(PyObject* obj,
+                              Py_buffer* view,
+                              int kind,
+                              Py_ssize_t itemsize,
+                              int writable,
+                              const char* arg_name)
+{
+    const int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0);
+    if (PyObject_GetBuffer(obj, view, flags) < 0) {
+        return -1;
+    }
+    if (volk_py_format_kind(view->format) != kind || view->itemsize != itemsize) {
+        PyErr_Format(PyExc_TypeError,
+                     "%s: expected %s items of %zd bytes, got format '%s' of %zd bytes",
+                     arg_name,
+                     volk_py_kind_names[kind],
+                     itemsize,
+                     view->format ? view->format : "B",
+                     view->itemsize);
+        PyBuffer_Release(view);
+        return -1;
+    }
+    return 0;
+}
+
+static void volk_py_release_buffers(Py_buffer* views, int n_views)
+{
+    for (int i = 0; i < n_views; i++) {
+        PyBuffer_Release(&views[i]);
+    }
+}
+
+static int volk_py_uint(PyObject* obj, void* result)
+{
+    const unsigned long value = PyLong_AsUnsignedLong(obj);
+    if (PyErr_Occurred()) {
+        return 0;
+    }
+    if (value > UINT_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "value does not fit an unsigned int");
+        return 0;
+    }
+    *(unsigned int*)result = (unsigned int)value;
+    return 1;
+}
+
+static int volk_py_uint64(PyObject* obj, void* result)
+{
+    *(unsigned long long*)result = PyLong_AsUnsignedLongLong(obj);
+    return PyErr_Occurred() ? 0 : 1;
+}
+
+%for kern, parsed in python_kernels():
+<%
+    n_views = len([p for p in parsed if p[0] == 'pointer'])
+    parse_format = ''
+    parse_args = list()
+    call_args = list()
+    view_index = 0
+    for (arg_type, arg_name), (what, base, writable) in zip(kern.args, parsed):
+        if what == 'pointer':
+            parse_format += 'O'
+            parse_args.append('&obj_%s' % arg_name)
+            call_args.append('(%s)views[%d].buf' % (arg_type.strip(), view_index))
+            view_index += 1
+        else:
+            c_type, fmt = scalar_types[base]
+            parse_format += fmt
+            if base in ('unsigned int', 'uint32_t'):
+                parse_args.append('volk_py_uint')
+            elif base == 'uint64_t':
+                parse_args.append('volk_py_uint64')
+            parse_args.append('&%s' % arg_name)
+            if base == 'lv_32fc_t':
+                call_args.append('lv_cmake((float)%s.real, (float)%s.imag)' % (arg_name, arg_name))
+            else:
+                call_args.append(arg_name)
+%>
+static PyObject* volk_py_${kern.name}(PyObject* self, PyObject* args)
+{
+%for (arg_type, arg_name), (what, base, writable) in zip(kern.args, parsed):
+%if what == 'pointer':
+    PyObject* obj_${arg_name};
+%else:
+    ${scalar_types[base][0]} ${arg_name};
+%endif
+%endfor
+%if n_views:
+    Py_buffer views[${n_views}];
+    int n_views = 0;
+%endif
+
+    if (!PyArg_ParseTuple(args, "${parse_format}:${kern.name}", ${', '.join(parse_args)})) {
+        return NULL;
+    }
+<% view_index = 0 %>\
+%for (arg_type, arg_name), (what, base, writable) in zip(kern.args, parsed):
+%if what == 'pointer':
+    if (volk_py_get_buffer(obj_${arg_name},
+                           &views[${view_index}],
+                           ${pointer_types[base][0]},
+                           ${pointer_types[base][1]},
+                           ${1 if writable else 0},
+                           "${arg_name}") < 0) {
+        volk_py_release_buffers(views, n_views);
+        return NULL;
+    }
+    n_views++;
+<% view_index += 1 %>\
+%endif
+%endfor
+
+    // the kernels do not touch python objects, let other threads run meanwhile
+    Py_BEGIN_ALLOW_THREADS
+    ${kern.name}(${', '.join(call_args)});
+    Py_END_ALLOW_THREADS
+
+%if n_views:
+    volk_py_release_buffers(views, n_views);
+%endif
+    Py_RETURN_NONE;
+}
+
+%endfor
+
+/*
+ * volk._volk.Buffer: memory from volk_malloc, exported with the buffer protocol so
+ * that e.g. numpy.frombuffer can wrap it without a copy.
+ */
+typedef struct {
+    PyObject_HEAD void* data;
+    Py_ssize_t shape[1];
+    Py_ssize_t itemsize;
+    char format[4];
+} volk_py_buffer;
+
+static void volk_py_buffer_dealloc(volk_py_buffer* self)
+{
+    volk_free(self->data);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static int volk_py_buffer_getbuffer(volk_py_buffer* self, Py_buffer* view, int flags)
+{
+    if (PyBuffer_FillInfo(view,
+                          (PyObject*)self,
+                          self->data,
+                          self->shape[0] * self->itemsize,
+                          0,
+                          flags) < 0) {
+        return -1;
+    }
+    view->itemsize = self->itemsize;
+    view->format = (flags & PyBUF_FORMAT) ? self->format : NULL;
+    view->ndim = 1;
+    view->shape = (flags & PyBUF_ND) ? self->shape : NULL;
+    view->strides = (flags & PyBUF_STRIDES) ? &view->itemsize : NULL;
+    return 0;
+}
+
+static Py_ssize_t volk_py_buffer_len(volk_py_buffer* self) { return self->shape[0]; }
+
+static PyBufferProcs volk_py_buffer_procs = {
+    (getbufferproc)volk_py_buffer_getbuffer,
+    NULL,
+};
+
+static PySequenceMethods volk_py_buffer_sequence = {
+    (lenfunc)volk_py_buffer_len,
+};
+
+static PyTypeObject volk_py_buffer_type = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "volk._volk.Buffer",
+    .tp_basicsize = sizeof(volk_py_buffer),
+    .tp_dealloc = (destructor)volk_py_buffer_dealloc,
+    .tp_as_sequence = &volk_py_buffer_sequence,
+    .tp_as_buffer = &volk_py_buffer_procs,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = "Aligned memory from volk_malloc",
+};
+
+static PyObject* volk_py_empty(PyObject* self, PyObject* args)
+{
+    Py_ssize_t n;
+    const char* format;
+    if (!PyArg_ParseTuple(args, "ns:empty", &n, &format)) {
+        return NULL;
+    }
+
+    static const struct {
+        const char* format;
+        Py_ssize_t itemsize;
+    } formats[] = { { "f", sizeof(float) },      { "d", sizeof(double) },
+                    { "Zf", 2 * sizeof(float) }, { "Zd", 2 * sizeof(double) },
+                    { "b", 1 },                  { "B", 1 },
+                    { "h", 2 },                  { "H", 2 },
+                    { "i", sizeof(int) },        { "I", sizeof(int) },
+                    { "l", sizeof(long) },       { "L", sizeof(long) },
+                    { "q", 8 },                  { "Q", 8 } };
+    Py_ssize_t itemsize = 0;
+    for (size_t i = 0; i < sizeof(formats) / sizeof(formats[0]); i++) {
+        if (strcmp(format, formats[i].format) == 0) {
+            itemsize = formats[i].itemsize;
+        }
+    }
+    if (itemsize == 0) {
+        PyErr_Format(PyExc_ValueError, "unsupported format '%s'", format);
+        return NULL;
+    }
+    if (n < 0 || n > PY_SSIZE_T_MAX / itemsize) {
+        PyErr_SetString(PyExc_ValueError, "invalid number of items");
+        return NULL;
+    }
+
+    volk_py_buffer* buffer = PyObject_New(volk_py_buffer, &volk_py_buffer_type);
+    if (buffer == NULL) {
+        return NULL;
+    }
+    // volk_malloc may return NULL for a size of 0
+    buffer->data = volk_malloc(n ? n * itemsize : 1, volk_get_alignment());
+    if (buffer->data == NULL) {
+        Py_DECREF(buffer);
+        return PyErr_NoMemory();
+    }
+    buffer->shape[0] = n;
+    buffer->itemsize = itemsize;
+    strcpy(buffer->format, format);
+    return (PyObject*)buffer;
+}
+
+static PyObject* volk_py_is_aligned(PyObject* self, PyObject* obj)
+{
+    Py_buffer view;
+    if (PyObject_GetBuffer(obj, &view, PyBUF_SIMPLE) < 0) {
+        return NULL;
+    }
+    const bool aligned = volk_is_aligned(view.buf);
+    PyBuffer_Release(&view);
+    return PyBool_FromLong(aligned);
+}
+
+static PyObject* volk_py_get_alignment(PyObject* self, PyObject* args)
+{
+    return PyLong_FromSize_t(volk_get_alignment());
+}
+
+static PyObject* volk_py_get_machine(PyObject* self, PyObject* args)
+{
+    return PyUnicode_FromString(volk_get_machine());
+}
+
+static PyObject* volk_py_version(PyObject* self, PyObject* args)
+{
+    return PyUnicode_FromString(volk_version());
+}
+
+static PyMethodDef volk_py_methods[] = {
+    { "empty",
+      volk_py_empty,
+      METH_VARARGS,
+      "empty(n, format) -> Buffer of n items from volk_malloc" },
+    { "is_aligned",
+      volk_py_is_aligned,
+      METH_O,
+      "is_aligned(buffer) -> True if the kernels can take their aligned path" },
+    { "get_alignment",
+      volk_py_get_alignment,
+      METH_NOARGS,
+      "get_alignment() -> alignment in bytes of the aligned kernels" },
+    { "get_machine",
+      volk_py_get_machine,
+      METH_NOARGS,
+      "get_machine() -> name of the machine VOLK runs on" },
+    { "version", volk_py_version, METH_NOARGS, "version() -> VOLK version" },
+%for kern, parsed in python_kernels():
+    { "${kern.name}",
+      volk_py_${kern.name},
+      METH_VARARGS,
+      "${kern.name}(${kern.arglist_names})" },
+%endfor
+    { NULL, NULL, 0, NULL }
+};
+
+static struct PyModuleDef volk_py_module = {
+    PyModuleDef_HEAD_INIT, "_volk", "VOLK kernels for Python", -1, volk_py_methods,
+};
+
+PyMODINIT_FUNC PyInit__volk(void)
+{
+    if (PyType_Ready(&volk_py_buffer_type) < 0) {
+        return NULL;
+    }
+    PyObject* module = PyModule_Create(&volk_py_module);
+    if (module == NULL) {
+        return NULL;
+    }
+    Py_INCREF(&volk_py_buffer_type);
+    if (PyModule_AddObject(module, "Buffer", (PyObject*)&volk_py_buffer_type) < 0) {
+        Py_DECREF(&volk_py_buffer_type);
+        Py_DECREF(module);
+        return NULL;
+    }
+    return module;
+}